@@ -0,0 +1,274 @@
+//  BenchmarkSuite.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <BenchmarkSuite.h>
+#include <algorithm>
+#include <cstdlib>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+
+namespace
+{
+
+long long now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+
+/**
+ * Constructor
+ * @param argument Argument of the benchmark
+ * @param maxIterations Number of iterations to run
+ */
+BenchmarkState::BenchmarkState(int argument, long long maxIterations)
+{
+    argument_ = argument;
+    iterations_ = 0;
+    maxIterations_ = maxIterations;
+    start_ = 0;
+    elapsed_ = 0;
+    items_ = 0;
+    timing_ = false;
+} // BenchmarkState
+
+
+/**
+ * Returns true while there are iterations left. The clock starts on the
+ * first call and stops on the last one.
+ */
+bool BenchmarkState::keepRunning()
+{
+    if (iterations_ < maxIterations_)
+    {
+        if (iterations_ == 0)
+        {
+            resumeTiming();
+        }
+        iterations_++;
+        return true;
+    }
+
+    pauseTiming();
+    return false;
+} // keepRunning
+
+
+/**
+ * Stops the clock, e.g. to prepare the input of the next iteration
+ */
+void BenchmarkState::pauseTiming()
+{
+    if (timing_)
+    {
+        elapsed_ += now() - start_;
+        timing_ = false;
+    }
+} // pauseTiming
+
+
+void BenchmarkState::resumeTiming()
+{
+    if (!timing_)
+    {
+        start_ = now();
+        timing_ = true;
+    }
+} // resumeTiming
+
+
+/**
+ * Sets the number of items (evaluations, solutions...) processed by all the
+ * iterations, to report the throughput
+ */
+void BenchmarkState::setItemsProcessed(long long items)
+{
+    items_ = items;
+} // setItemsProcessed
+
+
+int BenchmarkState::getArgument()
+{
+    return argument_;
+} // getArgument
+
+
+long long BenchmarkState::getIterations()
+{
+    return iterations_;
+} // getIterations
+
+
+/**
+ * Returns the measured time, in nanoseconds
+ */
+long long BenchmarkState::getElapsedTime()
+{
+    return elapsed_;
+} // getElapsedTime
+
+
+long long BenchmarkState::getItemsProcessed()
+{
+    return items_;
+} // getItemsProcessed
+
+
+/**
+ * Adds a benchmark to the suite
+ * @param name Name of the benchmark
+ * @param function Function running the benchmark
+ * @param arguments The benchmark is run once per argument
+ */
+void BenchmarkSuite::add(std::string name, Function function,
+                    std::vector<int> arguments)
+{
+    Case benchmarkCase;
+    benchmarkCase.name = name;
+    benchmarkCase.function = function;
+    benchmarkCase.arguments = arguments;
+    cases_.push_back(benchmarkCase);
+} // add
+
+
+BenchmarkState BenchmarkSuite::measure(Function & function, int argument,
+                                  long long iterations)
+{
+    BenchmarkState state(argument, iterations);
+    function(state);
+    return state;
+} // measure
+
+
+/**
+ * Runs the benchmarks selected in the command line and prints the results
+ * @return 0, or 1 if the CSV file cannot be written
+ */
+int BenchmarkSuite::run(int argc, char ** argv)
+{
+    std::string filter = getOption(argc, argv, "filter", "");
+    double minTime = atof(getOption(argc, argv, "min-time", "0.5").c_str());
+    int repetitions = atoi(getOption(argc, argv, "repetitions", "1").c_str());
+    std::string csvFile = getOption(argc, argv, "csv", "");
+
+    std::ofstream csv;
+    if (csvFile != "")
+    {
+        csv.open(csvFile.c_str());
+        if (!csv.is_open())
+        {
+            std::cout << "BenchmarkSuite: cannot write file " << csvFile << std::endl;
+            return 1;
+        }
+        csv << "name,argument,iterations,repetitions,time_ns,min_time_ns,"
+            << "items_per_second" << std::endl;
+    }
+
+    printf("%-48s %12s %16s %16s %16s\n", "Benchmark", "Iterations",
+           "Time (ns)", "Min time (ns)", "Items/s");
+
+    for (size_t i = 0; i < cases_.size(); i++)
+    {
+        if (cases_[i].name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        for (size_t a = 0; a < cases_[i].arguments.size(); a++)
+        {
+            int argument = cases_[i].arguments[a];
+            std::string name = cases_[i].name;
+            if (argument != 0)
+            {
+                name += "/" + std::to_string(argument);
+            }
+
+            // Find a number of iterations lasting at least minTime
+            long long iterations = 1;
+            BenchmarkState state = measure(cases_[i].function, argument, iterations);
+            while ((state.getElapsedTime() < minTime * 1.0e9) &&
+                    (iterations < 1000000000LL))
+            {
+                double factor = 10.0;
+                if (state.getElapsedTime() > 0)
+                {
+                    factor = 1.4 * minTime * 1.0e9 / state.getElapsedTime();
+                    factor = std::max(2.0, std::min(10.0, factor));
+                }
+                iterations = (long long) (iterations * factor);
+                state = measure(cases_[i].function, argument, iterations);
+            }
+
+            double time = 0.0;
+            double minimum = 0.0;
+            double items = 0.0;
+            for (int r = 0; r < repetitions; r++)
+            {
+                if (r > 0)
+                {
+                    state = measure(cases_[i].function, argument, iterations);
+                }
+                double perIteration = (double) state.getElapsedTime() / iterations;
+                time += perIteration / repetitions;
+                minimum = (r == 0) ? perIteration : std::min(minimum, perIteration);
+                items += state.getItemsProcessed() * 1.0e9 /
+                         std::max(1LL, state.getElapsedTime()) / repetitions;
+            }
+
+            printf("%-48s %12lld %16.0f %16.0f %16.6g\n", name.c_str(),
+                   iterations, time, minimum, items);
+            fflush(stdout);
+            if (csv.is_open())
+            {
+                csv << cases_[i].name << "," << argument << "," << iterations
+                    << "," << repetitions << "," << time << "," << minimum
+                    << "," << items << std::endl;
+            }
+        }
+    }
+
+    return 0;
+} // run
+
+
+/**
+ * Returns the value of a command line option given as --name=value
+ * @param defaultValue Value returned if the option is not present
+ */
+std::string BenchmarkSuite::getOption(int argc, char ** argv, std::string name,
+                                 std::string defaultValue)
+{
+    std::string prefix = "--" + name + "=";
+    for (int i = 1; i < argc; i++)
+    {
+        std::string option = argv[i];
+        if (option.compare(0, prefix.size(), prefix) == 0)
+        {
+            return option.substr(prefix.size());
+        }
+    }
+    return defaultValue;
+} // getOption
@@ -0,0 +1,116 @@
+//  BenchmarkSuite.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __BENCHMARK_SUITE__
+#define __BENCHMARK_SUITE__
+
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * State of a benchmark run. The benchmark function runs its timed code in a
+ * <code>while (state.keepRunning())</code> loop; the number of iterations is
+ * chosen by the <code>BenchmarkSuite</code> runner.
+ */
+class BenchmarkState
+{
+
+private:
+    int argument_;
+    long long iterations_;
+    long long maxIterations_;
+    long long start_;
+    long long elapsed_;
+    long long items_;
+    bool timing_;
+
+public:
+    BenchmarkState(int argument, long long maxIterations);
+
+    bool keepRunning();
+    void pauseTiming();
+    void resumeTiming();
+    void setItemsProcessed(long long items);
+
+    int getArgument();
+    long long getIterations();
+    long long getElapsedTime();
+    long long getItemsProcessed();
+
+}; // BenchmarkState
+
+
+/**
+ * This class runs a suite of benchmarks, in the style of Google Benchmark.
+ * Each benchmark is run once per argument (typically a problem size; 0 means
+ * that the benchmark takes no argument). The
+ * number of iterations is increased until a run lasts at least the minimum
+ * time, and the measured run is then repeated the requested number of times.
+ *
+ * Command line options:
+ *  --filter=<text>        Only run the benchmarks whose name contains text
+ *  --min-time=<seconds>   Minimum duration of a measured run (0.5)
+ *  --repetitions=<n>      Number of measured runs (1)
+ *  --csv=<file>           Also write the results as CSV to a file
+ */
+class BenchmarkSuite
+{
+
+public:
+    typedef std::function<void(BenchmarkState &)> Function;
+
+private:
+    struct Case
+    {
+        std::string name;
+        Function function;
+        std::vector<int> arguments;
+    };
+
+    std::vector<Case> cases_;
+
+    static BenchmarkState measure(Function & function, int argument,
+                                  long long iterations);
+
+public:
+    void add(std::string name, Function function,
+             std::vector<int> arguments = std::vector<int>(1, 0));
+    int run(int argc, char ** argv);
+
+    static std::string getOption(int argc, char ** argv, std::string name,
+                                 std::string defaultValue);
+
+    /**
+     * Prevents the compiler from optimizing away the computation of a value
+     */
+    template <class T> static void doNotOptimize(T const & value)
+    {
+#if defined(__GNUC__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void * sink;
+        sink = &value;
+#endif
+    }
+
+}; // BenchmarkSuite
+
+#endif /* __BENCHMARK_SUITE__ */
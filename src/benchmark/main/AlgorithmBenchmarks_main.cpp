@@ -0,0 +1,193 @@
+//  AlgorithmBenchmarks_main.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <BenchmarkSuite.h>
+#include <Problem.h>
+#include <Algorithm.h>
+#include <SolutionSet.h>
+#include <ProblemFactory.h>
+#include <NSGAII.h>
+#include <SMPSO.h>
+#include <MOEAD.h>
+#include <SBXCrossover.h>
+#include <PolynomialMutation.h>
+#include <DifferentialEvolutionCrossover.h>
+#include <BinaryTournament2.h>
+#include <iostream>
+
+
+/**
+ * Throughput of whole algorithms, in evaluations per second. The argument of
+ * each benchmark is the number of evaluations of a run.
+ *
+ * Usage: AlgorithmBenchmarks_main [--filter=<text>] [--min-time=<seconds>]
+ *                                 [--repetitions=<n>] [--csv=<file>]
+ *                                 [--data=<weights directory of MOEAD>]
+ */
+
+
+/**
+ * Runs an algorithm and deletes it, together with its operators and result
+ */
+void runAlgorithm(Algorithm * algorithm, std::vector<Operator *> & operators)
+{
+    SolutionSet * population = algorithm->execute();
+    delete population;
+    delete algorithm;
+    for (size_t i = 0; i < operators.size(); i++)
+    {
+        delete operators[i];
+    }
+    operators.clear();
+} // runAlgorithm
+
+
+/**
+ * Creates a problem from its name, with its default configuration
+ */
+Problem * getProblem(std::string name)
+{
+    return ProblemFactory::getProblem(const_cast<char *>(name.c_str()));
+} // getProblem
+
+
+int main(int argc, char ** argv)
+{
+    std::string dataDirectory =
+        BenchmarkSuite::getOption(argc, argv, "data", "../../data/Weight");
+
+    std::vector<int> evaluations = { 25000 };
+    std::string problems[] = { "ZDT1", "DTLZ2" };
+    BenchmarkSuite suite;
+
+    for (std::string name : problems)
+    {
+        suite.add("NSGAII/" + name, [name](BenchmarkState & state)
+        {
+            int populationSize = 100;
+            int maxEvaluations = state.getArgument();
+            double crossoverProbability = 0.9;
+            double distributionIndex = 20.0;
+            double mutationProbability;
+            std::vector<Operator *> operators;
+
+            while (state.keepRunning())
+            {
+                state.pauseTiming();
+                Problem * problem = getProblem(name);
+                Algorithm * algorithm = new NSGAII(problem);
+                algorithm->setInputParameter("populationSize", &populationSize);
+                algorithm->setInputParameter("maxEvaluations", &maxEvaluations);
+
+                MapOfStringFunct parameters;
+                parameters["probability"] = &crossoverProbability;
+                parameters["distributionIndex"] = &distributionIndex;
+                operators.push_back(new SBXCrossover(parameters));
+                algorithm->addOperator("crossover", operators.back());
+
+                mutationProbability = 1.0 / problem->getNumberOfVariables();
+                parameters["probability"] = &mutationProbability;
+                operators.push_back(new PolynomialMutation(parameters));
+                algorithm->addOperator("mutation", operators.back());
+
+                parameters.clear();
+                operators.push_back(new BinaryTournament2(parameters));
+                algorithm->addOperator("selection", operators.back());
+                state.resumeTiming();
+
+                runAlgorithm(algorithm, operators);
+            }
+            state.setItemsProcessed(state.getIterations() * maxEvaluations);
+        }, evaluations);
+
+        suite.add("SMPSO/" + name, [name](BenchmarkState & state)
+        {
+            int swarmSize = 100;
+            int archiveSize = 100;
+            int maxIterations = state.getArgument() / swarmSize - 1;
+            double distributionIndex = 20.0;
+            double mutationProbability;
+            std::vector<Operator *> operators;
+
+            while (state.keepRunning())
+            {
+                state.pauseTiming();
+                Problem * problem = getProblem(name);
+                Algorithm * algorithm = new SMPSO(problem);
+                algorithm->setInputParameter("swarmSize", &swarmSize);
+                algorithm->setInputParameter("archiveSize", &archiveSize);
+                algorithm->setInputParameter("maxIterations", &maxIterations);
+
+                MapOfStringFunct parameters;
+                mutationProbability = 1.0 / problem->getNumberOfVariables();
+                parameters["probability"] = &mutationProbability;
+                parameters["distributionIndex"] = &distributionIndex;
+                operators.push_back(new PolynomialMutation(parameters));
+                algorithm->addOperator("mutation", operators.back());
+                state.resumeTiming();
+
+                runAlgorithm(algorithm, operators);
+            }
+            state.setItemsProcessed(state.getIterations() * swarmSize *
+                                    (maxIterations + 1));
+        }, evaluations);
+
+        suite.add("MOEAD/" + name, [name, dataDirectory](BenchmarkState & state)
+        {
+            int populationSize = 100;
+            int maxEvaluations = state.getArgument();
+            std::string directory = dataDirectory;
+            double cr = 1.0;
+            double f = 0.5;
+            double distributionIndex = 20.0;
+            double mutationProbability;
+            std::vector<Operator *> operators;
+
+            while (state.keepRunning())
+            {
+                state.pauseTiming();
+                Problem * problem = getProblem(name);
+                Algorithm * algorithm = new MOEAD(problem);
+                algorithm->setInputParameter("populationSize", &populationSize);
+                algorithm->setInputParameter("maxEvaluations", &maxEvaluations);
+                algorithm->setInputParameter("dataDirectory", &directory);
+
+                MapOfStringFunct parameters;
+                parameters["CR"] = &cr;
+                parameters["F"] = &f;
+                operators.push_back(new DifferentialEvolutionCrossover(parameters));
+                algorithm->addOperator("crossover", operators.back());
+
+                parameters.clear();
+                mutationProbability = 1.0 / problem->getNumberOfVariables();
+                parameters["probability"] = &mutationProbability;
+                parameters["distributionIndex"] = &distributionIndex;
+                operators.push_back(new PolynomialMutation(parameters));
+                algorithm->addOperator("mutation", operators.back());
+                state.resumeTiming();
+
+                runAlgorithm(algorithm, operators);
+            }
+            state.setItemsProcessed(state.getIterations() * maxEvaluations);
+        }, evaluations);
+    }
+
+    return suite.run(argc, argv);
+} // main
@@ -0,0 +1,326 @@
+//  KernelBenchmarks_main.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <BenchmarkSuite.h>
+#include <Problem.h>
+#include <Solution.h>
+#include <SolutionSet.h>
+#include <ZDT1.h>
+#include <DTLZ2.h>
+#include <Ranking.h>
+#include <Distance.h>
+#include <Hypervolume.h>
+#include <FastHypervolume.h>
+#include <NonDominatedSolutionList.h>
+#include <CrowdingArchive.h>
+#include <AdaptiveGrid.h>
+#include <SBXCrossover.h>
+#include <PolynomialMutation.h>
+#include <DifferentialEvolutionCrossover.h>
+#include <PseudoRandom.h>
+#include <cmath>
+#include <iostream>
+
+
+/**
+ * Micro benchmarks of the kernels used by the metaheuristics. The argument of
+ * each benchmark is the number of solutions it works on.
+ *
+ * Usage: KernelBenchmarks_main [--filter=<text>] [--min-time=<seconds>]
+ *                              [--repetitions=<n>] [--csv=<file>]
+ */
+
+
+/**
+ * Returns a population of random solutions, evaluated
+ */
+SolutionSet * randomPopulation(Problem * problem, int size)
+{
+    SolutionSet * population = new SolutionSet(size);
+    for (int i = 0; i < size; i++)
+    {
+        Solution * solution = new Solution(problem);
+        problem->evaluate(solution);
+        population->add(solution);
+    }
+    return population;
+} // randomPopulation
+
+
+/**
+ * Returns solutions scattered close to a convex front (ZDT1 shape with two
+ * objectives, sphere with more), as found in the archives of a run
+ */
+SolutionSet * frontPopulation(Problem * problem, int size)
+{
+    int numberOfObjectives = problem->getNumberOfObjectives();
+    SolutionSet * population = new SolutionSet(size);
+    for (int i = 0; i < size; i++)
+    {
+        Solution * solution = new Solution(problem);
+        double noise = 1.0 + 0.05 * PseudoRandom::randDouble();
+        if (numberOfObjectives == 2)
+        {
+            double x = PseudoRandom::randDouble();
+            solution->setObjective(0, x);
+            solution->setObjective(1, (1.0 - sqrt(x)) * noise);
+        }
+        else
+        {
+            double norm = 0.0;
+            for (int j = 0; j < numberOfObjectives; j++)
+            {
+                double value = fabs(PseudoRandom::randNormal(0.0, 1.0));
+                solution->setObjective(j, value);
+                norm += value * value;
+            }
+            norm = sqrt(norm);
+            for (int j = 0; j < numberOfObjectives; j++)
+            {
+                solution->setObjective(j, solution->getObjective(j) / norm * noise);
+            }
+        }
+        population->add(solution);
+    }
+    return population;
+} // frontPopulation
+
+
+int main(int argc, char ** argv)
+{
+    Problem * zdt1 = new ZDT1("Real");
+    Problem * dtlz2 = new DTLZ2("Real");
+    Problem * problems[] = { zdt1, dtlz2 };
+
+    std::vector<int> sizes = { 100, 400, 1600 };
+    BenchmarkSuite suite;
+
+    for (Problem * problem : problems)
+    {
+        std::string suffix = "/" + problem->getName();
+
+        suite.add("Ranking" + suffix, [problem](BenchmarkState & state)
+        {
+            SolutionSet * population = randomPopulation(problem, state.getArgument());
+            while (state.keepRunning())
+            {
+                Ranking ranking(population);
+                BenchmarkSuite::doNotOptimize(ranking.getNumberOfSubfronts());
+            }
+            state.setItemsProcessed(state.getIterations() * population->size());
+            delete population;
+        }, sizes);
+
+        suite.add("CrowdingDistance" + suffix, [problem](BenchmarkState & state)
+        {
+            SolutionSet * population = frontPopulation(problem, state.getArgument());
+            Distance distance;
+            while (state.keepRunning())
+            {
+                distance.crowdingDistanceAssignment(population,
+                                                    problem->getNumberOfObjectives());
+                BenchmarkSuite::doNotOptimize(population->get(0)->getCrowdingDistance());
+            }
+            state.setItemsProcessed(state.getIterations() * population->size());
+            delete population;
+        }, sizes);
+
+        suite.add("Hypervolume" + suffix, [problem](BenchmarkState & state)
+        {
+            SolutionSet * population = frontPopulation(problem, state.getArgument());
+            MatrixOfDouble front = population->writeObjectivesToMatrix();
+            Hypervolume hypervolume;
+            while (state.keepRunning())
+            {
+                BenchmarkSuite::doNotOptimize(hypervolume.hypervolume(front, front,
+                                         problem->getNumberOfObjectives()));
+            }
+            state.setItemsProcessed(state.getIterations() * population->size());
+            delete population;
+        }, { 100, 400 });
+
+        suite.add("NonDominatedSolutionList::add" + suffix,
+                  [problem](BenchmarkState & state)
+        {
+            SolutionSet * population = frontPopulation(problem, state.getArgument());
+            while (state.keepRunning())
+            {
+                state.pauseTiming();
+                NonDominatedSolutionList * list = new NonDominatedSolutionList();
+                std::vector<Solution *> copies(population->size());
+                for (int i = 0; i < population->size(); i++)
+                {
+                    copies[i] = new Solution(population->get(i));
+                }
+                state.resumeTiming();
+
+                for (size_t i = 0; i < copies.size(); i++)
+                {
+                    if (!list->add(copies[i]))
+                    {
+                        delete copies[i];
+                    }
+                }
+
+                state.pauseTiming();
+                delete list;
+                state.resumeTiming();
+            }
+            state.setItemsProcessed(state.getIterations() * population->size());
+            delete population;
+        }, sizes);
+
+        suite.add("CrowdingArchive::add" + suffix, [problem](BenchmarkState & state)
+        {
+            SolutionSet * population = frontPopulation(problem, state.getArgument());
+            while (state.keepRunning())
+            {
+                state.pauseTiming();
+                CrowdingArchive * archive =
+                    new CrowdingArchive(100, problem->getNumberOfObjectives());
+                std::vector<Solution *> copies(population->size());
+                for (int i = 0; i < population->size(); i++)
+                {
+                    copies[i] = new Solution(population->get(i));
+                }
+                state.resumeTiming();
+
+                for (size_t i = 0; i < copies.size(); i++)
+                {
+                    if (!archive->add(copies[i]))
+                    {
+                        delete copies[i];
+                    }
+                }
+
+                state.pauseTiming();
+                delete archive;
+                state.resumeTiming();
+            }
+            state.setItemsProcessed(state.getIterations() * population->size());
+            delete population;
+        }, sizes);
+
+        suite.add("AdaptiveGrid::location" + suffix, [problem](BenchmarkState & state)
+        {
+            SolutionSet * population = frontPopulation(problem, state.getArgument());
+            AdaptiveGrid grid(5, problem->getNumberOfObjectives());
+            grid.updateGrid(population);
+            while (state.keepRunning())
+            {
+                for (int i = 0; i < population->size(); i++)
+                {
+                    BenchmarkSuite::doNotOptimize(grid.location(population->get(i)));
+                }
+            }
+            state.setItemsProcessed(state.getIterations() * population->size());
+            delete population;
+        }, sizes);
+    }
+
+    suite.add("FastHypervolume::computeHVContributions/ZDT1",
+              [zdt1](BenchmarkState & state)
+    {
+        SolutionSet * population = frontPopulation(zdt1, state.getArgument());
+        FastHypervolume hypervolume;
+        while (state.keepRunning())
+        {
+            hypervolume.computeHVContributions(population);
+            BenchmarkSuite::doNotOptimize(population->get(0)->getCrowdingDistance());
+        }
+        state.setItemsProcessed(state.getIterations() * population->size());
+        delete population;
+    }, sizes);
+
+    // Variation operators, applied to ZDT1 solutions (30 variables)
+    suite.add("SBXCrossover/ZDT1", [zdt1](BenchmarkState & state)
+    {
+        MapOfStringFunct parameters;
+        double probability = 0.9;
+        double distributionIndex = 20.0;
+        parameters["probability"] = &probability;
+        parameters["distributionIndex"] = &distributionIndex;
+        SBXCrossover crossover(parameters);
+
+        Solution * parents[2] = { new Solution(zdt1), new Solution(zdt1) };
+        while (state.keepRunning())
+        {
+            Solution ** offspring = (Solution **) crossover.execute(parents);
+            delete offspring[0];
+            delete offspring[1];
+            delete [] offspring;
+        }
+        state.setItemsProcessed(state.getIterations());
+        delete parents[0];
+        delete parents[1];
+    });
+
+    suite.add("PolynomialMutation/ZDT1", [zdt1](BenchmarkState & state)
+    {
+        MapOfStringFunct parameters;
+        double probability = 1.0 / zdt1->getNumberOfVariables();
+        double distributionIndex = 20.0;
+        parameters["probability"] = &probability;
+        parameters["distributionIndex"] = &distributionIndex;
+        PolynomialMutation mutation(parameters);
+
+        Solution * solution = new Solution(zdt1);
+        while (state.keepRunning())
+        {
+            mutation.execute(solution);
+        }
+        state.setItemsProcessed(state.getIterations());
+        delete solution;
+    });
+
+    suite.add("DifferentialEvolutionCrossover/ZDT1", [zdt1](BenchmarkState & state)
+    {
+        MapOfStringFunct parameters;
+        double cr = 1.0;
+        double f = 0.5;
+        parameters["CR"] = &cr;
+        parameters["F"] = &f;
+        DifferentialEvolutionCrossover crossover(parameters);
+
+        Solution * current = new Solution(zdt1);
+        Solution * parents[3] =
+        {
+            new Solution(zdt1), new Solution(zdt1), new Solution(zdt1)
+        };
+        void * object[2] = { current, parents };
+        while (state.keepRunning())
+        {
+            delete (Solution *) crossover.execute(object);
+        }
+        state.setItemsProcessed(state.getIterations());
+        delete current;
+        for (int i = 0; i < 3; i++)
+        {
+            delete parents[i];
+        }
+    });
+
+    int result = suite.run(argc, argv);
+
+    delete zdt1;
+    delete dtlz2;
+
+    return result;
+} // main
@@ -21,6 +21,12 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <Algorithm.h>
+#include <Migration.h>
+#include <DominanceComparator.h>
+#include <Checkpoint.h>
+#include <CheckpointWriter.h>
+#include <PseudoRandom.h>
+#include <TerminationCriterion.h>
 
 
 /**
@@ -38,6 +44,7 @@ Algorithm::Algorithm(Problem *problem)
  */
 Algorithm::~Algorithm()
 {
+    delete checkpointWriter_;
     delete problem_;
 } // ~Algorithm
 
@@ -131,3 +138,268 @@ Problem * Algorithm::getProblem()
 {
     return problem_;
 }
+
+
+/**
+ * Connects the algorithm to the other islands of an island model (see
+ * <code>IslandModel</code>). Without a migration the algorithm runs alone.
+ * @param migration The end point of the island. It is not deleted
+**/
+void Algorithm::setMigration(Migration * migration)
+{
+    migration_ = migration;
+}
+
+
+/**
+ * Adds a criterion that may stop the algorithm before its maximum number of
+ * evaluations. The run stops as soon as any of the criteria is met, and the
+ * name of that criterion is given in the "terminationCriterion" output
+ * parameter (std::string).
+ * @param criterion The criterion. It is not deleted
+**/
+void Algorithm::addTerminationCriterion(TerminationCriterion * criterion)
+{
+    terminationCriteria_.push_back(criterion);
+}
+
+
+/**
+ * Sends and receives migrants if a migration is due. Algorithms call it
+ * once per iteration.
+ * @param population The solutions the emigrants are taken from
+ * @param evaluations Number of evaluations done so far
+ * @return The immigrants, owned by the caller, or nullptr if there is no
+ * migration at this point
+**/
+SolutionSet * Algorithm::exchangeMigrants(SolutionSet * population, long evaluations)
+{
+    if ((migration_ == nullptr) || !migration_->isDue(evaluations))
+    {
+        return nullptr;
+    }
+    migration_->send(population);
+    return migration_->receive();
+}
+
+
+/**
+ * Default migration policy: each immigrant replaces the worst solution of
+ * the population according to a comparator, unless that solution dominates
+ * it. The replaced solutions and the rejected immigrants are deleted.
+ * @param population The population of the algorithm
+ * @param evaluations Number of evaluations done so far
+ * @param comparator Comparator used to find the worst solution
+**/
+void Algorithm::migrate(SolutionSet * population, long evaluations,
+                        Comparator * comparator)
+{
+    SolutionSet * immigrants = exchangeMigrants(population, evaluations);
+    if (immigrants == nullptr)
+    {
+        return;
+    }
+
+    DominanceComparator dominance;
+    while (immigrants->size() > 0)
+    {
+        Solution * immigrant = immigrants->release(immigrants->size() - 1).release();
+        int worst = population->indexWorst(comparator);
+        if (dominance.compare(population->get(worst), immigrant) == -1)
+        {
+            delete immigrant;
+        }
+        else
+        {
+            delete population->get(worst);
+            population->replace(worst, immigrant);
+        }
+    }
+    delete immigrants;
+}
+
+
+/**
+ * Checks whether a snapshot of the algorithm must be taken. Snapshots are
+ * enabled by the "checkpointFile" input parameter (std::string), and taken
+ * every "checkpointInterval" evaluations (positive int, 10000 by default).
+ * @param evaluations Number of evaluations done so far
+ * @return true if the algorithm must take a snapshot now
+**/
+bool Algorithm::isCheckpointDue(long evaluations)
+{
+    if (getInputParameter("checkpointFile") == nullptr)
+    {
+        return false;
+    }
+    long interval = 10000;
+    if (getInputParameter("checkpointInterval") != nullptr)
+    {
+        interval = *(int *) getInputParameter("checkpointInterval");
+    }
+    if (interval <= 0)
+    {
+        std::cout << "Algorithm::isCheckpointDue: checkpointInterval must be "
+                  << "positive, not " << interval << std::endl;
+        exit(-1);
+    }
+    return (evaluations / interval) > (lastCheckpoint_ / interval);
+}
+
+
+/**
+ * Starts a snapshot with the description of the algorithm and the problem.
+ * The algorithm then writes its state and calls <code>endCheckpoint</code>.
+ * @param snapshot The snapshot. Its previous contents are discarded
+ * @param name The name of the algorithm
+ * @param evaluations Number of evaluations done so far
+**/
+void Algorithm::beginCheckpoint(Checkpoint & snapshot, std::string name,
+                                long evaluations)
+{
+    lastCheckpoint_ = evaluations;
+    snapshot.clear();
+    snapshot.writeString("jMetalCpp checkpoint 1");
+    snapshot.writeString(name);
+    snapshot.writeString(problem_->getName());
+    snapshot.writeInt(problem_->getNumberOfVariables());
+    snapshot.writeInt(problem_->getNumberOfObjectives());
+    snapshot.writeLong(evaluations);
+}
+
+
+/**
+ * Completes a snapshot with the state of the operators and of the random
+ * generator of the calling thread, and hands it to the background thread
+ * that writes it to the "checkpointFile".
+ * @param snapshot The snapshot. It is left empty
+**/
+void Algorithm::endCheckpoint(Checkpoint & snapshot)
+{
+    for (auto & entry : operators_)
+    {
+        if (entry.second != nullptr)
+        {
+            snapshot.writeString(entry.first);
+            entry.second->writeState(snapshot);
+        }
+    }
+    snapshot.writeRandomGenerator(PseudoRandom::getRandomGenerator());
+
+    if (checkpointWriter_ == nullptr)
+    {
+        checkpointWriter_ = snew CheckpointWriter(
+            *(std::string *) getInputParameter("checkpointFile"));
+    }
+    checkpointWriter_->submit(snapshot);
+}
+
+
+/**
+ * Loads the snapshot given in the "resumeFile" input parameter
+ * (std::string), if any. It must be called at the start of
+ * <code>execute</code>; the algorithm then reads its state instead of
+ * initializing it, and calls <code>endResume</code>.
+ * @param snapshot An empty snapshot, positioned after the description of
+ * the algorithm on return
+ * @param name The name of the algorithm
+ * @return false if the algorithm must start from scratch
+**/
+bool Algorithm::beginResume(Checkpoint & snapshot, std::string name)
+{
+    lastCheckpoint_ = 0;
+    if (getInputParameter("resumeFile") == nullptr)
+    {
+        return false;
+    }
+
+    std::string path = *(std::string *) getInputParameter("resumeFile");
+    if (!snapshot.load(path))
+    {
+        std::cout << name << ": unable to read the snapshot " << path << std::endl;
+        exit(-1);
+    }
+    if ((snapshot.readString() != "jMetalCpp checkpoint 1") ||
+            (snapshot.readString() != name) ||
+            (snapshot.readString() != problem_->getName()) ||
+            (snapshot.readInt() != problem_->getNumberOfVariables()) ||
+            (snapshot.readInt() != problem_->getNumberOfObjectives()))
+    {
+        std::cout << name << ": " << path << " is not a snapshot of "
+                  << name << " solving " << problem_->getName() << std::endl;
+        exit(-1);
+    }
+    lastCheckpoint_ = snapshot.readLong();
+    return true;
+}
+
+
+/**
+ * Restores the state of the operators and of the random generator of the
+ * calling thread. It must be called once the algorithm has read its state,
+ * just before resuming its main loop.
+ * @param snapshot The snapshot being read
+**/
+void Algorithm::endResume(Checkpoint & snapshot)
+{
+    for (auto & entry : operators_)
+    {
+        if (entry.second != nullptr)
+        {
+            if (snapshot.readString() != entry.first)
+            {
+                std::cout << "The operators of the snapshot do not match" << std::endl;
+                exit(-1);
+            }
+            entry.second->readState(snapshot);
+        }
+    }
+    snapshot.readRandomGenerator(PseudoRandom::getRandomGenerator());
+}
+
+
+/**
+ * Waits until the last snapshot has been written. It must be called at the
+ * end of <code>execute</code>.
+**/
+void Algorithm::finishCheckpoints()
+{
+    delete checkpointWriter_;
+    checkpointWriter_ = nullptr;
+}
+
+
+/**
+ * Prepares the termination criteria for a new run. It must be called at the
+ * start of <code>execute</code>.
+**/
+void Algorithm::startTermination()
+{
+    setOutputParameter("terminationCriterion", nullptr);
+    for (size_t i = 0; i < terminationCriteria_.size(); i++)
+    {
+        terminationCriteria_[i]->start();
+    }
+}
+
+
+/**
+ * Checks the termination criteria. Algorithms call it once per iteration,
+ * together with their own budget.
+ * @param population The current population (or archive)
+ * @param evaluations Number of evaluations done so far
+ * @return true if the algorithm must stop
+**/
+bool Algorithm::isTerminated(SolutionSet * population, long evaluations)
+{
+    for (size_t i = 0; i < terminationCriteria_.size(); i++)
+    {
+        if (terminationCriteria_[i]->isMet(population, evaluations))
+        {
+            terminationCriterion_ = terminationCriteria_[i]->getName();
+            setOutputParameter("terminationCriterion", &terminationCriterion_);
+            return true;
+        }
+    }
+    return false;
+}
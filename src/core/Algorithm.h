@@ -28,6 +28,13 @@
 #include <SolutionSet.h>
 #include <Operator.h>
 #include <Problem.h>
+#include <Instrumentation.h>
+#include <vector>
+
+class Migration;
+class Checkpoint;
+class CheckpointWriter;
+class TerminationCriterion;
 
 /**
  *  This class implements a generic template for the algorithms developed in
@@ -54,13 +61,76 @@ public:
     void setOutputParameter(std::string name, void *value);
     void * getOutputParameter(std::string name);
     Problem * getProblem();
+    void setMigration(Migration * migration);
+    void addTerminationCriterion(TerminationCriterion * criterion);
 
 protected:
 	Problem *problem_ = nullptr;
 	MapOfStringOperatorPtr operators_;
 	MapOfStringFunct inputParameters_;
 	MapOfStringFunct outputParameters_;
+	Migration * migration_ = nullptr;
+	CheckpointWriter * checkpointWriter_ = nullptr;
+	long lastCheckpoint_ = 0;
+	std::vector<TerminationCriterion *> terminationCriteria_;
+	std::string terminationCriterion_;
+
+	void startInstrumentation();
+	void publishInstrumentation();
+	SolutionSet * exchangeMigrants(SolutionSet * population, long evaluations);
+	void migrate(SolutionSet * population, long evaluations, Comparator * comparator);
+	bool isCheckpointDue(long evaluations);
+	void beginCheckpoint(Checkpoint & snapshot, std::string name, long evaluations);
+	void endCheckpoint(Checkpoint & snapshot);
+	bool beginResume(Checkpoint & snapshot, std::string name);
+	void endResume(Checkpoint & snapshot);
+	void finishCheckpoints();
+	void startTermination();
+	bool isTerminated(SolutionSet * population, long evaluations);
+
+#ifdef JMETAL_INSTRUMENTATION
+private:
+	Instrumentation::Counters instrumentationStart_;
+	long long instrumentationStartTime_;
+	std::string instrumentationJSON_;
+	std::string instrumentationCSV_;
+#endif
 
 }; // Algorithm
 
+
+/**
+ * Marks the beginning of a run. It must be called at the start of
+ * <code>execute</code>.
+**/
+inline void Algorithm::startInstrumentation()
+{
+#ifdef JMETAL_INSTRUMENTATION
+    instrumentationStart_ = Instrumentation::snapshot();
+    instrumentationStartTime_ = Instrumentation::now();
+#endif
+}
+
+
+/**
+ * Sets the "instrumentationJSON" and "instrumentationCSV" output parameters
+ * (std::string) with the counters collected since
+ * <code>startInstrumentation</code> was called. The counters of every thread
+ * are included, so they also account for any algorithm running concurrently.
+ * Without JMETAL_INSTRUMENTATION both methods do nothing and the output
+ * parameters are not set.
+**/
+inline void Algorithm::publishInstrumentation()
+{
+#ifdef JMETAL_INSTRUMENTATION
+    Instrumentation::Counters counters = Instrumentation::difference(
+            Instrumentation::snapshot(), instrumentationStart_);
+    double wallTime = (Instrumentation::now() - instrumentationStartTime_) / 1.0e9;
+    instrumentationJSON_ = Instrumentation::toJSON(counters, wallTime);
+    instrumentationCSV_ = Instrumentation::toCSV(counters, wallTime);
+    setOutputParameter("instrumentationJSON", &instrumentationJSON_);
+    setOutputParameter("instrumentationCSV", &instrumentationCSV_);
+#endif
+}
+
 #endif
@@ -68,3 +68,22 @@ void * Operator::getParameter(std::string name)
     return parameters_[name];
 }
 
+
+
+/**
+ * Writes the state the operator keeps between calls to a snapshot. Only
+ * operators with such a state (e.g. BinaryTournament2) re-define it.
+ * @param checkpoint The snapshot
+**/
+void Operator::writeState(Checkpoint & checkpoint)
+{
+} // writeState
+
+
+/**
+ * Restores the state written by <code>writeState</code>.
+ * @param checkpoint The snapshot
+**/
+void Operator::readState(Checkpoint & checkpoint)
+{
+} // readState
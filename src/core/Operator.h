@@ -35,6 +35,8 @@
 
 using namespace JMetal;
 
+class Checkpoint;
+
 class Operator
 {
 
@@ -48,6 +50,8 @@ public:
     virtual void *execute(void *) = 0;
     void setParameter(std::string name, void *value);
     void *getParameter(std::string name);
+    virtual void writeState(Checkpoint & checkpoint);
+    virtual void readState(Checkpoint & checkpoint);
 
 }; // Operator
 
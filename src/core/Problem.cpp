@@ -22,6 +22,9 @@
 
 
 #include <Problem.h>
+#include <XReal.h>
+#include <SolutionSet.h>
+#include <vector>
 
 
 const int Problem::DEFAULT_PRECISSION = 16;
@@ -146,6 +149,75 @@ void Problem::evaluateConstraints(Solution * solution)
 } // evaluateConstraints
 
 
+/**
+ * Evaluates the objectives and the constraints of all the solutions of a
+ * set. Problems that can evaluate several solutions at once (e.g. in other
+ * processes) re-define this method; by default the solutions are evaluated
+ * one after another.
+ * @param solutionSet The solutions to evaluate.
+ */
+void Problem::evaluateSolutions(SolutionSet * solutionSet)
+{
+    for (int i = 0; i < solutionSet->size(); i++)
+    {
+        evaluate(solutionSet->get(i));
+        evaluateConstraints(solutionSet->get(i));
+    } // for
+} // evaluateSolutions
+
+
+/**
+ * Evaluates a contiguous vector of decision variables, writing the objective
+ * values to fx. Problems offering allocation-free kernels re-define this
+ * method; evaluate(Solution *) then becomes a thin wrapper around it.
+ * @param x The numberOfVariables_ decision variables.
+ * @param fx Array receiving the numberOfObjectives_ objective values.
+ */
+void Problem::evaluateVector(const double * x, double * fx)
+{
+    std::cout << "Problem::evaluateVector: problem " << problemName_
+              << " has no vector evaluation" << std::endl;
+    exit(-1);
+} // evaluateVector
+
+
+/**
+ * Evaluates count vectors of decision variables stored row by row in x,
+ * writing the objective values row by row to fx.
+ * @param x Matrix of count x numberOfVariables_ decision variables.
+ * @param fx Matrix of count x numberOfObjectives_ objective values.
+ * @param count The number of vectors.
+ */
+void Problem::evaluateBatch(const double * x, double * fx, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        evaluateVector(x + i * numberOfVariables_, fx + i * numberOfObjectives_);
+    } // for
+} // evaluateBatch
+
+
+/**
+ * Copies the real decision variables of a solution to a per-thread buffer,
+ * so that evaluate(Solution *) can call evaluateVector without allocating.
+ * The buffer is overwritten by the next call from the same thread.
+ * @param solution The solution.
+ * @return A pointer to the numberOfVariables_ values.
+ */
+double * Problem::readVariables(Solution * solution)
+{
+    static thread_local std::vector<double> buffer;
+
+    if (buffer.size() < numberOfVariables_)
+    {
+        buffer.resize(numberOfVariables_);
+    }
+    XReal vars(solution);
+    vars.getValues(buffer.data());
+    return buffer.data();
+} // readVariables
+
+
 /**
  * Returns the number of bits that must be used to encode binary-real
  * variables
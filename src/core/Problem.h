@@ -32,6 +32,7 @@
 
 class SolutionType;
 class Solution;
+class SolutionSet;
 
 /**
  * Abstract class representing a multiobjective optimization problem
@@ -39,6 +40,10 @@ class Solution;
 class Problem
 {
 
+    // Shares the description of the problem it wraps
+    friend class CachedProblem;
+    friend class DistributedProblem;
+
 private:
     static const int DEFAULT_PRECISSION;
 
@@ -53,6 +58,8 @@ protected:
     int *precision_;
     int *length_;
 
+    double * readVariables(Solution * solution);
+
 public:
     Problem();
     Problem(SolutionType * solutionType);
@@ -64,8 +71,11 @@ public:
     double getLowerLimit(int i);
     double getUpperLimit(int i);
     virtual void evaluate(Solution * solution) = 0;
+    virtual void evaluateVector(const double * x, double * fx);
+    virtual void evaluateBatch(const double * x, double * fx, int count);
     int getNumberOfConstraints();
     virtual void evaluateConstraints(Solution * solution);
+    virtual void evaluateSolutions(SolutionSet * solutionSet);
     int getPrecision(int var);
     int * getPrecision();
     void setPrecision(int * precision);
@@ -22,6 +22,7 @@
 
 
 #include <Solution.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -51,16 +52,15 @@ Solution::Solution ()
  */
 Solution::Solution (int numberOfObjectives)
 {
+    JMETAL_COUNT_ALLOCATION();
+
+    problem_ = nullptr;
+    type_ = nullptr;
     overallConstraintViolation_ = 0.0;
     numberOfObjectives_ = numberOfObjectives;
     numberOfVariables_ = 0;
     variable_ = nullptr;
-    objective_ = snew double[numberOfObjectives_];
-    if (objective_ == nullptr)
-    {
-        std::cout << "ERROR GRAVE: Impossible to reserve memory for storing objectives in class Solution" << std::endl;
-        exit(-1);
-    }
+    allocateObjectives();
     rank_ = 0;
 }
 
@@ -72,6 +72,8 @@ Solution::Solution (int numberOfObjectives)
  */
 Solution::Solution (Problem *problem)
 {
+    JMETAL_COUNT_ALLOCATION();
+
     problem_ = problem;
     type_ = problem_->getSolutionType();
     overallConstraintViolation_ = 0.0;
@@ -79,20 +81,14 @@ Solution::Solution (Problem *problem)
     numberOfVariables_  = problem_->getNumberOfVariables();
 
     // creating the objective vector
-    objective_ = snew double[numberOfObjectives_];
-    if (objective_ == nullptr)
-    {
-        std::cout << "ERROR GRAVE: Impossible to reserve memory for storing objectives in class Solution" << std::endl;
-        exit(-1);
-    }
-    // at this point objective vector has been created successfully
+    allocateObjectives();
 
     // Setting initial values
     fitness_ = 0.0;
     kDistance_ = 0.0;
     crowdingDistance_ = 0.0;
     distanceToSolutionSet_ = std::numeric_limits<double>::max();
-    variable_ = type_->createVariables();
+    createVariables();
     rank_ = 0;
 } // Solution
 
@@ -103,11 +99,13 @@ Solution::Solution (Problem *problem)
  */
 Solution::Solution (Problem * problem, Variable ** variables)
 {
+    JMETAL_COUNT_ALLOCATION();
+
     problem_ = problem;
     type_ = problem->getSolutionType();
     numberOfObjectives_ = problem->getNumberOfObjectives();
     numberOfVariables_  = problem_->getNumberOfVariables();
-    objective_ = snew double[numberOfObjectives_] ;
+    allocateObjectives();
 
     // Setting initial values
     fitness_ = 0.0;
@@ -125,24 +123,21 @@ Solution::Solution (Problem * problem, Variable ** variables)
  */
 Solution::Solution (Solution *solution)
 {
+    JMETAL_COUNT_ALLOCATION();
+
     problem_ = solution->problem_;
     type_ = solution->type_;
     numberOfObjectives_ = solution->getNumberOfObjectives();
     numberOfVariables_ = solution->getNumberOfVariables();
 
     // creating the objective vector
-    objective_ = snew double[numberOfObjectives_];
-    if (objective_ == nullptr)
-    {
-        std::cout << "ERROR GRAVE: Impossible to reserve memory for storing objectives in class Solution" << std::endl;
-        exit(-1);
-    }
+    allocateObjectives();
     for (int i = 0; i< numberOfObjectives_; i++)
     {
         objective_[i] = solution->objective_[i];
     }
 
-    variable_ = type_->copyVariables(solution->variable_) ;
+    copyVariables(solution->variable_);
     overallConstraintViolation_ = solution->getOverallConstraintViolation();
     numberOfViolatedConstraints_ = solution->getNumberOfViolatedConstraints();
     distanceToSolutionSet_ = solution->getDistanceToSolutionSet();
@@ -170,7 +165,15 @@ Solution::Solution (Solution *solution)
  */
 Solution::~Solution()
 {
-    delete[]objective_ ;
+    if (objective_ != inlineObjective_)
+    {
+        delete[]objective_ ;
+    }
+    if (packedVariables_)
+    {
+        type_->deletePackedVariables(variable_);
+        return;
+    }
     if (variable_ != nullptr)
         for (int i = 0; i < numberOfVariables_; i++)
             delete variable_[i] ;
@@ -178,6 +181,69 @@ Solution::~Solution()
 } // ~Solution
 
 
+/**
+ * Points objective_ to the inline storage, or allocates it if there are more
+ * than INLINE_OBJECTIVES objectives
+ */
+void Solution::allocateObjectives()
+{
+    if (numberOfObjectives_ <= INLINE_OBJECTIVES)
+    {
+        objective_ = inlineObjective_;
+        return;
+    }
+    objective_ = snew double[numberOfObjectives_];
+    if (objective_ == nullptr)
+    {
+        std::cout << "ERROR GRAVE: Impossible to reserve memory for storing objectives in class Solution" << std::endl;
+        exit(-1);
+    }
+} // allocateObjectives
+
+
+/**
+ * Creates the decision variables, packed if the solution type supports it
+ */
+void Solution::createVariables()
+{
+    size_t packedSize = type_->getPackedSize();
+    packedVariables_ = (packedSize > 0);
+    if (packedVariables_)
+    {
+        variable_ = type_->createPackedVariables(snew char[packedSize]);
+    }
+    else
+    {
+        variable_ = type_->createVariables();
+    }
+} // createVariables
+
+
+/**
+ * Copies the decision variables of another solution of the same type,
+ * packed if the solution type supports it
+ */
+void Solution::copyVariables(Variable ** variables)
+{
+    if (variables == nullptr)
+    {
+        variable_ = nullptr;
+        packedVariables_ = false;
+        return;
+    }
+    size_t packedSize = type_->getPackedSize();
+    packedVariables_ = (packedSize > 0);
+    if (packedVariables_)
+    {
+        variable_ = type_->copyPackedVariables(variables, snew char[packedSize]);
+    }
+    else
+    {
+        variable_ = type_->copyVariables(variables);
+    }
+} // copyVariables
+
+
 /**
  * Sets the distance between this solution and a <code>SolutionSet</code>.
  * The value is stored in <code>distanceToSolutionSet_</code>.
@@ -306,6 +372,15 @@ double Solution::getObjective(int i)
 } // getObjective
 
 
+/**
+ * Returns the objective values, stored contiguously.
+ */
+double * Solution::getObjectives()
+{
+    return objective_;
+} // getObjectives
+
+
 /**
  * Returns the number of objectives.
  * @return The number of objectives.
@@ -374,6 +449,7 @@ Variable ** Solution::getDecisionVariables()
 void Solution::setDecisionVariables(Variable **variables)
 {
     variable_ = variables ;
+    packedVariables_ = false;
 } // setDecisionVariables
 
 
@@ -42,16 +42,26 @@ class SolutionType ;
 /**
  * @class Solution
  * @brief Class representing a solution for a problem
+ *
+ * Up to INLINE_OBJECTIVES objective values are stored inside the object.
+ * When the solution type supports it (e.g. RealSolutionType), the decision
+ * variables are packed: the array returned by getDecisionVariables() and the
+ * variables it points to are a single allocation. The variables of a packed
+ * solution must not be deleted or replaced individually.
 **/
 class Solution
 {
 
 private:
+    static const int INLINE_OBJECTIVES = 4;
+
     Problem * problem_;
     SolutionType * type_;
     Variable ** variable_;
+    bool packedVariables_ = false;
     int numberOfVariables_ = 0;
     double *objective_;
+    double inlineObjective_[INLINE_OBJECTIVES];
     int numberOfObjectives_ = 0;
     double fitness_ = 0.0;
     bool marked_ = false;
@@ -63,6 +73,10 @@ private:
     double crowdingDistance_ = 0.0;
     double distanceToSolutionSet_ = 0.0;
 
+    void allocateObjectives();
+    void createVariables();
+    void copyVariables(Variable ** variables);
+
 public:
     Solution ();
     Solution (int numberOfObjectives);
@@ -70,6 +84,8 @@ public:
     //getNewsolution (Problem *problem);
     Solution(Problem * problem, Variable ** variables);
     Solution (Solution * solution);
+    Solution (const Solution &) = delete;
+    Solution & operator= (const Solution &) = delete;
 
     ~Solution();
 
@@ -83,6 +99,7 @@ public:
     double getFitness();
     void setObjective(int i, double value);
     double getObjective(int i);
+    double * getObjectives();
     int getNumberOfObjectives();
     int getNumberOfVariables();
     std::string toString();
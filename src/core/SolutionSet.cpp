@@ -22,6 +22,7 @@
 
 
 #include <SolutionSet.h>
+#include <SolutionOrder.h>
 
 
 /**
@@ -44,6 +45,18 @@ SolutionSet::SolutionSet (int maximumSize)
 } // SolutionSet
 
 
+/**
+ * Move constructor. Takes the solutions of another set, which is left empty.
+ * @param another The solution set to move
+ */
+SolutionSet::SolutionSet (SolutionSet && another)
+    : solutionsList_(std::move(another.solutionsList_))
+{
+    capacity_ = another.capacity_;
+    another.solutionsList_.clear();
+} // SolutionSet
+
+
 /**
  * Destructor
  */
@@ -74,6 +87,86 @@ bool SolutionSet::add(Solution * solution)
 } // add
 
 
+/**
+ * Move assignment. Deletes the solutions of this set and takes those of
+ * another one, which is left empty.
+ * @param another The solution set to move
+ */
+SolutionSet & SolutionSet::operator= (SolutionSet && another)
+{
+    if (this != &another)
+    {
+        for (int i = 0; i < solutionsList_.size(); i++)
+        {
+            delete solutionsList_[i];
+        }
+        solutionsList_ = std::move(another.solutionsList_);
+        another.solutionsList_.clear();
+        capacity_ = another.capacity_;
+    }
+    return *this;
+} // operator=
+
+
+/**
+ * Inserts a new solution into the SolutionSet, taking its ownership.
+ * @param solution The <code>Solution</code> to store
+ * @return True If the <code>Solution</code> has been inserted, false
+ * otherwise.
+ */
+bool SolutionSet::add(std::unique_ptr<Solution> solution)
+{
+    return add(solution.release());
+} // add
+
+
+/**
+ * Removes the solution at a position without deleting it, and transfers its
+ * ownership to the caller.
+ * @param index The position of the solution
+ * @return The solution
+ */
+std::unique_ptr<Solution> SolutionSet::release(int index)
+{
+    Solution * solution = get(index);
+    solutionsList_.erase(solutionsList_.begin() + index);
+    return std::unique_ptr<Solution>(solution);
+} // release
+
+
+/**
+ * Moves all the solutions of another set to the end of this one. The other
+ * set is left empty.
+ * @param another The solution set whose solutions are moved
+ */
+void SolutionSet::moveFrom(SolutionSet * another)
+{
+    moveFrom(another, another->size());
+} // moveFrom
+
+
+/**
+ * Moves the first solutions of another set to the end of this one, in the
+ * same order. They are removed from the other set.
+ * @param another The solution set whose solutions are moved
+ * @param count The number of solutions to move
+ */
+void SolutionSet::moveFrom(SolutionSet * another, int count)
+{
+    if (count < 0 || count > another->size())
+    {
+        std::cout << "Error in class SolutionSet trying to move more solutions than available" << std::endl;
+        exit(-1);
+    }
+    for (int i = 0; i < count; i++)
+    {
+        add(another->solutionsList_[i]);
+    }
+    another->solutionsList_.erase(another->solutionsList_.begin(),
+                                  another->solutionsList_.begin() + count);
+} // moveFrom
+
+
 /**
  * Inserts a new solution into the SolutionSet in a specific position.
  * @param index The position where to store the solution
@@ -115,7 +208,8 @@ int SolutionSet::getMaxSize()
 
 
 /**
- * Sorts a SolutionSet using a <code>Comparator</code>.
+ * Sorts a SolutionSet using a <code>Comparator</code>. The sort is stable and
+ * takes O(n log n) comparisons.
  * @param comparator <code>Comparator</code> used to sort.
  */
 void SolutionSet::sort(Comparator * comparator)
@@ -125,18 +219,7 @@ void SolutionSet::sort(Comparator * comparator)
         std::cout << "Error. No criterium for compare exist" << std::endl;
         exit(-1);
     } // if
-    for (int i = 0; i < solutionsList_.size(); i++)
-    {
-        for (int j = i+1; j < solutionsList_.size(); j++)
-        {
-            if ((comparator->compare(solutionsList_[i],solutionsList_[j]))==1)
-            {
-                Solution *tmp = solutionsList_[i];
-                solutionsList_[i] = solutionsList_[j];
-                solutionsList_[j] = tmp;
-            }
-        }
-    } // At this point the solution set will be sorted
+    sortBy(ComparatorOrder(comparator));
 } // sort
 
 
@@ -395,6 +478,23 @@ SolutionSet * SolutionSet::join(SolutionSet *another)
 } // join
 
 
+/**
+ * Returns a new <code>SolutionSet</code> which is the result of the union
+ * between the current solution set and the one passed as a parameter. The
+ * solutions are moved instead of copied, so both sets are left empty.
+ * @param solutionSet SolutionSet to join with the current solutionSet.
+ * @return The result of the union operation.
+ */
+SolutionSet * SolutionSet::joinByMove(SolutionSet *another)
+{
+    SolutionSet *result =
+        new SolutionSet(solutionsList_.size()+another->size());
+    result->moveFrom(this);
+    result->moveFrom(another);
+    return result;
+} // joinByMove
+
+
 /**
  * Replaces a solution by a new one
  * @param position The position of the solution to replace
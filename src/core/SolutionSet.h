@@ -30,6 +30,8 @@
 #include <iomanip>
 #include <fstream>
 #include <vector>
+#include <algorithm>
+#include <memory>
 #include <stddef.h>
 #include <Solution.h>
 #include <Comparator.h>
@@ -42,6 +44,11 @@ class Comparator;
 /**
  * @class SolutionSet
  * @brief This class is aimed at representing a solution set
+ *
+ * A solution set owns its solutions and deletes them when it is destroyed.
+ * The ownership can be transferred without copying the solutions: release
+ * and add(std::unique_ptr) hand over a single solution, and moveFrom and
+ * joinByMove hand over whole sets.
 **/
 class SolutionSet
 {
@@ -54,13 +61,23 @@ public:
 
     SolutionSet();
     SolutionSet(int maximumSize);
+    SolutionSet(const SolutionSet &) = delete;
+    SolutionSet(SolutionSet && another);
     ~SolutionSet();
 
+    SolutionSet & operator= (const SolutionSet &) = delete;
+    SolutionSet & operator= (SolutionSet && another);
+
     bool add(Solution * solution);
+    bool add(std::unique_ptr<Solution> solution);
+    std::unique_ptr<Solution> release(int index);
+    void moveFrom(SolutionSet * another);
+    void moveFrom(SolutionSet * another, int count);
     bool add(int index, Solution * solution);
     Solution *get(int index);
     int getMaxSize();
     void sort(Comparator * comparator);
+    template <class Order> void sortBy(Order order);
     int indexBest(Comparator * comparator);
     Solution * best(Comparator * comparator);
     int indexWorst(Comparator * comparator);
@@ -75,6 +92,7 @@ public:
     void remove(int i);
     void remove(int i, bool del);
     SolutionSet * join(SolutionSet * another);
+    SolutionSet * joinByMove(SolutionSet * another);
     void replace(int position, Solution * solution);
     void replace(int position, Solution * solution, bool del);
     std::vector <VectorOfDouble > writeObjectivesToMatrix();
@@ -85,4 +103,16 @@ public:
 };
 
 
+/**
+ * Sorts a SolutionSet using a typed "less than" predicate (see
+ * SolutionOrder.h). The sort is stable and takes O(n log n) comparisons.
+ * @param order Predicate returning true if its first solution goes first.
+ */
+template <class Order>
+void SolutionSet::sortBy(Order order)
+{
+    std::stable_sort(solutionsList_.begin(), solutionsList_.end(), order);
+} // sortBy
+
+
 #endif
@@ -63,3 +63,56 @@ Variable ** SolutionType::copyVariables(Variable **vars)
 
     return variables;
 } // copyVariables
+
+
+/**
+ * Returns the size in bytes of a packed set of variables, that is, the
+ * array of variables and the variables themselves stored in a single block.
+ * Solution uses packed variables when the size is greater than 0, which is
+ * only the case of the types that override the packed methods
+**/
+size_t SolutionType::getPackedSize()
+{
+    return 0;
+} // getPackedSize
+
+
+/**
+ * Creates the variables in a block of getPackedSize() bytes
+ * @param block The block
+ * @return The array of variables, placed at the beginning of the block
+**/
+Variable ** SolutionType::createPackedVariables(char *block)
+{
+    std::cout << "SolutionType::createPackedVariables: packed variables are not supported by this type" << std::endl;
+    exit(-1);
+} // createPackedVariables
+
+
+/**
+ * Copies the variables into a block of getPackedSize() bytes
+ * @param vars The variables to copy
+ * @param block The block
+ * @return The array of variables, placed at the beginning of the block
+**/
+Variable ** SolutionType::copyPackedVariables(Variable **vars, char *block)
+{
+    std::cout << "SolutionType::copyPackedVariables: packed variables are not supported by this type" << std::endl;
+    exit(-1);
+} // copyPackedVariables
+
+
+/**
+ * Destroys the variables of a block and frees it
+ * @param vars The array of variables returned by createPackedVariables or
+ * copyPackedVariables
+**/
+void SolutionType::deletePackedVariables(Variable **vars)
+{
+    int numberOfVar = problem_->getNumberOfVariables();
+    for (int var = 0; var < numberOfVar; var++)
+    {
+        vars[var]->~Variable();
+    }
+    delete [] reinterpret_cast<char *>(vars);
+} // deletePackedVariables
@@ -49,6 +49,11 @@ public:
     virtual Variable **createVariables() = 0;
     Variable **copyVariables(Variable **vars);
 
+    virtual size_t getPackedSize();
+    virtual Variable **createPackedVariables(char *block);
+    virtual Variable **copyPackedVariables(Variable **vars, char *block);
+    void deletePackedVariables(Variable **vars);
+
 }; // SolutionType
 
 #endif
@@ -22,6 +22,7 @@
 
 
 #include <Variable.h>
+#include <Hash.h>
 #include <cstddef>
 
 
@@ -129,3 +130,27 @@ std::string Variable::getVariableType()
 {
     return typeid(this).name() ;
 } // getVariableType
+
+
+/**
+ * Returns a hash of the value of the variable, used to detect duplicated
+ * solutions (see <code>Hash</code>). Variables not represented by a single
+ * value must redefine it.
+ * @return The hash
+ */
+unsigned long long Variable::hashCode()
+{
+    return Hash::value(getValue());
+} // hashCode
+
+
+/**
+ * Checks whether two variables hold the same value. Variables not
+ * represented by a single value must redefine it.
+ * @param other The variable to compare
+ * @return true if both variables are equal
+ */
+bool Variable::equals(Variable * other)
+{
+    return getValue() == other->getValue();
+} // equals
@@ -49,6 +49,8 @@ public:
     //void setVariableType(VariableType_ variableType);
     string getVariableType();
     virtual string toString() = 0;
+    virtual unsigned long long hashCode();
+    virtual bool equals(Variable * other);
 
 }; // Variable
 
@@ -22,6 +22,11 @@
 
 #include <RealSolutionType.h>
 #include <cstddef>
+#include <new>
+
+
+static_assert(alignof(Real) <= sizeof(Variable *),
+              "the Real objects of a packed block must follow the pointers");
 
 
 /**
@@ -54,3 +59,52 @@ Variable **RealSolutionType::createVariables()
 
     return variables;
 } // createVariables
+
+
+/**
+ * Returns the size in bytes of the packed variables: the array of pointers
+ * followed by the Real objects
+ */
+size_t RealSolutionType::getPackedSize()
+{
+    return problem_->getNumberOfVariables() * (sizeof(Variable *) + sizeof(Real));
+} // getPackedSize
+
+
+/**
+ * Creates the variables of the solution in a block of getPackedSize() bytes
+ * @param block The block
+ */
+Variable **RealSolutionType::createPackedVariables(char *block)
+{
+    int numberOfVariables = problem_->getNumberOfVariables();
+    Variable **variables = reinterpret_cast<Variable **>(block);
+    Real *reals = reinterpret_cast<Real *>(block + numberOfVariables * sizeof(Variable *));
+
+    for (int i = 0; i < numberOfVariables; i++)
+    {
+        variables[i] = new (reals + i) Real(problem_->getLowerLimit(i),problem_->getUpperLimit(i));
+    }
+
+    return variables;
+} // createPackedVariables
+
+
+/**
+ * Copies the variables of a solution into a block of getPackedSize() bytes
+ * @param vars The variables to copy
+ * @param block The block
+ */
+Variable **RealSolutionType::copyPackedVariables(Variable **vars, char *block)
+{
+    int numberOfVariables = problem_->getNumberOfVariables();
+    Variable **variables = reinterpret_cast<Variable **>(block);
+    Real *reals = reinterpret_cast<Real *>(block + numberOfVariables * sizeof(Variable *));
+
+    for (int i = 0; i < numberOfVariables; i++)
+    {
+        variables[i] = new (reals + i) Real(vars[i]);
+    }
+
+    return variables;
+} // copyPackedVariables
@@ -27,7 +27,9 @@
 #include <string>
 
 /**
- * This class is aimed at defining a Type encoding a Real solution
+ * This class is aimed at defining a Type encoding a Real solution. The
+ * variables support the packed layout: the array of pointers is followed by
+ * the Real objects, all of them in the same block.
 **/
 class RealSolutionType : public SolutionType
 {
@@ -36,6 +38,10 @@ public:
     RealSolutionType(Problem *problem);
     Variable **createVariables();
 
+    size_t getPackedSize();
+    Variable **createPackedVariables(char *block);
+    Variable **copyPackedVariables(Variable **vars, char *block);
+
 };
 
 #endif
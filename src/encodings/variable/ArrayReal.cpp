@@ -21,6 +21,7 @@
 
 
 #include <ArrayReal.h>
+#include <Hash.h>
 
 
 /**
@@ -124,6 +125,44 @@ double ArrayReal::getValue()
 } // getValue
 
 
+/**
+ * Returns a hash of the values of the array
+ * @return The hash
+ */
+unsigned long long ArrayReal::hashCode()
+{
+    unsigned long long hash = 0;
+    for (int i = 0; i < size_; i++)
+    {
+        hash = Hash::combine(hash, Hash::value(array_[i]));
+    }
+    return hash;
+} // hashCode
+
+
+/**
+ * Checks whether two arrays hold the same values
+ * @param other The array to compare
+ * @return true if both arrays are equal
+ */
+bool ArrayReal::equals(Variable * other)
+{
+    ArrayReal * array = (ArrayReal *) other;
+    if (size_ != array->size_)
+    {
+        return false;
+    }
+    for (int i = 0; i < size_; i++)
+    {
+        if (array_[i] != array->array_[i])
+        {
+            return false;
+        }
+    }
+    return true;
+} // equals
+
+
 /**
  * setValue
  * @param index Index of value to be returned
@@ -51,6 +51,8 @@ public:
     double getLowerBound(int index);
     double getUpperBound(int index);
     std::string toString();
+    unsigned long long hashCode();
+    bool equals(Variable * other);
 
     void setValue(double value);
     double getValue();
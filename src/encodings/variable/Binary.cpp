@@ -21,6 +21,7 @@
 
 
 #include <Binary.h>
+#include <Hash.h>
 
 
 /**
@@ -48,6 +49,7 @@ Binary::Binary(int numberOfBits)
         if (PseudoRandom::randDouble() < 0.5)
         {
             (*bits_)[i] = true ;
+            hash_ ^= key(i) ;
         }
         else
         {
@@ -69,6 +71,7 @@ Binary::Binary(Binary * variable)
     {
         (*bits_)[i] = (*variable->bits_)[i] ;
     }
+    hash_ = variable->hash_;
 } //Binary
 
 
@@ -132,6 +135,7 @@ bool Binary::getIth(int bit)
 void Binary::flip(int bit)
 {
     (*bits_)[bit].flip();
+    hash_ ^= key(bit);
 } //blip
 
 /**
@@ -140,7 +144,11 @@ void Binary::flip(int bit)
  */
 void Binary::setIth(int bit, bool value)
 {
-    (*bits_)[bit] = value ;
+    if ((*bits_)[bit] != value)
+    {
+        (*bits_)[bit] = value ;
+        hash_ ^= key(bit);
+    }
 } //getNumberOfBits
 
 
@@ -165,6 +173,41 @@ int Binary::hammingDistance(Binary * other)
 } // hammingDistance
 
 
+/**
+ * Checks whether two binary strings are equal. The hashes are compared
+ * first, so different strings are usually told apart in constant time.
+ * @param other The binary string to compare
+ * @return true if both strings have the same bits
+ */
+bool Binary::equals(Variable * other)
+{
+    Binary * binary = (Binary *) other;
+    return (hash_ == binary->hash_) && (*bits_ == *binary->bits_);
+} // equals
+
+
+/**
+ * Returns the hash of the bit string. It is maintained as the bits are
+ * modified, so this takes constant time.
+ * @return The hash
+ */
+unsigned long long Binary::hashCode()
+{
+    return hash_;
+} // hashCode
+
+
+/**
+ * Returns the Zobrist key of a bit position
+ * @param bit The position
+ * @return The key
+ */
+unsigned long long Binary::key(int bit)
+{
+    return Hash::mix(bit);
+} // key
+
+
 /**
  * Returns a std::string representing the object.
  * @return the string.
@@ -53,6 +53,8 @@ public:
     void setIth(int bit, bool value);
     void flip(int bit) ;
     int hammingDistance(Binary * other);
+    bool equals(Variable * other);
+    unsigned long long hashCode();
     std::string toString();
     int cardinality() ;
 
@@ -64,6 +66,14 @@ public:
 protected:
     VectorOfBoolean * bits_ = nullptr;
     int numberOfBits_;
+
+    /**
+     * Zobrist hash of the bit string: the exclusive or of the keys of the
+     * bits set to 1. It is updated every time a bit changes.
+     */
+    unsigned long long hash_ = 0;
+
+    static unsigned long long key(int bit);
 };
 
 #endif
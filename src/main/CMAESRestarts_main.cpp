@@ -0,0 +1,103 @@
+//  CMAESRestarts_main.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Problem.h>
+#include <Algorithm.h>
+#include <Solution.h>
+#include <ProblemFactory.h>
+#include <iostream>
+#include <CMAES.h>
+#include <ParallelRestarts.h>
+#include <time.h>
+#include <chrono>
+
+/**
+ * Runs BIPOP-style restarts of CMAES in parallel
+ */
+int main(int argc, char ** argv)
+{
+
+    Problem   * problem   ; // The problem to solve
+    Algorithm * algorithm ; // The algorithm to use
+
+    if (argc>=2)
+    {
+        problem = ProblemFactory::getProblem(argc, argv);
+        cout << "Selected problem: " << problem->getName() << endl;
+    }
+    else
+    {
+        cout << "No problem selected." << endl;
+        cout << "Default problem will be used: Rastrigin" << endl;
+        problem = ProblemFactory::getProblem(const_cast<char *>("Rastrigin"));
+    }
+
+    // Parameters of each restart
+    int populationSizeValue = 20;
+    JMetal::VectorOfInteger populationSizes(10);
+
+    // Each restart solves its own instance of the problem
+    ParallelRestarts::AlgorithmFactory factory = [&](int restart)
+    {
+        Problem * instance;
+        if (argc>=2)
+        {
+            instance = ProblemFactory::getProblem(argc, argv);
+        }
+        else
+        {
+            instance = ProblemFactory::getProblem(const_cast<char *>("Rastrigin"));
+        }
+        populationSizes[restart] =
+            ParallelRestarts::bipopPopulationSize(populationSizeValue, restart);
+
+        Algorithm * cmaes = new CMAES(instance);
+        cmaes->setInputParameter("populationSize", &populationSizes[restart]);
+        return cmaes;
+    };
+
+    algorithm = new ParallelRestarts(problem, factory);
+
+    // Algorithm parameters
+    int maxEvaluationsValue = 500000;
+    int numberOfRestartsValue = 10;
+    int numberOfThreadsValue = 4;
+    algorithm->setInputParameter("maxEvaluations",&maxEvaluationsValue);
+    algorithm->setInputParameter("numberOfRestarts",&numberOfRestartsValue);
+    algorithm->setInputParameter("numberOfThreads",&numberOfThreadsValue);
+
+    // Execute the Algorithm
+    auto t_ini = std::chrono::steady_clock::now();
+    SolutionSet * population = algorithm->execute();
+    auto t_fin = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(t_fin - t_ini).count();
+
+    // Result messages
+    cout << "Total execution time: " << secs << "s" << endl;
+    cout << "Restarts: " << *(int *) algorithm->getOutputParameter("restarts") << endl;
+    cout << "Variables values have been written to file VAR" << endl;
+    population->printVariablesToFile("VAR");
+    cout << "Objectives values have been written to file FUN" << endl;
+    population->printObjectivesToFile("FUN");
+
+    delete population;
+    delete algorithm;
+
+} // main
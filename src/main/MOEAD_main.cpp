@@ -28,6 +28,7 @@
 #include <PolynomialMutation.h>
 #include <DifferentialEvolutionCrossover.h>
 #include <iostream>
+#include <fstream>
 #include <time.h>
 
 /**
@@ -119,6 +120,16 @@ int main(int argc, char ** argv)
     cout << "Objectives values have been written to file FUN" << endl;
     population->printObjectivesToFile("FUN");
 
+    // Counters collected when compiled with JMETAL_INSTRUMENTATION
+    std::string * instrumentation =
+        (std::string *) algorithm->getOutputParameter("instrumentationJSON");
+    if (instrumentation != nullptr)
+    {
+        cout << "Instrumentation counters have been written to file INSTRUMENTATION" << endl;
+        std::ofstream out("INSTRUMENTATION");
+        out << *instrumentation << endl;
+    }
+
     delete mutation;
     delete crossover;
     delete population;
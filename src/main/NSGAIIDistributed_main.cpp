@@ -0,0 +1,121 @@
+//  NSGAIIDistributed_main.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Problem.h>
+#include <Solution.h>
+#include <SBXCrossover.h>
+#include <PolynomialMutation.h>
+#include <BinaryTournament2.h>
+#include <iostream>
+#include <NSGAII.h>
+#include <DistributedProblem.h>
+#include <ProblemFactory.h>
+#include <chrono>
+
+
+/**
+ * Runs NSGA-II evaluating the solutions in several worker processes
+ */
+int main(int argc, char ** argv)
+{
+
+    Problem   * problem   ; // The problem to solve
+    Problem   * workers   ; // The problem evaluated by the worker processes
+    Algorithm * algorithm ; // The algorithm to use
+    Operator  * crossover ; // Crossover operator
+    Operator  * mutation  ; // Mutation operator
+    Operator  * selection ; // Selection operator
+
+    if (argc>=2)
+    {
+        problem = ProblemFactory::getProblem(argc, argv);
+        cout << "Selected problem: " << problem->getName() << endl;
+    }
+    else
+    {
+        cout << "No problem selected." << endl;
+        cout << "Default problem will be used: ZDT1" << endl;
+        problem = ProblemFactory::getProblem(const_cast<char *>("ZDT1"));
+    }
+
+    // The workers are started before any thread, and are given one second
+    // to evaluate each chunk of solutions. They take the solutions from
+    // shared memory (DistributedProblem::SOCKETS sends them instead)
+    int numberOfWorkers = 4;
+    int timeout = 1000;
+    int maxRetries = 3;
+    workers = new DistributedProblem(problem, numberOfWorkers, timeout,
+                                     maxRetries, DistributedProblem::SHARED_MEMORY);
+
+    algorithm = new NSGAII(workers);
+
+    // Algorithm parameters
+    int populationSize = 100;
+    int maxEvaluations = 25000;
+    algorithm->setInputParameter("populationSize",&populationSize);
+    algorithm->setInputParameter("maxEvaluations",&maxEvaluations);
+
+    // Mutation and Crossover for Real codification
+    map<string, void *> parameters;
+
+    double crossoverProbability = 0.9;
+    double crossoverDistributionIndex = 20.0;
+    parameters["probability"] =  &crossoverProbability;
+    parameters["distributionIndex"] = &crossoverDistributionIndex;
+    crossover = new SBXCrossover(parameters);
+
+    parameters.clear();
+    double mutationProbability = 1.0/problem->getNumberOfVariables();
+    double mutationDistributionIndex = 20.0;
+    parameters["probability"] = &mutationProbability;
+    parameters["distributionIndex"] = &mutationDistributionIndex;
+    mutation = new PolynomialMutation(parameters);
+
+    // Selection Operator
+    parameters.clear();
+    selection = new BinaryTournament2(parameters);
+
+    // Add the operators to the algorithm
+    algorithm->addOperator("crossover",crossover);
+    algorithm->addOperator("mutation",mutation);
+    algorithm->addOperator("selection",selection);
+
+    // Execute the Algorithm
+    auto t_ini = std::chrono::steady_clock::now();
+    SolutionSet * population = algorithm->execute();
+    auto t_fin = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(t_fin - t_ini).count();
+
+    // Result messages
+    cout << "Total execution time: " << secs << "s" << endl;
+    cout << "Restarted workers: " << ((DistributedProblem *) workers)->getRestarts() << endl;
+    cout << "Variables values have been written to file VAR" << endl;
+    population->printVariablesToFile("VAR");
+    cout << "Objectives values have been written to file FUN" << endl;
+    population->printObjectivesToFile("FUN");
+
+    delete selection;
+    delete mutation;
+    delete crossover;
+    delete population;
+    delete algorithm; // Deletes the workers
+    delete problem;
+
+} // main
@@ -0,0 +1,140 @@
+//  NSGAIIIslands_main.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Problem.h>
+#include <Algorithm.h>
+#include <Solution.h>
+#include <SBXCrossover.h>
+#include <PolynomialMutation.h>
+#include <BinaryTournament2.h>
+#include <ProblemFactory.h>
+#include <iostream>
+#include <NSGAII.h>
+#include <IslandModel.h>
+#include <time.h>
+#include <chrono>
+#include <mutex>
+
+/**
+ * Runs NSGA-II on several islands connected in a ring
+ */
+int main(int argc, char ** argv)
+{
+
+    Problem   * problem   ; // The problem to solve
+    Algorithm * algorithm ; // The algorithm to use
+
+    if (argc>=2)
+    {
+        problem = ProblemFactory::getProblem(argc, argv);
+        cout << "Selected problem: " << problem->getName() << endl;
+    }
+    else
+    {
+        cout << "No problem selected." << endl;
+        cout << "Default problem will be used: ZDT1" << endl;
+        problem = ProblemFactory::getProblem(const_cast<char *>("ZDT1"));
+    }
+
+    // Parameters of each island
+    int numberOfIslandsValue = 4;
+    int populationSizeValue = 100;
+    int maxEvaluationsValue = 25000;
+    double crossoverProbability = 0.9;
+    double crossoverDistributionIndex = 20.0;
+    double mutationProbability = 1.0/problem->getNumberOfVariables();
+    double mutationDistributionIndex = 20.0;
+    std::vector<Operator *> operators;
+    std::mutex operatorsMutex;
+
+    // Each island solves its own instance of the problem
+    IslandModel::AlgorithmFactory factory = [&](int island)
+    {
+        Problem * instance;
+        if (argc>=2)
+        {
+            instance = ProblemFactory::getProblem(argc, argv);
+        }
+        else
+        {
+            instance = ProblemFactory::getProblem(const_cast<char *>("ZDT1"));
+        }
+
+        Algorithm * nsgaII = new NSGAII(instance);
+        nsgaII->setInputParameter("populationSize",&populationSizeValue);
+        nsgaII->setInputParameter("maxEvaluations",&maxEvaluationsValue);
+
+        map<string, void *> parameters;
+        parameters["probability"] =  &crossoverProbability;
+        parameters["distributionIndex"] = &crossoverDistributionIndex;
+        Operator * crossover = new SBXCrossover(parameters);
+
+        parameters.clear();
+        parameters["probability"] = &mutationProbability;
+        parameters["distributionIndex"] = &mutationDistributionIndex;
+        Operator * mutation = new PolynomialMutation(parameters);
+
+        parameters.clear();
+        Operator * selection = new BinaryTournament2(parameters);
+
+        nsgaII->addOperator("crossover",crossover);
+        nsgaII->addOperator("mutation",mutation);
+        nsgaII->addOperator("selection",selection);
+
+        std::unique_lock<std::mutex> lock(operatorsMutex);
+        operators.push_back(crossover);
+        operators.push_back(mutation);
+        operators.push_back(selection);
+        return nsgaII;
+    };
+
+    algorithm = new IslandModel(problem, factory);
+
+    // Algorithm parameters
+    int migrationIntervalValue = 1000;
+    int numberOfMigrantsValue = 2;
+    std::string topologyValue = "ring";
+    algorithm->setInputParameter("numberOfIslands",&numberOfIslandsValue);
+    algorithm->setInputParameter("migrationInterval",&migrationIntervalValue);
+    algorithm->setInputParameter("numberOfMigrants",&numberOfMigrantsValue);
+    algorithm->setInputParameter("topology",&topologyValue);
+
+    // Execute the Algorithm
+    auto t_ini = std::chrono::steady_clock::now();
+    SolutionSet * population = algorithm->execute();
+    auto t_fin = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(t_fin - t_ini).count();
+
+    // Result messages
+    cout << "Total execution time: " << secs << "s" << endl;
+    cout << "Migrants: " << *(int *) algorithm->getOutputParameter("migrants") << endl;
+    cout << "Variables values have been written to file VAR" << endl;
+    population->printVariablesToFile("VAR");
+    cout << "Objectives values have been written to file FUN" << endl;
+    population->printObjectivesToFile("FUN");
+
+    delete population;
+    delete algorithm;
+    for (int i = 0; i < operators.size(); i++)
+    {
+        delete operators[i];
+    }
+
+} // main
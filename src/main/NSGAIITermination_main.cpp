@@ -0,0 +1,135 @@
+//  NSGAIITermination_main.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Problem.h>
+#include <Algorithm.h>
+#include <Solution.h>
+#include <SBXCrossover.h>
+#include <PolynomialMutation.h>
+#include <BinaryTournament2.h>
+#include <ProblemFactory.h>
+#include <iostream>
+#include <NSGAII.h>
+#include <Stagnation.h>
+#include <HypervolumeImprovement.h>
+#include <TimeBudget.h>
+#include <chrono>
+
+/**
+ * Runs NSGA-II until it converges: the run stops when the ideal and nadir
+ * points stop moving, when the hypervolume stops improving, or after one
+ * minute, whatever happens first
+ */
+int main(int argc, char ** argv)
+{
+
+    Problem   * problem   ; // The problem to solve
+    Algorithm * algorithm ; // The algorithm to use
+    Operator  * crossover ; // Crossover operator
+    Operator  * mutation  ; // Mutation operator
+    Operator  * selection ; // Selection operator
+
+    if (argc>=2)
+    {
+        problem = ProblemFactory::getProblem(argc, argv);
+        cout << "Selected problem: " << problem->getName() << endl;
+    }
+    else
+    {
+        cout << "No problem selected." << endl;
+        cout << "Default problem will be used: ZDT1" << endl;
+        problem = ProblemFactory::getProblem(const_cast<char *>("ZDT1"));
+    }
+
+    algorithm = new NSGAII(problem);
+
+    // Algorithm parameters
+    int populationSize = 100;
+    int maxEvaluations = 250000;
+    algorithm->setInputParameter("populationSize",&populationSize);
+    algorithm->setInputParameter("maxEvaluations",&maxEvaluations);
+
+    // Termination criteria. The reference point of the hypervolume suits
+    // problems with objectives in [0, 1], such as ZDT and DTLZ
+    Stagnation stagnation(20, 1.0e-3);
+    std::vector<double> referencePoint(problem->getNumberOfObjectives(), 1.1);
+    HypervolumeImprovement hypervolumeImprovement(referencePoint, 20, 1.0e-4);
+    TimeBudget timeBudget(60.0);
+    algorithm->addTerminationCriterion(&stagnation);
+    algorithm->addTerminationCriterion(&hypervolumeImprovement);
+    algorithm->addTerminationCriterion(&timeBudget);
+
+    // Mutation and Crossover for Real codification
+    map<string, void *> parameters;
+
+    double crossoverProbability = 0.9;
+    double crossoverDistributionIndex = 20.0;
+    parameters["probability"] =  &crossoverProbability;
+    parameters["distributionIndex"] = &crossoverDistributionIndex;
+    crossover = new SBXCrossover(parameters);
+
+    parameters.clear();
+    double mutationProbability = 1.0/problem->getNumberOfVariables();
+    double mutationDistributionIndex = 20.0;
+    parameters["probability"] = &mutationProbability;
+    parameters["distributionIndex"] = &mutationDistributionIndex;
+    mutation = new PolynomialMutation(parameters);
+
+    // Selection Operator
+    parameters.clear();
+    selection = new BinaryTournament2(parameters);
+
+    // Add the operators to the algorithm
+    algorithm->addOperator("crossover",crossover);
+    algorithm->addOperator("mutation",mutation);
+    algorithm->addOperator("selection",selection);
+
+    // Execute the Algorithm
+    auto t_ini = std::chrono::steady_clock::now();
+    SolutionSet * population = algorithm->execute();
+    auto t_fin = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(t_fin - t_ini).count();
+
+    // Result messages
+    cout << "Total execution time: " << secs << "s" << endl;
+    std::string * criterion =
+        (std::string *) algorithm->getOutputParameter("terminationCriterion");
+    if (criterion != nullptr)
+    {
+        cout << "Stopped by: " << *criterion << endl;
+    }
+    else
+    {
+        cout << "Stopped by: maxEvaluations" << endl;
+    }
+    cout << "Hypervolume at the last check: "
+         << hypervolumeImprovement.getLastValue() << endl;
+    cout << "Variables values have been written to file VAR" << endl;
+    population->printVariablesToFile("VAR");
+    cout << "Objectives values have been written to file FUN" << endl;
+    population->printObjectivesToFile("FUN");
+
+    delete selection;
+    delete mutation;
+    delete crossover;
+    delete population;
+    delete algorithm;
+
+} // main
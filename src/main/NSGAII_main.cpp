@@ -26,6 +26,7 @@
 #include <PolynomialMutation.h>
 #include <BinaryTournament2.h>
 #include <iostream>
+#include <fstream>
 #include <NSGAII.h>
 #include <ProblemFactory.h>
 #include <string.h>
@@ -124,6 +125,16 @@ int main(int argc, char ** argv)
     cout << "Objectives values have been written to file FUN" << endl;
     population->printObjectivesToFile("FUN");
 
+    // Counters collected when compiled with JMETAL_INSTRUMENTATION
+    std::string * instrumentation =
+        (std::string *) algorithm->getOutputParameter("instrumentationJSON");
+    if (instrumentation != nullptr)
+    {
+        cout << "Instrumentation counters have been written to file INSTRUMENTATION" << endl;
+        std::ofstream out("INSTRUMENTATION");
+        out << *instrumentation << endl;
+    }
+
 //  if (indicators != NULL) {
 //    cout << "Quality indicators" << endl;
 //    cout << "Hypervolume: " << indicators->getHypervolume(population) << endl;
@@ -44,6 +44,8 @@ GDE3::GDE3(Problem *problem) : Algorithm(problem)
  */
 SolutionSet * GDE3::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     int populationSize;
     int maxIterations;
@@ -61,6 +63,7 @@ SolutionSet * GDE3::execute()
 
     distance  = snew Distance();
     dominance = snew DominanceComparator();
+    CrowdingTruncation truncation(problem_->getNumberOfObjectives());
 
     Solution ** parent;
 
@@ -82,18 +85,27 @@ SolutionSet * GDE3::execute()
     for (int i = 0; i < populationSize; i++)
     {
         newSolution = snew Solution(problem_);
-        problem_->evaluate(newSolution);
-        problem_->evaluateConstraints(newSolution);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(newSolution);
+            problem_->evaluateConstraints(newSolution);
+        }
         evaluations++;
         population->add(newSolution);
     } //for
 
     // Generations ...
-    while (iterations < maxIterations)
+    while ((iterations < maxIterations) && !isTerminated(population, evaluations))
     {
         // Create the offSpring solutionSet
         offspringPopulation  = snew SolutionSet(populationSize * 2);
 
+        // The selection operator reads the whole population, so the parents
+        // that survive are moved once the generation is complete. Their
+        // positions in offspringPopulation are reserved in the meantime
+        std::vector<int> survivors;
+        std::vector<int> positions;
+
         for (int i = 0; i < populationSize; i++)
         {
             // Obtain parents. Two parameters are required: the population and the
@@ -114,8 +126,11 @@ SolutionSet * GDE3::execute()
             delete[] object2;
             delete[] parent;
 
-            problem_->evaluate(child) ;
-            problem_->evaluateConstraints(child);
+            {
+                JMETAL_TIME_EVALUATIONS(1);
+                problem_->evaluate(child) ;
+                problem_->evaluateConstraints(child);
+            }
             evaluations++ ;
 
             // Dominance test
@@ -123,7 +138,9 @@ SolutionSet * GDE3::execute()
             result = dominance->compare(population->get(i), child) ;
             if (result == -1)   // Solution i dominates child
             {
-                offspringPopulation->add(snew Solution(population->get(i)));
+                survivors.push_back(i);
+                positions.push_back(offspringPopulation->size());
+                offspringPopulation->add(nullptr);
                 delete child;
             } // if
             else if (result == 1)   // child dominates
@@ -133,21 +150,33 @@ SolutionSet * GDE3::execute()
             else   // the two solutions are non-dominated
             {
                 offspringPopulation->add(child) ;
-                offspringPopulation->add(snew Solution(population->get(i)));
+                survivors.push_back(i);
+                positions.push_back(offspringPopulation->size());
+                offspringPopulation->add(nullptr);
             } // else
         } // for
 
+        std::vector<bool> survives(populationSize, false);
+        for (int k = 0; k < survivors.size(); k++)
+        {
+            offspringPopulation->replace(positions[k], population->get(survivors[k]));
+            survives[survivors[k]] = true;
+        } // for
+        for (int i = 0; i < populationSize; i++)
+        {
+            if (!survives[i])
+            {
+                delete population->get(i);
+            }
+        } // for
+        population->clear();
+
         // Ranking the offspring population
-        Ranking * ranking = snew Ranking(offspringPopulation);
+        Ranking * ranking = snew Ranking(offspringPopulation, true);
 
         int remain = populationSize;
         int index  = 0;
         SolutionSet * front = nullptr;
-        for (int i = 0; i < populationSize; i++)
-        {
-            delete population->get(i);
-        }
-        population->clear();
 
         // Obtain the next front
         front = ranking->getSubfront(index);
@@ -156,15 +185,12 @@ SolutionSet * GDE3::execute()
         {
             //Assign crowding distance to individuals
             distance->crowdingDistanceAssignment(front,problem_->getNumberOfObjectives());
-            //Add the individuals of this front
-            for (int k = 0; k < front->size(); k++ )
-            {
-                population->add(snew Solution(front->get(k)));
-            } // for
-
             //Decrement remain
             remain = remain - front->size();
 
+            //Add the individuals of this front
+            population->moveFrom(front);
+
             //Obtain the next front
             index++;
             if (remain > 0)
@@ -176,19 +202,8 @@ SolutionSet * GDE3::execute()
         // remain is less than front(index).size, insert only the best one
         if (remain > 0)    // front contains individuals to insert
         {
-            while (front->size() > remain)
-            {
-                distance->crowdingDistanceAssignment(front,problem_->getNumberOfObjectives());
-                Comparator * crowdingComparator = snew CrowdingComparator();
-                int indexWorst = front->indexWorst(crowdingComparator);
-                delete crowdingComparator;
-                delete front->get(indexWorst);
-                front->remove(indexWorst);
-            }
-            for (int k = 0; k < front->size(); k++)
-            {
-                population->add(snew Solution(front->get(k)));
-            }
+            truncation.truncate(front, remain);
+            population->moveFrom(front);
 
             remain = 0;
         } // if
@@ -203,15 +218,14 @@ SolutionSet * GDE3::execute()
     delete distance;
 
     // Return the first non-dominated front
-    Ranking * ranking = snew Ranking(population);
+    Ranking * ranking = snew Ranking(population, true);
     SolutionSet * result = snew SolutionSet(ranking->getSubfront(0)->size());
-    for (int i=0; i<ranking->getSubfront(0)->size(); i++)
-    {
-        result->add(snew Solution(ranking->getSubfront(0)->get(i)));
-    }
+    result->moveFrom(ranking->getSubfront(0));
     delete ranking;
     delete population;
 
+    publishInstrumentation();
+
     return result;
 
 } // execute
@@ -0,0 +1,230 @@
+//  IslandModel.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <IslandModel.h>
+#include <NonDominatedSolutionList.h>
+#include <ctime>
+#include <iostream>
+
+
+/**
+ * Constructor
+ * @param problem Problem to solve. It is only used to describe the problem;
+ * every island works on the instance created by the factory
+ * @param factory Creates the algorithm run by each island
+ */
+IslandModel::IslandModel(Problem * problem, AlgorithmFactory factory)
+    : Algorithm(problem)
+{
+    factory_ = factory;
+    numberOfIslands_ = 0;
+    migrants_ = 0;
+} // IslandModel
+
+
+/**
+ * Destructor. Deletes the islands, which are kept alive because the returned
+ * solutions, and the migrants they exchanged, refer to their problems
+ */
+IslandModel::~IslandModel()
+{
+    deleteIslands();
+} // ~IslandModel
+
+
+SolutionSet * IslandModel::execute()
+{
+    startInstrumentation();
+
+    if (!terminationCriteria_.empty())
+    {
+        std::cout << "IslandModel: termination criteria must be added to the "
+                  << "islands, in the factory" << std::endl;
+        exit(-1);
+    }
+
+    numberOfIslands_ = *(int *) getInputParameter("numberOfIslands");
+    int migrationInterval = *(int *) getInputParameter("migrationInterval");
+
+    int numberOfMigrants = 1;
+    if (getInputParameter("numberOfMigrants") != nullptr)
+    {
+        numberOfMigrants = *(int *) getInputParameter("numberOfMigrants");
+    }
+    std::string topology = "ring";
+    if (getInputParameter("topology") != nullptr)
+    {
+        topology = *(std::string *) getInputParameter("topology");
+    }
+    int queueCapacity = 4 * numberOfMigrants;
+    if (getInputParameter("queueCapacity") != nullptr)
+    {
+        queueCapacity = *(int *) getInputParameter("queueCapacity");
+    }
+    int numberOfThreads = numberOfIslands_;
+    if (getInputParameter("numberOfThreads") != nullptr)
+    {
+        numberOfThreads = *(int *) getInputParameter("numberOfThreads");
+    }
+    seed_ = (unsigned long long) time(nullptr);
+    if (getInputParameter("seed") != nullptr)
+    {
+        seed_ = *(int *) getInputParameter("seed");
+    }
+
+    deleteIslands();
+    islands_.assign(numberOfIslands_, nullptr);
+    results_.assign(numberOfIslands_, nullptr);
+    connect(topology, migrationInterval, numberOfMigrants, queueCapacity);
+
+    ThreadPool pool(numberOfThreads);
+    pool.parallelFor(numberOfIslands_, [this](int island)
+    {
+        runIsland(island);
+    });
+
+    // Merge the results of the islands
+    NonDominatedSolutionList * front = snew NonDominatedSolutionList();
+    migrants_ = 0;
+    for (int i = 0; i < numberOfIslands_; i++)
+    {
+        for (int j = 0; j < results_[i]->size(); j++)
+        {
+            Solution * solution = snew Solution(results_[i]->get(j));
+            if (!front->add(solution))
+            {
+                delete solution;
+            }
+        }
+        delete results_[i];
+        migrants_ += migrations_[i]->getReceived();
+        islands_[i]->setMigration(nullptr);
+    }
+    results_.clear();
+
+    for (int i = 0; i < migrations_.size(); i++)
+    {
+        delete migrations_[i];
+    }
+    migrations_.clear();
+    for (int i = 0; i < queues_.size(); i++)
+    {
+        delete queues_[i];
+    }
+    queues_.clear();
+
+    setOutputParameter("migrants", &migrants_);
+
+    SolutionSet * resultPopulation = snew SolutionSet(front->size());
+    resultPopulation->moveFrom(front);
+    delete front;
+
+    publishInstrumentation();
+
+    return resultPopulation;
+} // execute
+
+
+/**
+ * Creates the end points of the islands and the queues between them
+ * @param topology "ring", "full" or "random"
+ * @param migrationInterval Number of evaluations between two migrations
+ * @param numberOfMigrants Number of solutions sent in each migration
+ * @param queueCapacity Capacity of each queue
+ */
+void IslandModel::connect(std::string topology, int migrationInterval,
+                          int numberOfMigrants, int queueCapacity)
+{
+    bool random = (topology == "random");
+    if ((topology != "ring") && (topology != "full") && !random)
+    {
+        std::cout << "IslandModel: unknown topology " << topology << std::endl;
+        exit(-1);
+    }
+
+    for (int i = 0; i < numberOfIslands_; i++)
+    {
+        migrations_.push_back(snew Migration(migrationInterval, numberOfMigrants, random));
+    }
+    if (numberOfIslands_ < 2)
+    {
+        return;
+    }
+
+    for (int i = 0; i < numberOfIslands_; i++)
+    {
+        if (topology == "ring")
+        {
+            connect(i, (i + 1) % numberOfIslands_, queueCapacity);
+        }
+        else
+        {
+            for (int j = 0; j < numberOfIslands_; j++)
+            {
+                if (j != i)
+                {
+                    connect(i, j, queueCapacity);
+                }
+            }
+        }
+    }
+} // connect
+
+
+/**
+ * Creates a queue from an island to another one
+ */
+void IslandModel::connect(int from, int to, int queueCapacity)
+{
+    MigrationQueue * queue = snew MigrationQueue(queueCapacity);
+    queues_.push_back(queue);
+    migrations_[from]->addOutgoing(queue);
+    migrations_[to]->addIncoming(queue);
+} // connect
+
+
+/**
+ * Runs an island
+ * @param island Index of the island
+ */
+void IslandModel::runIsland(int island)
+{
+    RandomGenerator generator(RandomGenerator::streamSeed(seed_, island));
+    PseudoRandom::setRandomGenerator(&generator);
+
+    islands_[island] = factory_(island);
+    islands_[island]->setMigration(migrations_[island]);
+    results_[island] = islands_[island]->execute();
+
+    PseudoRandom::setRandomGenerator(nullptr);
+} // runIsland
+
+
+/**
+ * Deletes the algorithms of the islands
+ */
+void IslandModel::deleteIslands()
+{
+    for (int i = 0; i < islands_.size(); i++)
+    {
+        delete islands_[i];
+    }
+    islands_.clear();
+} // deleteIslands
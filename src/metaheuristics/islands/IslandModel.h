@@ -0,0 +1,110 @@
+//  IslandModel.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __ISLAND_MODEL__
+#define __ISLAND_MODEL__
+
+#include <Algorithm.h>
+#include <Problem.h>
+#include <SolutionSet.h>
+#include <Migration.h>
+#include <MigrationQueue.h>
+#include <PseudoRandom.h>
+#include <RandomGenerator.h>
+#include <ThreadPool.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * This class implements an island model: several instances of an algorithm
+ * (NSGAII, MOEAD, SMPSO, DE, gGA...) run concurrently, each one on its own
+ * thread and random stream, and periodically exchange some of their
+ * solutions. The result is the set of non-dominated solutions found by all
+ * the islands.
+ *
+ * The islands are created by a factory, which receives the index of the
+ * island and must return a fully configured algorithm (operators,
+ * maxEvaluations...) working on its own Problem instance, because an
+ * Algorithm deletes its problem when it is destroyed. The factory is called
+ * on the thread that runs the island, after its random stream has been
+ * installed.
+ *
+ * Migrants travel through bounded lock-free queues, one per connected pair
+ * of islands. An island never waits for the others: it takes the migrants
+ * that have already arrived, and a migrant is dropped if its destination
+ * queue is full. Therefore, unlike ParallelRestarts, runs with more than one
+ * island are not reproducible even with a fixed seed.
+ *
+ * Input parameters:
+ *  - numberOfIslands (int)
+ *  - migrationInterval (int): number of evaluations of an island between
+ *    two migrations
+ *  - numberOfMigrants (int, optional): solutions sent in each migration. 1
+ *    by default
+ *  - topology (std::string, optional): "ring" (island i sends to island
+ *    i+1), "full" (every island sends to all the others) or "random" (every
+ *    migration goes to another island chosen at random). "ring" by default
+ *  - queueCapacity (int, optional): maximum number of migrants waiting
+ *    between two islands. 4 * numberOfMigrants by default
+ *  - numberOfThreads (int, optional): numberOfIslands by default. With fewer
+ *    threads some islands run after others have finished, and receive no
+ *    migrants from them
+ *  - seed (int, optional): base seed of the random streams of the islands.
+ *    By default it is taken from the clock
+ *
+ * Output parameters: "migrants" (int), the number of migrants received by
+ * the islands.
+ *
+ * Termination criteria keep state, so they cannot be shared by the islands:
+ * each island must get its own ones from the factory.
+ */
+class IslandModel : public Algorithm
+{
+
+public:
+    using AlgorithmFactory = std::function<Algorithm * (int island)>;
+
+private:
+    AlgorithmFactory factory_;
+    int numberOfIslands_;
+    unsigned long long seed_;
+    int migrants_;
+
+    std::vector<Algorithm *> islands_;
+    std::vector<SolutionSet *> results_;
+    std::vector<Migration *> migrations_;
+    std::vector<MigrationQueue *> queues_;
+
+    void connect(std::string topology, int migrationInterval,
+                 int numberOfMigrants, int queueCapacity);
+    void connect(int from, int to, int queueCapacity);
+    void runIsland(int island);
+    void deleteIslands();
+
+public:
+    IslandModel(Problem * problem, AlgorithmFactory factory);
+    ~IslandModel();
+    SolutionSet * execute();
+
+}; // IslandModel
+
+#endif /* __ISLAND_MODEL__ */
@@ -19,6 +19,9 @@
 //  //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 #include <MOCHC.h>
+#include <SolutionOrder.h>
+#include <Hash.h>
+#include <unordered_map>
 
 bool MOCHC::equalsIndividuals(Solution & s1, Solution & s2)
 {
@@ -28,13 +31,9 @@ bool MOCHC::equalsIndividuals(Solution & s1, Solution & s2)
         Binary *b1, *b2;
         b1 = (Binary *)s1.getDecisionVariables()[var];
         b2 = (Binary *)s2.getDecisionVariables()[var];
-        bool found = true;
-        for (int bit = 0; bit < b1->getNumberOfBits(); bit++)
+        if (!b1->equals(b2))
         {
-            if (b1->getIth(bit)!=b2->getIth(bit))
-            {
-                return false;
-            }
+            return false;
         }
     }
 
@@ -52,15 +51,34 @@ bool MOCHC::exist(Solution & s1, SolutionSet & set2)
 }
 
 
+/**
+ * Checks whether two populations contain the same individuals. The members
+ * of set2 are indexed by genome hash, so each member of set1 is only
+ * compared with the members sharing its hash.
+ */
 bool MOCHC::equals(SolutionSet & set1, SolutionSet & set2)
 {
 
     if (set1.size() != set2.size())
         return false;
 
+    std::unordered_multimap<unsigned long long, Solution *> index;
+    index.reserve(set2.size());
+    for (int i = 0; i < set2.size(); i++)
+    {
+        index.insert(std::make_pair(Hash::genome(set2.get(i)), set2.get(i)));
+    }
+
     for (int i = 0; i < set1.size(); i++)
     {
-        if (!exist(*set1.get(i),set2))
+        Solution * solution = set1.get(i);
+        auto range = index.equal_range(Hash::genome(solution));
+        bool found = false;
+        for (auto it = range.first; !found && it != range.second; ++it)
+        {
+            found = equalsIndividuals(*solution, *it->second);
+        }
+        if (!found)
             return false;
     }
     return true;
@@ -81,13 +99,18 @@ int MOCHC::hammingDistance(Solution & sol1, Solution & sol2)
 }
 
 
+/**
+ * Selects the best solutions of a set by ranking and crowding distance. The
+ * solutions are moved: the selected ones to the returned set, and the rest
+ * are deleted, so pop is left empty.
+ */
 SolutionSet *MOCHC::rankingAndCrowdingSelection(SolutionSet * pop, int size)
 {
 
 
     SolutionSet *result = snew SolutionSet(size);
     // Ranking the union
-    Ranking * ranking = snew Ranking(pop);
+    Ranking * ranking = snew Ranking(pop, true);
     Distance * distance = snew Distance();
     int remain = size;
     int index = 0;
@@ -101,15 +124,12 @@ SolutionSet *MOCHC::rankingAndCrowdingSelection(SolutionSet * pop, int size)
         //Assign crowding distance to individuals
         distance->crowdingDistanceAssignment(front, problem_->getNumberOfObjectives());
 
-        //Add the individuals of this front
-        for (int k = 0; k < front->size(); k++)
-        {
-            result->add(snew Solution(front->get(k)));
-        } // for
-
         //Decrement remain
         remain = remain - front->size();
 
+        //Add the individuals of this front
+        result->moveFrom(front);
+
         //Obtain the next front
         index++;
         if (remain > 0)
@@ -123,13 +143,8 @@ SolutionSet *MOCHC::rankingAndCrowdingSelection(SolutionSet * pop, int size)
     if (remain > 0)    // front contains individuals to insert
     {
         distance->crowdingDistanceAssignment(front, problem_->getNumberOfObjectives());
-        Comparator * c = snew CrowdingComparator();
-        front->sort(c);
-        delete c;
-        for (int k = 0; k < remain; k++)
-        {
-            result->add(snew Solution(front->get(k)));
-        } // for
+        front->sortBy(CrowdingOrder());
+        result->moveFrom(front, remain);
 
         remain = 0;
     } // if
@@ -143,6 +158,8 @@ SolutionSet *MOCHC::rankingAndCrowdingSelection(SolutionSet * pop, int size)
 
 SolutionSet *MOCHC::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     int populationSize;
     int iterations;
@@ -202,8 +219,11 @@ SolutionSet *MOCHC::execute()
     for (int i = 0; i < populationSize; i++)
     {
         newSolution = snew Solution(problem_);
-        problem_->evaluate(newSolution);
-        problem_->evaluateConstraints(newSolution);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(newSolution);
+            problem_->evaluateConstraints(newSolution);
+        }
         evaluations++;
         population->add(newSolution);
     } //for
@@ -222,16 +242,26 @@ SolutionSet *MOCHC::execute()
             if (hammingDistance(*parents[0],*parents[1])>= minimumDistance)
             {
                 Solution ** offSpring = (Solution **) (crossover->execute(parents));
-                problem_->evaluate(offSpring[0]);
-                problem_->evaluateConstraints(offSpring[0]);
-                problem_->evaluate(offSpring[1]);
-                problem_->evaluateConstraints(offSpring[1]);
+                {
+                    JMETAL_TIME_EVALUATIONS(2);
+                    problem_->evaluate(offSpring[0]);
+                    problem_->evaluateConstraints(offSpring[0]);
+                    problem_->evaluate(offSpring[1]);
+                    problem_->evaluateConstraints(offSpring[1]);
+                }
                 evaluations+=2;
                 offSpringPopulation->add(offSpring[0]);
                 offSpringPopulation->add(offSpring[1]);
             }
         }
-        SolutionSet *join = population->join(offSpringPopulation);
+        // The population is copied, as it is compared with the new one
+        // below, but the offspring are moved
+        SolutionSet *join = snew SolutionSet(population->size() + offSpringPopulation->size());
+        for (int i = 0; i < population->size(); i++)
+        {
+            join->add(snew Solution(population->get(i)));
+        }
+        join->moveFrom(offSpringPopulation);
         delete offSpringPopulation;
 
         newPopulation = rankingAndCrowdingSelection(join,populationSize);
@@ -246,6 +276,10 @@ SolutionSet *MOCHC::execute()
         {
             minimumDistance = (int) (1.0/size * (1-1.0/size) * size);
             int preserve = (int) std::floor(preservedPopulation*populationSize);
+            for (int i = 0; i < newPopulation->size(); i++)
+            {
+                delete newPopulation->get(i);
+            }
             newPopulation->clear(); //do the new in c++ really hurts me(juanjo)
             population->sort(crowdingComparator);
             for (int i = 0; i < preserve; i++)
@@ -256,8 +290,11 @@ SolutionSet *MOCHC::execute()
             {
                 Solution * solution = snew Solution(population->get(i));
                 cataclysmicMutation->execute(solution);
-                problem_->evaluate(solution);
-                problem_->evaluateConstraints(solution);
+                {
+                    JMETAL_TIME_EVALUATIONS(1);
+                    problem_->evaluate(solution);
+                    problem_->evaluateConstraints(solution);
+                }
                 newPopulation->add(solution);
             }
 
@@ -266,12 +303,14 @@ SolutionSet *MOCHC::execute()
         iterations++;
         delete population;
         population = newPopulation;
-        if (evaluations >= maxEvaluations)
+        if ((evaluations >= maxEvaluations) || isTerminated(population, evaluations))
         {
             condition = true;
         }
     }
 
+    publishInstrumentation();
+
     return population;
 
 }
@@ -40,6 +40,9 @@ MOEAD::MOEAD(Problem *problem) : Algorithm(problem)
 
 SolutionSet * MOEAD::execute()
 {
+    startInstrumentation();
+    startTermination();
+
     int maxEvaluations;
 
     evaluations_ = 0;
@@ -47,6 +50,12 @@ SolutionSet * MOEAD::execute()
     populationSize_ = *(int *) getInputParameter("populationSize");
     dataDirectory_ = * (std::string *) getInputParameter("dataDirectory");
 
+    numberOfThreads_ = 1;
+    if (getInputParameter("numberOfThreads") != nullptr)
+    {
+        numberOfThreads_ = *(int *) getInputParameter("numberOfThreads");
+    }
+
     population_ = snew SolutionSet(populationSize_);
     //indArray_ = new Solution*[problem_->getNumberOfObjectives()];
 
@@ -60,7 +69,7 @@ SolutionSet * MOEAD::execute()
     */
     neighborhood_ = snew int*[populationSize_];
 
-    z_ = snew double[problem_->getNumberOfObjectives()];
+    z_ = snew std::atomic<double>[problem_->getNumberOfObjectives()];
     //lambda_ = new Vector(problem_->getNumberOfObjectives()) ;
     lambda_ = snew double*[populationSize_];
 
@@ -75,79 +84,227 @@ SolutionSet * MOEAD::execute()
 
     initNeighborhood();
 
-    // STEP 1.2. Initialize population
-    initPopulation();
+    Checkpoint snapshot;
+    if (beginResume(snapshot, "MOEAD"))
+    {
+        // Continue from a snapshot of the population and of z_
+        evaluations_ = snapshot.readInt();
+        snapshot.readSolutionSet(population_, problem_);
+        for (int i = 0; i < problem_->getNumberOfObjectives(); i++)
+        {
+            z_[i] = snapshot.readDouble();
+        }
+        endResume(snapshot);
+    }
+    else
+    {
+        // STEP 1.2. Initialize population
+        initPopulation();
 
-    // STEP 1.3. Initialize z_
-    initIdealPoint();
+        // STEP 1.3. Initialize z_
+        initIdealPoint();
+    } // if
 
     // STEP 2. Update
-    do
+    if (numberOfThreads_ > 1)
     {
-        int * permutation = snew int[populationSize_];
-        UtilsMOEAD::randomPermutation(permutation, populationSize_);
-        for (int i = 0; i < populationSize_; i++)
+        initBatches();
+        ThreadPool pool(numberOfThreads_);
+        int numberOfBatches = batches_.size();
+        do
         {
-            int n = permutation[i]; // or int n = i;
-            //int n = i ; // or int n = i;
-            int type;
-            double rnd = PseudoRandom::randDouble();
-
-            // STEP 2.1. Mating selection based on probability
-            if (rnd < delta_) // if (rnd < realb)
+            int * order = snew int[numberOfBatches];
+            UtilsMOEAD::randomPermutation(order, numberOfBatches);
+            for (int i = 0; i < numberOfBatches; i++)
             {
-                type = 1;   // neighborhood
-            }
-            else
+                evolveBatch(&pool, batches_[order[i]]);
+            } // for
+
+            delete[] order;
+
+            migrate();
+            checkpoint(snapshot, maxEvaluations);
+        }
+        while ((evaluations_ < maxEvaluations) &&
+                !isTerminated(population_, evaluations_));
+    } // if
+    else
+    {
+        do
+        {
+            int * permutation = snew int[populationSize_];
+            UtilsMOEAD::randomPermutation(permutation, populationSize_);
+            for (int i = 0; i < populationSize_; i++)
             {
-                type = 2;   // whole population
-            }
-            VectorOfInteger p;
-            matingSelection(p, n, 2, type);
+                int n = permutation[i]; // or int n = i;
+                //int n = i ; // or int n = i;
+                evolveSubproblem(n, matingType());
+                evaluations_++;
+            } // for
+
+            delete[] permutation;
+
+            migrate();
+            checkpoint(snapshot, maxEvaluations);
+        }
+        while ((evaluations_ < maxEvaluations) &&
+                !isTerminated(population_, evaluations_));
+    } // else
+
+    finishCheckpoints();
+
+    // Free memory
+    deleteParams();
 
-            // STEP 2.2. Reproduction
-            Solution * child;
-            Solution ** parents = snew Solution*[3];
+    publishInstrumentation();
 
-            parents[0] = population_->get(p[0]);
-            parents[1] = population_->get(p[1]);
-            parents[2] = population_->get(n);
+    return population_;
+} // execute
 
-            // Apply DE crossover
-            void ** object = snew void*[2];
-            object[0] = population_->get(n);
-            object[1] = parents;
-            child = (Solution *) (crossover_->execute(object));
-            delete[] object;
-            delete[] parents;
 
-            // Apply mutation
-            mutation_->execute(child);
+/**
+ * STEP 2.1. Chooses where the parents of a subproblem are taken from
+ * @return 1 (neighborhood) or 2 (whole population)
+ */
+int MOEAD::matingType()
+{
+    double rnd = PseudoRandom::randDouble();
 
-            // Evaluation
-            problem_->evaluate(child);
+    if (rnd < delta_) // if (rnd < realb)
+    {
+        return 1;   // neighborhood
+    }
+    else
+    {
+        return 2;   // whole population
+    }
+} // matingType
 
-            evaluations_++;
 
-            // STEP 2.3. Repair. Not necessary
+/**
+ * Evolves a subproblem: mating selection, reproduction, evaluation and
+ * update of the ideal point and of the neighbour solutions
+ * @param n The id of the subproblem
+ * @param type 1 (neighborhood) or 2 (whole population)
+ */
+void MOEAD::evolveSubproblem(int n, int type)
+{
+    VectorOfInteger p;
+    matingSelection(p, n, 2, type);
 
-            // STEP 2.4. Update z_
-            updateReference(child);
+    // STEP 2.2. Reproduction
+    Solution * child;
+    Solution ** parents = snew Solution*[3];
 
-            // STEP 2.5. Update of solutions
-            updateProblem(child, n, type);
-        } // for
+    parents[0] = population_->get(p[0]);
+    parents[1] = population_->get(p[1]);
+    parents[2] = population_->get(n);
 
-        delete[] permutation;
+    // Apply DE crossover
+    void ** object = snew void*[2];
+    object[0] = population_->get(n);
+    object[1] = parents;
+    child = (Solution *) (crossover_->execute(object));
+    delete[] object;
+    delete[] parents;
 
+    // Apply mutation
+    mutation_->execute(child);
+
+    // Evaluation
+    {
+        JMETAL_TIME_EVALUATIONS(1);
+        problem_->evaluate(child);
     }
-    while (evaluations_ < maxEvaluations);
 
-    // Free memory
-    deleteParams();
+    // STEP 2.3. Repair. Not necessary
 
-    return population_;
-} // execute
+    // STEP 2.4. Update z_
+    updateReference(child);
+
+    // STEP 2.5. Update of solutions
+    updateProblem(child, n, type);
+} // evolveSubproblem
+
+
+/**
+ * Evolves the subproblems of a batch. Those taking their parents from their
+ * neighbourhood only touch disjoint sets of solutions, so they are evolved
+ * concurrently; those using the whole population are evolved afterwards, one
+ * at a time.
+ * @param pool The threads used to evolve the batch
+ * @param batch The ids of the subproblems
+ */
+void MOEAD::evolveBatch(ThreadPool * pool, VectorOfInteger &batch)
+{
+    VectorOfInteger local;
+    VectorOfInteger global;
+    for (int i = 0; i < batch.size(); i++)
+    {
+        if (matingType() == 1)
+        {
+            local.push_back(batch[i]);
+        }
+        else
+        {
+            global.push_back(batch[i]);
+        }
+    } // for
+
+    pool->parallelFor(local.size(), [this, &local](int i)
+    {
+        evolveSubproblem(local[i], 1);
+    });
+
+    for (int i = 0; i < global.size(); i++)
+    {
+        evolveSubproblem(global[i], 2);
+    } // for
+
+    evaluations_ += batch.size();
+} // evolveBatch
+
+
+/**
+ * Exchanges solutions with the other islands of an island model. Each
+ * immigrant updates the ideal point and then competes, like a child, with
+ * the solutions of the whole population
+ */
+void MOEAD::migrate()
+{
+    SolutionSet * immigrants = exchangeMigrants(population_, evaluations_);
+    if (immigrants == nullptr)
+    {
+        return;
+    }
+    while (immigrants->size() > 0)
+    {
+        Solution * immigrant = immigrants->release(immigrants->size() - 1).release();
+        updateReference(immigrant);
+        updateProblem(immigrant, 0, 2);
+    }
+    delete immigrants;
+} // migrate
+
+
+/**
+ * Takes a snapshot of the population and of the ideal point to resume from
+ */
+void MOEAD::checkpoint(Checkpoint & snapshot, int maxEvaluations)
+{
+    if ((evaluations_ >= maxEvaluations) || !isCheckpointDue(evaluations_))
+    {
+        return;
+    }
+    beginCheckpoint(snapshot, "MOEAD", evaluations_);
+    snapshot.writeInt(evaluations_);
+    snapshot.writeSolutionSet(population_);
+    for (int i = 0; i < problem_->getNumberOfObjectives(); i++)
+    {
+        snapshot.writeDouble(z_[i]);
+    }
+    endCheckpoint(snapshot);
+} // checkpoint
 
 
 /**
@@ -251,6 +408,58 @@ void MOEAD::initNeighborhood()
 } // initNeighborhood
 
 
+/**
+ * initBatches. Greedy colouring of the subproblems: two subproblems get
+ * different colours if their neighbourhoods (including themselves) share a
+ * solution. Each colour is a batch that can be evolved concurrently.
+ */
+void MOEAD::initBatches()
+{
+    // colours already used by the subproblems touching each solution
+    MatrixOfInteger touchedBy(populationSize_);
+    VectorOfBoolean forbidden;
+
+    batches_.clear();
+    for (int i = 0; i < populationSize_; i++)
+    {
+        forbidden.assign(batches_.size() + 1, false);
+        for (int k = 0; k < touchedBy[i].size(); k++)
+        {
+            forbidden[touchedBy[i][k]] = true;
+        }
+        for (int j = 0; j < T_; j++)
+        {
+            int s = neighborhood_[i][j];
+            for (int k = 0; k < touchedBy[s].size(); k++)
+            {
+                forbidden[touchedBy[s][k]] = true;
+            }
+        } // for
+
+        int colour = 0;
+        while (forbidden[colour])
+        {
+            colour++;
+        }
+        if (colour == batches_.size())
+        {
+            batches_.push_back(VectorOfInteger());
+        }
+        batches_[colour].push_back(i);
+
+        touchedBy[i].push_back(colour);
+        for (int j = 0; j < T_; j++)
+        {
+            int s = neighborhood_[i][j];
+            if (s != i)
+            {
+                touchedBy[s].push_back(colour);
+            }
+        } // for
+    } // for
+} // initBatches
+
+
 /**
  * initPopulation
  */
@@ -260,7 +469,10 @@ void MOEAD::initPopulation()
     {
         Solution * newSolution = snew Solution(problem_);
 
-        problem_->evaluate(newSolution);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(newSolution);
+        }
         evaluations_++;
         population_->add(newSolution);
     } // for
@@ -292,6 +504,7 @@ void MOEAD::initIdealPoint()
  */
 void MOEAD::matingSelection(VectorOfInteger &list, int cid, int size, int type)
 {
+    JMETAL_TIME_PHASE(SELECTION);
 
     // list : the set of the indexes of selected mating parents
     // cid  : the id of current subproblem
@@ -342,10 +555,11 @@ void MOEAD::updateReference(Solution * individual)
 {
     for (int n = 0; n < problem_->getNumberOfObjectives(); n++)
     {
-        if (individual->getObjective(n) < z_[n])
+        double value = individual->getObjective(n);
+        double current = z_[n].load();
+        while ((value < current) && !z_[n].compare_exchange_weak(current, value))
         {
-            z_[n] = individual->getObjective(n);
-            //indArray_[n] = individual;
+            // another thread has changed z_[n]; current holds its new value
         }
     }
 } // updateReference
@@ -28,9 +28,18 @@
 
 #include <UtilsMOEAD.h>
 #include <PseudoRandom.h>
+#include <ThreadPool.h>
+#include <Checkpoint.h>
+#include <atomic>
 
 /**
  * This class implements the MOEA/D algorithm.
+ *
+ * When the input parameter "numberOfThreads" is greater than one, the
+ * subproblems are split into batches whose neighbourhoods do not overlap
+ * (a greedy colouring of the neighbourhood graph), and the subproblems of a
+ * batch are evolved concurrently. The problem must then support concurrent
+ * calls to <code>evaluate</code>.
  */
 
 class MOEAD : public Algorithm
@@ -47,9 +56,10 @@ private:
      */
     SolutionSet * population_;
     /**
-     * Z vector (ideal point)
+     * Z vector (ideal point). Its components are updated atomically so that
+     * concurrent subproblems can share it
      */
-    double * z_;
+    std::atomic<double> * z_;
     /**
      * Lambda vectors
      */
@@ -62,6 +72,14 @@ private:
      * Neighborhood
      */
     int ** neighborhood_;
+    /**
+     * Batches of subproblems with disjoint neighbourhoods (parallel mode)
+     */
+    MatrixOfInteger batches_;
+    /**
+     * Number of threads used to evolve the subproblems
+     */
+    int numberOfThreads_;
     /**
      * delta: probability that parent solutions are selected from neighbourhood
      */
@@ -85,6 +103,12 @@ private:
     void initNeighborhood();
     void initPopulation();
     void initIdealPoint();
+    void initBatches();
+    int matingType();
+    void evolveSubproblem(int n, int type);
+    void evolveBatch(ThreadPool * pool, VectorOfInteger &batch);
+    void migrate();
+    void checkpoint(Checkpoint & snapshot, int maxEvaluations);
     void matingSelection(VectorOfInteger &list, int cid, int size, int type);
     void updateReference(Solution * individual);
     void updateProblem(Solution * indiv, int id, int type);
@@ -21,6 +21,7 @@
 
 
 #include <NSGAII.h>
+#include <SolutionOrder.h>
 
 
 /*
@@ -44,6 +45,8 @@ NSGAII::NSGAII(Problem *problem) : Algorithm(problem)
  */
 SolutionSet * NSGAII::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     int populationSize;
     int maxEvaluations;
@@ -62,6 +65,8 @@ SolutionSet * NSGAII::execute()
     Operator * selectionOperator;
 
     Distance * distance = new Distance();
+    CrowdingComparator crowdingComparator;
+    Checkpoint snapshot;
 
     //Read the parameters
     populationSize = *(int *) getInputParameter("populationSize");
@@ -79,19 +84,31 @@ SolutionSet * NSGAII::execute()
     crossoverOperator = operators_["crossover"];
     selectionOperator = operators_["selection"];
 
-    // Create the initial solutionSet
-    Solution * newSolution;
-    for (int i = 0; i < populationSize; i++)
+    if (beginResume(snapshot, "NSGAII"))
     {
-        newSolution = new Solution(problem_);
-        problem_->evaluate(newSolution);
-        problem_->evaluateConstraints(newSolution);
-        evaluations++;
-        population->add(newSolution);
-    } //for
+        // Continue from a snapshot
+        evaluations = snapshot.readInt();
+        snapshot.readSolutionSet(population, problem_);
+        endResume(snapshot);
+    }
+    else
+    {
+        // Create the initial solutionSet
+        Solution * newSolution;
+        for (int i = 0; i < populationSize; i++)
+        {
+            newSolution = new Solution(problem_);
+            evaluations++;
+            population->add(newSolution);
+        } //for
+        {
+            JMETAL_TIME_EVALUATIONS(population->size());
+            problem_->evaluateSolutions(population);
+        }
+    } // if
 
     // Generations
-    while (evaluations < maxEvaluations)
+    while ((evaluations < maxEvaluations) && !isTerminated(population, evaluations))
     {
 
         // Create the offSpring solutionSet
@@ -111,10 +128,6 @@ SolutionSet * NSGAII::execute()
                 mutationOperator->execute(offSpring[0]);
                 mutationOperator->execute(offSpring[1]);
 
-                problem_->evaluate(offSpring[0]);
-                problem_->evaluateConstraints(offSpring[0]);
-                problem_->evaluate(offSpring[1]);
-                problem_->evaluateConstraints(offSpring[1]);
                 offspringPopulation->add(offSpring[0]);
                 offspringPopulation->add(offSpring[1]);
                 evaluations += 2;
@@ -125,21 +138,24 @@ SolutionSet * NSGAII::execute()
 
         delete[] parents;
 
-        // Create the solutionSet union of solutionSet and offSpring
-        unionSolution = population->join(offspringPopulation);
+        // The offspring are evaluated together, so that problems able to
+        // evaluate several solutions at once can do it
+        {
+            JMETAL_TIME_EVALUATIONS(offspringPopulation->size());
+            problem_->evaluateSolutions(offspringPopulation);
+        }
+
+        // Create the solutionSet union of solutionSet and offSpring. The
+        // solutions are moved, so population is left empty
+        unionSolution = population->joinByMove(offspringPopulation);
         delete offspringPopulation;
 
         // Ranking the union
-        Ranking * ranking = new Ranking(unionSolution);
+        Ranking * ranking = new Ranking(unionSolution, true);
 
         int remain = populationSize;
         int index = 0;
         SolutionSet * front = nullptr;
-        for (int i=0; i<population->size(); i++)
-        {
-            delete population->get(i);
-        }
-        population->clear();
 
         // Obtain the next front
         front = ranking->getSubfront(index);
@@ -149,15 +165,12 @@ SolutionSet * NSGAII::execute()
             //Assign crowding distance to individuals
             distance->crowdingDistanceAssignment(front, problem_->getNumberOfObjectives());
 
-            //Add the individuals of this front
-            for (int k = 0; k < front->size(); k++)
-            {
-                population->add(new Solution(front->get(k)));
-            } // for
-
             //Decrement remain
             remain = remain - front->size();
 
+            //Add the individuals of this front
+            population->moveFrom(front);
+
             //Obtain the next front
             index++;
             if (remain > 0)
@@ -171,13 +184,8 @@ SolutionSet * NSGAII::execute()
         if (remain > 0)    // front contains individuals to insert
         {
             distance->crowdingDistanceAssignment(front, problem_->getNumberOfObjectives());
-            Comparator * c = new CrowdingComparator();
-            front->sort(c);
-            delete c;
-            for (int k = 0; k < remain; k++)
-            {
-                population->add(new Solution(front->get(k)));
-            } // for
+            front->sortBy(CrowdingOrder());
+            population->moveFrom(front, remain);
 
             remain = 0;
         } // if
@@ -185,6 +193,18 @@ SolutionSet * NSGAII::execute()
         delete ranking;
         delete unionSolution;
 
+        // Exchange solutions with the other islands of an island model
+        migrate(population, evaluations, &crowdingComparator);
+
+        // Take a snapshot to resume from
+        if ((evaluations < maxEvaluations) && isCheckpointDue(evaluations))
+        {
+            beginCheckpoint(snapshot, "NSGAII", evaluations);
+            snapshot.writeInt(evaluations);
+            snapshot.writeSolutionSet(population);
+            endCheckpoint(snapshot);
+        }
+
         // This piece of code shows how to use the indicator object into the code
         // of NSGA-II. In particular, it finds the number of evaluations required
         // by the algorithm to obtain a Pareto front with a hypervolume higher
@@ -198,21 +218,21 @@ SolutionSet * NSGAII::execute()
 
     } // while
 
+    finishCheckpoints();
     delete distance;
 
     // Return as output parameter the required evaluations
 //  setOutputParameter("evaluations", &requiredEvaluations);
 
     // Return the first non-dominated front
-    Ranking * ranking = new Ranking(population);
+    Ranking * ranking = new Ranking(population, true);
     SolutionSet * result = new SolutionSet(ranking->getSubfront(0)->size());
-    for (int i=0; i<ranking->getSubfront(0)->size(); i++)
-    {
-        result->add(new Solution(ranking->getSubfront(0)->get(i)));
-    }
+    result->moveFrom(ranking->getSubfront(0));
     delete ranking;
     delete population;
 
+    publishInstrumentation();
+
     return result;
 
 } // execute
@@ -28,6 +28,7 @@
 #include <Distance.h>
 #include <Ranking.h>
 #include <CrowdingComparator.h>
+#include <Checkpoint.h>
 //#include <QualityIndicator.h>
 
 /**
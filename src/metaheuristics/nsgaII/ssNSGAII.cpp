@@ -21,6 +21,7 @@
 
 
 #include <ssNSGAII.h>
+#include <SolutionOrder.h>
 
 
 /*
@@ -44,6 +45,8 @@ ssNSGAII::ssNSGAII(Problem *problem) : Algorithm(problem)
  */
 SolutionSet * ssNSGAII::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     int populationSize;
     int maxEvaluations;
@@ -84,14 +87,17 @@ SolutionSet * ssNSGAII::execute()
     for (int i = 0; i < populationSize; i++)
     {
         newSolution = new Solution(problem_);
-        problem_->evaluate(newSolution);
-        problem_->evaluateConstraints(newSolution);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(newSolution);
+            problem_->evaluateConstraints(newSolution);
+        }
         evaluations++;
         population->add(newSolution);
     } //for
 
     // Generations
-    while (evaluations < maxEvaluations)
+    while ((evaluations < maxEvaluations) && !isTerminated(population, evaluations))
     {
 
         // Create the offSpring solutionSet
@@ -109,8 +115,11 @@ SolutionSet * ssNSGAII::execute()
         mutationOperator->execute(offSpring[0]);
 
         // evaluation
-        problem_->evaluate(offSpring[0]);
-        problem_->evaluateConstraints(offSpring[0]);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(offSpring[0]);
+            problem_->evaluateConstraints(offSpring[0]);
+        }
 
         // insert child into the offspring population
         offspringPopulation->add(offSpring[0]);
@@ -164,9 +173,7 @@ SolutionSet * ssNSGAII::execute()
         if (remain > 0)    // front contains individuals to insert
         {
             distance->crowdingDistanceAssignment(front, problem_->getNumberOfObjectives());
-            Comparator * c = new CrowdingComparator();
-            front->sort(c);
-            delete c;
+            front->sortBy(CrowdingOrder());
             for (int k = 0; k < remain; k++)
             {
                 population->add(new Solution(front->get(k)));
@@ -209,6 +216,8 @@ SolutionSet * ssNSGAII::execute()
     delete ranking;
     delete population;
 
+    publishInstrumentation();
+
     return result;
 
 } // execute
@@ -62,8 +62,14 @@ void OMOPSO::initParams()
     crowdingDistanceComparator = new CrowdingDistanceComparator();
     distance           = new Distance();
 
-    // Create the speed_ vector
-    speed = snew double*[particlesSize];
+    // Create the swarm (positions, speeds and best positions)
+    swarm      = snew ParticleSwarm(problem_, particlesSize);
+    globalBest = snew double[problem_->getNumberOfVariables()];
+    r1         = snew double[particlesSize];
+    r2         = snew double[particlesSize];
+    C1         = snew double[particlesSize];
+    C2         = snew double[particlesSize];
+    W          = snew double[particlesSize];
 
 } // initParams
 
@@ -74,11 +80,13 @@ void OMOPSO::initParams()
 void OMOPSO::deleteParams()
 {
 
-    for (int i = 0; i < particlesSize; i++)
-    {
-        delete [] speed[i];
-    }
-    delete [] speed;
+    delete swarm;
+    delete [] globalBest;
+    delete [] r1;
+    delete [] r2;
+    delete [] C1;
+    delete [] C2;
+    delete [] W;
     delete dominance;
     delete crowdingDistanceComparator;
     delete distance;
@@ -100,14 +108,15 @@ void OMOPSO::deleteParams()
 void OMOPSO::computeSpeed()
 {
 
-    double r1, r2, W, C1, C2;
-    XReal *bestGlobal;
+    //Params for velocity equation, drawn for the whole swarm at once
+    ParticleSwarm::randDouble(r1, particlesSize, 0.0, 1.0);
+    ParticleSwarm::randDouble(r2, particlesSize, 0.0, 1.0);
+    ParticleSwarm::randDouble(C1, particlesSize, 1.5, 2.0);
+    ParticleSwarm::randDouble(C2, particlesSize, 1.5, 2.0);
+    ParticleSwarm::randDouble(W, particlesSize, 0.1, 0.5);
 
     for (int i = 0; i < particlesSize; i++)
     {
-        XReal *particle     = new XReal(particles->get(i));
-        XReal *bestParticle = new XReal(best[i]);
-
         //Select a global best for calculate the speed of particle i, bestGlobal
         Solution *one, *two;
         int pos1 = PseudoRandom::randInt(0,leaders->size()-1);
@@ -115,36 +124,12 @@ void OMOPSO::computeSpeed()
         one = leaders->get(pos1);
         two = leaders->get(pos2);
 
-        if (crowdingDistanceComparator->compare(one,two) < 1)
-        {
-            bestGlobal = new XReal(one);
-        }
-        else
-        {
-            bestGlobal = new XReal(two);
-        }
-
-        //Params for velocity equation
-        r1 = PseudoRandom::randDouble();
-        r2 = PseudoRandom::randDouble();
-        C1 = PseudoRandom::randDouble(1.5,2.0);
-        C2 = PseudoRandom::randDouble(1.5,2.0);
-        W  = PseudoRandom::randDouble(0.1,0.5);
-
-        for (int var = 0; var < particle->getNumberOfDecisionVariables(); var++)
-        {
-            //Computing the velocity of this particle
-            speed[i][var] = W  * speed[i][var] +
-                            C1 * r1 * (bestParticle->getValue(var) -
-                                       particle->getValue(var)) +
-                            C2 * r2 * (bestGlobal->getValue(var) -
-                                       particle->getValue(var));
-        }
-
-        delete bestGlobal;
-        delete particle;
-        delete bestParticle;
+        XReal bestGlobal((crowdingDistanceComparator->compare(one,two) < 1) ? one : two);
+        bestGlobal.getValues(globalBest);
 
+        //Computing the velocity of this particle
+        swarm->updateVelocity(i, globalBest, W[i], C1[i] * r1[i],
+                              C2[i] * r2[i], 1.0);
     }
 
 } // computeSpeed
@@ -158,31 +143,27 @@ void OMOPSO::computeNewPositions()
 
     for (int i = 0; i < particlesSize; i++)
     {
-        XReal * particle = new XReal(particles->get(i));
-        //particle.move(speed_[i]);
-        for (int var = 0; var < particle->getNumberOfDecisionVariables(); var++)
+        double *position = swarm->getPosition(i);
+        double *speed = swarm->getVelocity(i);
+        for (int var = 0; var < swarm->getNumberOfVariables(); var++)
         {
-			double oldPosition = particle->getValue(var);
-			double newPosition = oldPosition + speed[i][var];
-            particle->setValue(var, newPosition);
-            if (particle->getValue(var) < problem_->getLowerLimit(var))
-            {				
-                particle->setValue(var, problem_->getLowerLimit(var));
-				double diff = ((oldPosition - problem_->getLowerLimit(var))) * PseudoRandom::randDouble();
-				newPosition = problem_->getLowerLimit(var) + diff;
-				particle->setValue(var, newPosition);
-                speed[i][var] = speed[i][var] * -1.0;
+            double oldPosition = position[var];
+            double newPosition = oldPosition + speed[var];
+            if (newPosition < problem_->getLowerLimit(var))
+            {
+                double diff = ((oldPosition - problem_->getLowerLimit(var))) * PseudoRandom::randDouble();
+                newPosition = problem_->getLowerLimit(var) + diff;
+                speed[var] = speed[var] * -1.0;
             }
-            if (particle->getValue(var) > problem_->getUpperLimit(var))
+            else if (newPosition > problem_->getUpperLimit(var))
             {
-                //particle->setValue(var, problem_->getUpperLimit(var));
-				double diff = ((problem_->getUpperLimit(var) - oldPosition)) * PseudoRandom::randDouble();
-				newPosition = problem_->getUpperLimit(var) - diff;
-				particle->setValue(var, newPosition);
-                speed[i][var] = speed[i][var] * -1.0;
+                double diff = ((problem_->getUpperLimit(var) - oldPosition)) * PseudoRandom::randDouble();
+                newPosition = problem_->getUpperLimit(var) - diff;
+                speed[var] = speed[var] * -1.0;
             }
+            position[var] = newPosition;
         }
-        delete particle;
+        swarm->storePosition(i, particles->get(i));
     }
 
 } // computeNewPositions
@@ -203,10 +184,12 @@ void OMOPSO::mopsoMutation(int actualIteration, int totalIterations)
         if (i % 3 == 0)   //particles_ mutated with a non-uniform mutation
         {
             nonUniformMutation->execute(particles->get(i));
+            swarm->loadPosition(i, particles->get(i));
         }
         else if (i % 3 == 1)     //particles_ mutated with a uniform mutation operator
         {
             uniformMutation->execute(particles->get(i));
+            swarm->loadPosition(i, particles->get(i));
         }
         else {}   //particles_ without mutation
     }
@@ -220,6 +203,8 @@ void OMOPSO::mopsoMutation(int actualIteration, int totalIterations)
  */
 SolutionSet *OMOPSO::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     initParams();
 
@@ -227,20 +212,16 @@ SolutionSet *OMOPSO::execute()
     for (int i = 0; i < particlesSize; i++)
     {
         Solution *particle = new Solution(problem_);
-        problem_->evaluate(particle);
-        problem_->evaluateConstraints(particle);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(particle);
+            problem_->evaluateConstraints(particle);
+        }
         particles->add(particle);
     }
 
     //-> Step2. Initialize the speed of each particle to 0
-    for (int i = 0; i < particlesSize; i++)
-    {
-        speed[i] = snew double[problem_->getNumberOfVariables()];
-        for (int j = 0; j < problem_->getNumberOfVariables(); j++)
-        {
-            speed[i][j] = 0.0;
-        }
-    }
+    swarm->resetVelocities();
 
     // Step4 and 5
     for (int i = 0; i < particles->size(); i++)
@@ -265,13 +246,16 @@ SolutionSet *OMOPSO::execute()
     {
         Solution *particle = new Solution(particles->get(i));
         best[i] = particle;
+        swarm->loadPosition(i, particle);
+        swarm->saveBestPosition(i);
     }
 
     //Crowding the leaders_
     distance->crowdingDistanceAssignment(leaders, problem_->getNumberOfObjectives());
 
     //-> Step 7. Iterations ..
-    while (iteration < maxIterations)
+    while ((iteration < maxIterations) &&
+            !isTerminated(leaders, (long) (iteration + 1) * particles->size()))
     {
 
         //Compute the speed_
@@ -286,6 +270,7 @@ SolutionSet *OMOPSO::execute()
         //Evaluate the new particles in new positions
         for (int i = 0; i < particles->size(); i++)
         {
+            JMETAL_TIME_EVALUATIONS(1);
             Solution *particle = particles->get(i);
             problem_->evaluate(particle);
             problem_->evaluateConstraints(particle);
@@ -318,6 +303,7 @@ SolutionSet *OMOPSO::execute()
                 Solution *particle = new Solution(particles->get(i));
                 delete best[i];
                 best[i] = particle;
+                swarm->saveBestPosition(i);
             }
         }
 
@@ -337,5 +323,7 @@ SolutionSet *OMOPSO::execute()
     // Free memory
     deleteParams();
 
+    publishInstrumentation();
+
     return result;
 } // execute
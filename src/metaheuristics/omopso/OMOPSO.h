@@ -26,11 +26,13 @@
 #include <SolutionSet.h>
 
 #include <CrowdingArchive.h>
+#include <CrowdingDistanceComparator.h>
 #include <Distance.h>
 #include <EpsilonDominanceComparator.h>
 #include <NonDominatedSolutionList.h>
 #include <PseudoRandom.h>
 #include <XReal.h>
+#include <ParticleSwarm.h>
 
 /**
  * This class implements an asynchronous version of OMOPSO algorithm
@@ -86,9 +88,24 @@ private:
     NonDominatedSolutionList *eArchive;
 
     /**
-     * Stores the speed of each particle
+     * Stores the positions, speeds and best positions of the particles
      */
-    double **speed;
+    ParticleSwarm *swarm;
+
+    /**
+     * Stores the position of the leader of the current particle
+     */
+    double *globalBest;
+
+    /**
+     * Stores the random coefficients of the velocity equation, one per
+     * particle
+     */
+    double *r1;
+    double *r2;
+    double *C1;
+    double *C2;
+    double *W;
 
     /**
      * Stores a comparator for checking dominance
@@ -69,6 +69,9 @@ Solution * paes::test(Solution * solution, Solution * mutatedSolution,
 
 SolutionSet * paes::execute()
 {
+    startInstrumentation();
+    startTermination();
+
     int bisections, archiveSize, maxEvaluations, evaluations;
     AdaptiveGridArchive * archive;
 
@@ -91,8 +94,11 @@ SolutionSet * paes::execute()
     //-> Create the initial solution and evaluate it and his constraints
     Solution * solution = new Solution(problem_);
 
-    problem_->evaluate(solution);
-    problem_->evaluateConstraints(solution);
+    {
+        JMETAL_TIME_EVALUATIONS(1);
+        problem_->evaluate(solution);
+        problem_->evaluateConstraints(solution);
+    }
     evaluations++;
 
     // Add it to the archive
@@ -105,8 +111,11 @@ SolutionSet * paes::execute()
         Solution * mutatedIndividual = new Solution(solution);
         mutationOperator->execute(mutatedIndividual);
 
-        problem_->evaluate(mutatedIndividual);
-        problem_->evaluateConstraints(mutatedIndividual);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(mutatedIndividual);
+            problem_->evaluateConstraints(mutatedIndividual);
+        }
         evaluations++;
         //<-
 
@@ -128,9 +137,12 @@ SolutionSet * paes::execute()
 
 
     }
-    while (evaluations < maxEvaluations);
+    while ((evaluations < maxEvaluations) && !isTerminated(archive, evaluations));
 
     //Return the  population of non-dominated solution
+
+    publishInstrumentation();
+
     return archive;
 }  // execute
 
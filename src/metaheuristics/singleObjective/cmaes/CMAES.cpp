@@ -40,7 +40,8 @@ CMAES::CMAES(Problem *problem) : Algorithm(problem)
 
 SolutionSet * CMAES::execute()
 {
-
+    startInstrumentation();
+    startTermination();
 
     //Read the parameters
     populationSize = *(int *) getInputParameter("populationSize");
@@ -53,8 +54,16 @@ SolutionSet * CMAES::execute()
 
     init();
 
+    Checkpoint snapshot;
+    if (beginResume(snapshot, "CMAES"))
+    {
+        readState(snapshot);
+        endResume(snapshot);
+    }
+
     // iteration loop
-    while (counteval < maxEvaluations)
+    bool terminated = false;
+    while ((counteval < maxEvaluations) && !terminated)
     {
 
         // --- core iteration step ---
@@ -67,7 +76,10 @@ SolutionSet * CMAES::execute()
                 //std::cout << "RESAMPLING!" << std::endl;
                 population_->replace(i, resampleSingle(i));
             }
-            problem_->evaluate(population_->get(i));
+            {
+                JMETAL_TIME_EVALUATIONS(1);
+                problem_->evaluate(population_->get(i));
+            }
         }
         counteval += populationSize;
 
@@ -75,10 +87,21 @@ SolutionSet * CMAES::execute()
         //std::cout << counteval << ": " << bestSolutionEver->getObjective(0) << std::endl;
         updateDistribution();
 
+        terminated = isTerminated(population_, counteval);
         delete population_;
 
+        // Take a snapshot to resume from
+        if ((counteval < maxEvaluations) && !terminated &&
+                isCheckpointDue(counteval))
+        {
+            beginCheckpoint(snapshot, "CMAES", counteval);
+            writeState(snapshot);
+            endCheckpoint(snapshot);
+        }
+
     }
 
+    finishCheckpoints();
     deleteParams();
 
     delete comparator ;
@@ -86,6 +109,8 @@ SolutionSet * CMAES::execute()
     SolutionSet * resultPopulation  = snew SolutionSet(1) ;
     resultPopulation->add(bestSolutionEver) ;
 
+    publishInstrumentation();
+
     return resultPopulation ;
 
 } // execute
@@ -100,14 +125,12 @@ void CMAES::init()
     int N = problem_->getNumberOfVariables();
 
     // objective variables initial point
-    default_random_engine generator;
     xmean = snew double[N];
     for (int i = 0; i < N; i++)
     {
         double stddev = (problem_->getUpperLimit(i) - problem_->getLowerLimit(i)) /2;
         double mean = problem_->getLowerLimit(i) + stddev;
-        normal_distribution<double> distribution(mean,stddev/2);
-        xmean[i] = distribution(generator);
+        xmean[i] = PseudoRandom::randNormal(mean, stddev/2);
         //xmean[i] = PseudoRandom::randDouble(0, 1);
     }
 
@@ -227,9 +250,6 @@ void CMAES::init()
 SolutionSet * CMAES::samplePopulation()
 {
 
-    default_random_engine generator;
-    normal_distribution<double> distribution(0.0,1.0);
-
     int N = problem_->getNumberOfVariables();
     double * artmp = snew double[N];
     double sum;
@@ -240,7 +260,7 @@ SolutionSet * CMAES::samplePopulation()
         for (int i = 0; i < N; i++)
         {
             //artmp[i] = diagD[i] * PseudoRandom::randDouble(-2, 2);
-            artmp[i] = diagD[i] * distribution(generator);
+            artmp[i] = diagD[i] * PseudoRandom::randNormal(0.0, 1.0);
         }
         for (int i = 0; i < N; i++)
         {
@@ -352,6 +372,60 @@ void CMAES::storeBest(Comparator * comparator)
 } // storeBest
 
 
+/**
+ * Writes the state of the search distribution (mean, step size, evolution
+ * paths and covariance matrix with its decomposition) and the best solution
+ * found so far to a snapshot
+ */
+void CMAES::writeState(Checkpoint & snapshot)
+{
+    int N = problem_->getNumberOfVariables();
+
+    snapshot.writeInt(counteval);
+    snapshot.writeInt(eigeneval);
+    snapshot.writeDouble(sigma);
+    snapshot.writeDoubles(xmean, N);
+    snapshot.writeDoubles(pc, N);
+    snapshot.writeDoubles(ps, N);
+    snapshot.writeDoubles(diagD, N);
+    for (int i = 0; i < N; i++)
+    {
+        snapshot.writeDoubles(B[i], N);
+        snapshot.writeDoubles(C[i], N);
+        snapshot.writeDoubles(invsqrtC[i], N);
+    }
+    snapshot.writeSolution(bestSolutionEver);
+
+} // writeState
+
+
+/**
+ * Reads the state written by <code>writeState</code>. The arrays must have
+ * been allocated by <code>init</code>
+ */
+void CMAES::readState(Checkpoint & snapshot)
+{
+    int N = problem_->getNumberOfVariables();
+
+    counteval = snapshot.readInt();
+    eigeneval = snapshot.readInt();
+    sigma = snapshot.readDouble();
+    snapshot.readDoubles(xmean, N);
+    snapshot.readDoubles(pc, N);
+    snapshot.readDoubles(ps, N);
+    snapshot.readDoubles(diagD, N);
+    for (int i = 0; i < N; i++)
+    {
+        snapshot.readDoubles(B[i], N);
+        snapshot.readDoubles(C[i], N);
+        snapshot.readDoubles(invsqrtC[i], N);
+    }
+    delete bestSolutionEver;
+    bestSolutionEver = snapshot.readSolution(problem_);
+
+} // readState
+
+
 void CMAES::updateDistribution()
 {
 
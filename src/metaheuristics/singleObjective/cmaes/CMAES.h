@@ -27,11 +27,12 @@
 #include <SolutionSet.h>
 #include <Comparator.h>
 #include <ObjectiveComparator.h>
+#include <PseudoRandom.h>
+#include <Checkpoint.h>
 
 #include <UtilsCMAES.h>
 
 #include <math.h>
-#include <random>
 
 
 /**
@@ -96,6 +97,8 @@ private:
     Solution * resampleSingle(int iNk);
     void storeBest(Comparator * comparator);
     void updateDistribution();
+    void writeState(Checkpoint & snapshot);
+    void readState(Checkpoint & snapshot);
     void deleteParams();
 
 public:
@@ -44,6 +44,8 @@ DE::DE(Problem *problem) : Algorithm(problem)
  */
 SolutionSet * DE::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     int populationSize;
     int maxEvaluations;
@@ -82,15 +84,18 @@ SolutionSet * DE::execute()
     for (int i = 0; i < populationSize; i++)
     {
         newSolution = snew Solution(problem_);
-        problem_->evaluate(newSolution);
-        problem_->evaluateConstraints(newSolution);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(newSolution);
+            problem_->evaluateConstraints(newSolution);
+        }
         evaluations++;
         population->add(newSolution);
     } //for
 
     // Generations ...
     population->sort(comparator) ;
-    while (evaluations < maxEvaluations)
+    while ((evaluations < maxEvaluations) && !isTerminated(population, evaluations))
     {
 
         // Create the offSpring solutionSet
@@ -119,7 +124,10 @@ SolutionSet * DE::execute()
             delete[] object2;
             delete[] parent;
 
-            problem_->evaluate(child);
+            {
+                JMETAL_TIME_EVALUATIONS(1);
+                problem_->evaluate(child);
+            }
 
             evaluations++;
 
@@ -146,6 +154,9 @@ SolutionSet * DE::execute()
         }
         offspringPopulation->clear();
         delete offspringPopulation;
+
+        // Exchange solutions with the other islands of an island model
+        migrate(population, evaluations, comparator);
         population->sort(comparator);
     } // while
 
@@ -156,6 +167,8 @@ SolutionSet * DE::execute()
     resultPopulation->add(snew Solution(population->get(0)));
     delete population;
 
+    publishInstrumentation();
+
     return resultPopulation;
 
 } // execute
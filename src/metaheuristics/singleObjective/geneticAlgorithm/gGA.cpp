@@ -19,6 +19,7 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <gGA.h>
+#include <algorithm>
 
 /*
  * This class implements the NSGA-II algorithm.
@@ -41,6 +42,8 @@ gGA::gGA(Problem *problem) : Algorithm(problem)
  */
 SolutionSet * gGA::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     int populationSize;
     int maxEvaluations;
@@ -53,8 +56,6 @@ SolutionSet * gGA::execute()
     Operator * crossoverOperator;
     Operator * selectionOperator;
 
-    Comparator * comparator = snew ObjectiveComparator(0) ;
-
     //Read the parameters
     populationSize = *(int *) getInputParameter("populationSize");
     maxEvaluations = *(int *) getInputParameter("maxEvaluations");
@@ -82,17 +83,21 @@ SolutionSet * gGA::execute()
     for (int i = 0; i < populationSize; i++)
     {
         newSolution = snew Solution(problem_);
-        problem_->evaluate(newSolution);
-        problem_->evaluateConstraints(newSolution);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(newSolution);
+            problem_->evaluateConstraints(newSolution);
+        }
         evaluations++;
         population->add(newSolution);
     } //for
+    SolutionHeap * populationHeap = snew SolutionHeap(population, 0);
 
 //  std::cout << "gGA: Poblacion inicializada con size = " << population->size() << std::endl;
 //  std::cout << "gGA: Maximo de evaluaciones: " << maxEvaluations << std::endl;
 
     // Generations
-    while (evaluations < maxEvaluations)
+    while ((evaluations < maxEvaluations) && !isTerminated(population, evaluations))
     {
 
         // Create the offSpring solutionSet
@@ -109,10 +114,13 @@ SolutionSet * gGA::execute()
                 Solution ** offSpring = (Solution **) (crossoverOperator->execute(parents));
                 mutationOperator->execute(offSpring[0]);
                 mutationOperator->execute(offSpring[1]);
-                problem_->evaluate(offSpring[0]);
-                problem_->evaluateConstraints(offSpring[0]);
-                problem_->evaluate(offSpring[1]);
-                problem_->evaluateConstraints(offSpring[1]);
+                {
+                    JMETAL_TIME_EVALUATIONS(2);
+                    problem_->evaluate(offSpring[0]);
+                    problem_->evaluateConstraints(offSpring[0]);
+                    problem_->evaluate(offSpring[1]);
+                    problem_->evaluateConstraints(offSpring[1]);
+                }
 
                 offspringPopulation->add(offSpring[0]);
                 offspringPopulation->add(offSpring[1]);
@@ -122,31 +130,55 @@ SolutionSet * gGA::execute()
         } // for
         delete[] parents;
 
-        population->sort(comparator) ;
-        offspringPopulation->sort(comparator) ;
+        // Elitism: the two best individuals of the population replace the
+        // two worst offspring
+        SolutionHeap * offspringHeap = snew SolutionHeap(offspringPopulation, 0);
+        int elitism = std::min(2, std::min(population->size(), offspringPopulation->size()));
+        int elite[2];
+        int worst[2];
+        populationHeap->best(elitism, elite);
+        offspringHeap->worst(elitism, worst);
+        for (int i = 0; i < elitism; i++)
+        {
+            delete offspringPopulation->get(worst[i]);
+            offspringHeap->replace(worst[i], snew Solution(population->get(elite[i])));
+        }
 
-        delete offspringPopulation->get(offspringPopulation->size()-1);
-        delete offspringPopulation->get(offspringPopulation->size()-2);
-        offspringPopulation->replace(offspringPopulation->size()-1, snew Solution(population->get(0))) ;
-        offspringPopulation->replace(offspringPopulation->size()-2, snew Solution(population->get(1))) ;
+        delete populationHeap;
+        delete population;
+        population     = offspringPopulation;
+        populationHeap = offspringHeap;
 
-        for (int i=0; i<population->size(); i++)
+        // Exchange solutions with the other islands of an island model. Each
+        // immigrant replaces the worst individual unless it is dominated by it
+        SolutionSet * immigrants = exchangeMigrants(population, evaluations);
+        if (immigrants != nullptr)
         {
-            delete population->get(i);
+            DominanceComparator dominance;
+            for (int i = 0; i < immigrants->size(); i++)
+            {
+                int index = populationHeap->worst();
+                if (dominance.compare(population->get(index), immigrants->get(i)) == -1)
+                {
+                    delete immigrants->get(i);
+                }
+                else
+                {
+                    delete population->get(index);
+                    populationHeap->replace(index, immigrants->get(i));
+                }
+            }
+            immigrants->clear();
+            delete immigrants;
         }
-        population->clear() ;
-
-        for (int i = 0; i < offspringPopulation->size(); i++)
-            population->add(offspringPopulation->get(i)) ;
-        offspringPopulation->clear() ;
-        delete offspringPopulation;
     }
 
-    delete comparator;
-
     SolutionSet * resultPopulation  = snew SolutionSet(1) ;
-    resultPopulation->add(snew Solution(population->get(0))) ;
+    resultPopulation->add(snew Solution(population->get(populationHeap->best()))) ;
+    delete populationHeap;
     delete population;
 
+    publishInstrumentation();
+
     return resultPopulation ;
 } // execute
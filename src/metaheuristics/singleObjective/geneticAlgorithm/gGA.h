@@ -25,6 +25,8 @@
 #include <Problem.h>
 #include <SolutionSet.h>
 #include <ObjectiveComparator.h>
+#include <DominanceComparator.h>
+#include <SolutionHeap.h>
 
 class gGA : public Algorithm
 {
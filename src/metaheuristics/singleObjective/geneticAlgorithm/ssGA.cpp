@@ -43,6 +43,8 @@ ssGA::ssGA(Problem *problem) : Algorithm(problem)
  */
 SolutionSet * ssGA::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     int populationSize;
     int maxEvaluations;
@@ -56,12 +58,6 @@ SolutionSet * ssGA::execute()
 
     Comparator * comparator = new ObjectiveComparator(0); // Single objective comparator
 
-    Operator * findWorstSolution;
-   MapOfStringFunct parameters; // Operator parameters
-    parameters["comparator"] = comparator;
-
-    findWorstSolution = new WorstSolutionSelection(parameters) ;
-
     //Read the parameters
     populationSize = *(int *) getInputParameter("populationSize");
     maxEvaluations = *(int *) getInputParameter("maxEvaluations");
@@ -80,15 +76,22 @@ SolutionSet * ssGA::execute()
     for (int i = 0; i < populationSize; i++)
     {
         newIndividual = new Solution(problem_);
-        problem_->evaluate(newIndividual);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(newIndividual);
+        }
         evaluations++;
         population->add(newIndividual);
     } // for
 
+    // The heap keeps track of the worst individual, so that the replacement
+    // is done in place in O(log N)
+    SolutionHeap * heap = new SolutionHeap(population, 0);
+    Solution ** parents = new Solution*[2];
+
     // main loop
-    while (evaluations < maxEvaluations)
+    while ((evaluations < maxEvaluations) && !isTerminated(population, evaluations))
     {
-        Solution ** parents = new Solution*[2];
 
         // Selection
         parents[0] = (Solution*)selectionOperator->execute(population);
@@ -101,37 +104,42 @@ SolutionSet * ssGA::execute()
         mutationOperator->execute(offspring[0]);
 
         // Evaluation of the new individual
-        problem_->evaluate(offspring[0]);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(offspring[0]);
+        }
 
         evaluations ++;
 
-        // Replacement: replace the last individual is the new one is better
-        int * worstIndividualPtr = (int *) findWorstSolution->execute(population);
-        int worstIndividual = *worstIndividualPtr;
-        delete worstIndividualPtr;
+        // Replacement: replace the worst individual if the new one is better
+        int worstIndividual = heap->worst();
 
         if (comparator->compare(population->get(worstIndividual), offspring[0]) > 0)
         {
             delete population->get(worstIndividual);
-            population->remove(worstIndividual);
-            population->add(new Solution(offspring[0]));
+            heap->replace(worstIndividual, offspring[0]);
         } // if
+        else
+        {
+            delete offspring[0];
+        } // else
 
-        delete offspring[0];
         delete offspring[1];
         delete [] offspring;
-        delete [] parents;
 
     } // while
 
     // Return a population with the best individual
 
     SolutionSet * resultPopulation  = new SolutionSet(1);
-    resultPopulation->add(new Solution(population->best(comparator)));
+    resultPopulation->add(new Solution(population->get(heap->best())));
 
+    delete [] parents;
+    delete heap;
     delete population;
     delete comparator;
-    delete findWorstSolution;
+
+    publishInstrumentation();
 
     return resultPopulation;
 } // execute
@@ -26,7 +26,7 @@
 #include <Problem.h>
 #include <SolutionSet.h>
 #include <ObjectiveComparator.h>
-#include <WorstSolutionSelection.h>
+#include <SolutionHeap.h>
 
 /**
  * Class implementing a steady-state genetic algorithm
@@ -76,17 +76,11 @@ void PSO::initParams()
     particles_ = new SolutionSet(particlesSize_);
     localBest_ = new Solution*[particlesSize_];
 
-    // Create the speed_ vector
-    speed_ = snew double*[particlesSize_];
-
-    deltaMax_ = snew double[problem_->getNumberOfVariables()];
-    deltaMin_ = snew double[problem_->getNumberOfVariables()];
-    for (int i = 0; i < problem_->getNumberOfVariables(); i++)
-    {
-        deltaMax_[i] = (problem_->getUpperLimit(i) -
-                        problem_->getLowerLimit(i)) / 2.0;
-        deltaMin_[i] = -deltaMax_[i];
-    } // for
+    // Create the swarm (positions, speeds and best positions)
+    swarm_ = snew ParticleSwarm(problem_, particlesSize_);
+    globalBestPosition_ = snew double[problem_->getNumberOfVariables()];
+    r1_ = snew double[particlesSize_];
+    r2_ = snew double[particlesSize_];
 } // initParams
 
 
@@ -96,13 +90,10 @@ void PSO::initParams()
 void PSO::deleteParams()
 {
 
-    for (int i = 0; i < particlesSize_; i++)
-    {
-        delete [] speed_[i];
-    }
-    delete [] speed_;
-    delete [] deltaMax_;
-    delete [] deltaMin_;
+    delete swarm_;
+    delete [] globalBestPosition_;
+    delete [] r1_;
+    delete [] r2_;
     for (int i = 0; i < particles_->size(); i++)
     {
         delete localBest_[i];
@@ -140,90 +131,33 @@ double PSO::constrictionCoefficient(double c1, double c2)
 } // constrictionCoefficient
 
 
-// velocity bounds
-double PSO::velocityConstriction(double v, double * deltaMax,
-                                 double * deltaMin, int variableIndex,
-                                 int particleIndex)
-{
-
-    return v;
-    /*
-    double result;
-
-    double dmax = deltaMax[variableIndex];
-    double dmin = deltaMin[variableIndex];
-
-    result = v;
-
-    if (v > dmax) {
-      result = dmax;
-    }
-
-    if (v < dmin) {
-      result = dmin;
-    }
-
-    return result;
-    */
-} // velocityConstriction
-
-
 /**
  * Update the speed of each particle
  */
 void PSO::computeSpeed(int iter, int miter)
 {
-    double r1, r2;
-    //double W ;
     double C1, C2;
-    double wmax, wmin, deltaMax, deltaMin;
-    XReal * bestGlobal;
 
-    bestGlobal = new XReal(globalBest_) ;
+    XReal bestGlobal(globalBest_);
+    bestGlobal.getValues(globalBestPosition_);
+
+    //Params for velocity equation, drawn for the whole swarm at once
+    ParticleSwarm::randDouble(r1_, particlesSize_, r1Min_, r1Max_);
+    ParticleSwarm::randDouble(r2_, particlesSize_, r2Min_, r2Max_);
+    //C1 = PseudoRandom::randDouble(C1Min_, C1Max_);
+    //C2 = PseudoRandom::randDouble(C2Min_, C2Max_);
+    C1 = 2.05;
+    C2 = 2.05;
+    //W =  PseudoRandom.randDouble(WMin_, WMax_);
+    double constriction = constrictionCoefficient(C1, C2);
 
     for (int i = 0; i < particlesSize_; i++)
     {
-        XReal * particle = new XReal(particles_->get(i)) ;
-        XReal * bestParticle = new XReal(localBest_[i]) ;
-
-        //int bestIndividual = findBestSolution_->execute(particles_) ;
-
-        r1 = PseudoRandom::randDouble(r1Min_, r1Max_);
-        r2 = PseudoRandom::randDouble(r2Min_, r2Max_);
-        //C1 = PseudoRandom::randDouble(C1Min_, C1Max_);
-        //C2 = PseudoRandom::randDouble(C2Min_, C2Max_);
-        C1 = 2.05;
-        C2 = 2.05;
-        //W =  PseudoRandom.randDouble(WMin_, WMax_);
-
-        wmax = WMax_;
-        wmin = WMin_;
-
-        for (int var = 0; var < particle->size(); var++)
-        {
-            //Computing the velocity of this particle
-            speed_[i][var] = constrictionCoefficient(C1, C2) *
-                             (speed_[i][var] +
-                              C1 * r1 * (bestParticle->getValue(var) - particle->getValue(var)) +
-                              C2 * r2 * (bestGlobal->getValue(var) - particle->getValue(var)));
-        }
-
-        /*
-        for (int var = 0; var < particle->size(); var++) {
-          //Computing the velocity of this particle
-          speed_[i][var] = inertiaWeight(iter, miter, wmax, wmin) * speed_[i][var] +
-            C1 * r1 * (bestParticle->getValue(var) - particle->getValue(var)) +
-            C2 * r2 * (bestGlobal->getValue(var) - particle->getValue(var)) ;
-        }
-        */
-
-        delete particle;
-        delete bestParticle;
-
+        //Computing the velocity of this particle
+        swarm_->updateVelocity(i, globalBestPosition_, 1.0, C1 * r1_[i],
+                               C2 * r2_[i], constriction);
     }
 
-    delete bestGlobal;
-
 } // computeSpeed
 
 
@@ -234,26 +168,8 @@ void PSO::computeNewPositions()
 {
     for (int i = 0; i < particlesSize_; i++)
     {
-        //Variable ** particle = particles_->get(i)->getDecisionVariables();
-        XReal * particle = new XReal(particles_->get(i)) ;
-        //particle->move(speed_[i]);
-        for (int var = 0; var < particle->size(); var++)
-        {
-            particle->setValue(var, particle->getValue(var) +  speed_[i][var]) ;
-
-            if (particle->getValue(var) < problem_->getLowerLimit(var))
-            {
-                particle->setValue(var, problem_->getLowerLimit(var));
-                speed_[i][var] = speed_[i][var] * ChVel1_; //
-            }
-            if (particle->getValue(var) > problem_->getUpperLimit(var))
-            {
-                particle->setValue(var, problem_->getUpperLimit(var));
-                speed_[i][var] = speed_[i][var] * ChVel2_; //
-            }
-
-        }
-        delete particle;
+        swarm_->move(i, ChVel1_, ChVel2_);
+        swarm_->storePosition(i, particles_->get(i));
     }
 } // computeNewPositions
 
@@ -266,7 +182,10 @@ void PSO::mopsoMutation(int actualIteration, int totalIterations)
     for (int i = 0; i < particles_->size(); i++)
     {
         if ( (i % 6) == 0)
+        {
             polynomialMutation_->execute(particles_->get(i));
+            swarm_->loadPosition(i, particles_->get(i));
+        }
         //if (i % 3 == 0) { //particles_ mutated with a non-uniform mutation %3
         //  nonUniformMutation_.execute(particles_.get(i));
         //} else if (i % 3 == 1) { //particles_ mutated with a uniform mutation operator
@@ -284,6 +203,8 @@ void PSO::mopsoMutation(int actualIteration, int totalIterations)
  */
 SolutionSet * PSO::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     initParams();
 
@@ -294,7 +215,10 @@ SolutionSet * PSO::execute()
     for (int i = 0; i < particlesSize_; i++)
     {
         Solution * particle = new Solution(problem_);
-        problem_->evaluate(particle);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(particle);
+        }
         evaluations_ ++;
         particles_->add(particle);
         if ((globalBest_ == nullptr) || (particle->getObjective(0) < globalBest_->getObjective(0)))
@@ -308,24 +232,19 @@ SolutionSet * PSO::execute()
     }
 
     //-> Step2. Initialize the speed_ of each particle to 0
-    for (int i = 0; i < particlesSize_; i++)
-    {
-        speed_[i] = snew double[problem_->getNumberOfVariables()];
-        for (int j = 0; j < problem_->getNumberOfVariables(); j++)
-        {
-            speed_[i][j] = 0.0;
-        }
-    }
+    swarm_->resetVelocities();
 
     //-> Step 6. Initialize the memory of each particle
     for (int i = 0; i < particles_->size(); i++)
     {
         Solution * particle = new Solution(particles_->get(i));
         localBest_[i] = particle;
+        swarm_->loadPosition(i, particle);
+        swarm_->saveBestPosition(i);
     }
 
     //-> Step 7. Iterations ..
-    while (iteration_ < maxIterations_)
+    while ((iteration_ < maxIterations_) && !isTerminated(particles_, evaluations_))
     {
         int * bestIndividualPtr = (int*)findBestSolution_->execute(particles_);
         int bestIndividual = *bestIndividualPtr;
@@ -341,6 +260,7 @@ SolutionSet * PSO::execute()
         //Evaluate the new particles_ in new positions
         for (int i = 0; i < particles_->size(); i++)
         {
+            JMETAL_TIME_EVALUATIONS(1);
             Solution * particle = particles_->get(i);
             problem_->evaluate(particle);
             evaluations_ ++;
@@ -356,6 +276,7 @@ SolutionSet * PSO::execute()
                 Solution * particle = new Solution(particles_->get(i));
                 delete localBest_[i];
                 localBest_[i] = particle;
+                swarm_->saveBestPosition(i);
             } // if
             if ((particles_->get(i)->getObjective(0) < globalBest_->getObjective(0)))
             {
@@ -379,5 +300,7 @@ SolutionSet * PSO::execute()
     // Free memory
     deleteParams();
 
+    publishInstrumentation();
+
     return resultPopulation;
 } // execute
@@ -29,6 +29,7 @@
 //#include <QualityIndicator.h>
 #include <SolutionSet.h>
 #include <XReal.h>
+#include <ParticleSwarm.h>
 #include <PseudoRandom.h>
 #include <math.h>
 #include <string>
@@ -67,9 +68,19 @@ private:
      */
     Solution * globalBest_;
     /**
-     * Stores the speed_ of each particle
+     * Stores the positions, speeds and best positions of the particles
      */
-    double ** speed_;
+    ParticleSwarm * swarm_;
+    /**
+     * Stores the position of the global best solution
+     */
+    double * globalBestPosition_;
+    /**
+     * Stores the random coefficients of the velocity equation, one per
+     * particle
+     */
+    double * r1_;
+    double * r2_;
     /**
      * Stores a operator for non uniform mutations
      */
@@ -98,17 +109,11 @@ private:
     double ChVel2_;
 
     SolutionSet * trueFront_;
-    double * deltaMax_;
-    double * deltaMin_;
     bool success_;
 
     double inertiaWeight(int iter, int miter, double wmax,
                          double wmin);
     double constrictionCoefficient(double c1, double c2);
-    double velocityConstriction(double v, double * deltaMax,
-                                double * deltaMin,
-                                int variableIndex,
-                                int particleIndex);
     void computeSpeed(int iter, int miter);
     void computeNewPositions();
     void mopsoMutation(int actualIteration, int totalIterations);
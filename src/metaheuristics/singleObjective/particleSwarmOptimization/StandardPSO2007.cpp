@@ -86,10 +86,10 @@ void StandardPSO2007::initParams()
 
     swarm_ = new SolutionSet(swarmSize_);
     localBest_ = new Solution*[swarmSize_];
-    neighborhoodBest_ = new Solution*[swarmSize_];
+    neighborhoodBest_ = new int[swarmSize_];
 
-    // Create the speed_ vector
-    speed_ = snew double*[swarmSize_];
+    // Create the positions, speeds and best positions of the particles
+    particles_ = snew ParticleSwarm(problem_, swarmSize_);
 } // initParams
 
 
@@ -101,23 +101,30 @@ void StandardPSO2007::deleteParams()
     delete swarm_;
     delete [] localBest_;
     delete [] neighborhoodBest_;
-    delete [] speed_;
+    delete particles_;
 } // deleteParams
 
 
-Solution * StandardPSO2007::getNeighborBest(int i)
+/**
+ * Returns the index of the particle with the best local best among the
+ * neighbours of particle i
+ */
+int StandardPSO2007::getNeighborBest(int i)
 {
-    Solution * bestLocalBestSolution = nullptr ;
+    int bestLocalBestIndex = -1 ;
+    const int * neighbors = neighborhood_->getNeighborIndices(i);
+    int numberOfNeighbors = neighborhood_->getNumberOfNeighbors(i);
 
-    for (int index : neighborhood_->getNeighbors(i))
+    for (int j = 0; j < numberOfNeighbors; j++)
     {
-        if ((bestLocalBestSolution == nullptr) || (bestLocalBestSolution->getObjective(0) > localBest_[index]->getObjective(0)))
+        int index = neighbors[j];
+        if ((bestLocalBestIndex == -1) || (localBest_[bestLocalBestIndex]->getObjective(0) > localBest_[index]->getObjective(0)))
         {
-            bestLocalBestSolution = localBest_[index] ;
+            bestLocalBestIndex = index ;
         }
     }
 
-    return bestLocalBestSolution ;
+    return bestLocalBestIndex ;
 } // getNeighborBest
 
 
@@ -127,38 +134,16 @@ void StandardPSO2007::computeSpeed()
 
     for (int i = 0; i < swarmSize_; i++)
     {
-
-        XReal * particle = new XReal(swarm_->get(i)) ;
-        XReal * localBest = new XReal(localBest_[i]) ;
-        XReal * neighborhoodBest = new XReal(neighborhoodBest_[i]) ;
-        //XReal * neighborhoodBest = new XReal(globalBest_) ;
+        int neighborhoodBest = neighborhoodBest_[i];
 
         r1 = PseudoRandom::randDouble(0, C_);
         r2 = PseudoRandom::randDouble(0, C_);
 
-        //W_ = 0.9 ;
-        if (localBest_[i] != neighborhoodBest_[i])
-        {
-            for (int var = 0; var < particle->getNumberOfDecisionVariables(); var++)
-            {
-                speed_[i][var] = W_ * speed_[i][var] +
-                                 r1 * (localBest->getValue(var) - particle->getValue(var)) +
-                                 r2 * (neighborhoodBest->getValue(var) - particle->getValue(var));
-            }
-        }
-        else
-        {
-            for (int var = 0; var < particle->getNumberOfDecisionVariables(); var++)
-            {
-                speed_[i][var] = W_* speed_[i][var] +
-                                 r1 * (localBest->getValue(var) - particle->getValue(var)) ;
-            }
-        }
-
-        delete particle;
-        delete localBest;
-        delete neighborhoodBest;
-
+        // The social term is dropped when the particle is the best of its
+        // neighbourhood
+        particles_->updateVelocity(i, particles_->getBestPosition(neighborhoodBest),
+                                   W_, r1, (neighborhoodBest != i) ? r2 : 0.0,
+                                   1.0);
     }
 } // computeSpeed
 
@@ -170,24 +155,8 @@ void StandardPSO2007::computeNewPositions()
 {
     for (int i = 0; i < swarmSize_; i++)
     {
-        //Variable[] particle = swarm_.get(i).getDecisionVariables();
-        XReal * particle = new XReal(swarm_->get(i)) ;
-        //particle.move(speed_[i]);
-        for (int var = 0; var < particle->size(); var++)
-        {
-            particle->setValue(var, particle->getValue(var) +  speed_[i][var]) ;
-            if (particle->getValue(var) < problem_->getLowerLimit(var))
-            {
-                particle->setValue(var, problem_->getLowerLimit(var));
-                speed_[i][var] = 0;
-            }
-            if (particle->getValue(var) > problem_->getUpperLimit(var))
-            {
-                particle->setValue(var, problem_->getUpperLimit(var));
-                speed_[i][var] = 0;
-            }
-        }
-        delete particle;
+        particles_->move(i, 0.0, 0.0);
+        particles_->storePosition(i, swarm_->get(i));
     }
 } // computeNewPositions
 
@@ -199,13 +168,19 @@ void StandardPSO2007::computeNewPositions()
  */
 SolutionSet * StandardPSO2007::execute()
 {
+    startInstrumentation();
+    startTermination();
+
     initParams();
 
     // Step 1 Create the initial population and evaluate
     for (int i = 0; i < swarmSize_; i++)
     {
         Solution * particle = new Solution(problem_);
-        problem_->evaluate(particle);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(particle);
+        }
         evaluations_ ++ ;
         swarm_->add(particle);
     }
@@ -219,14 +194,14 @@ SolutionSet * StandardPSO2007::execute()
     //-> Step2. Initialize the speed_ of each particle
     for (int i = 0; i < swarmSize_; i++)
     {
-        XReal * particle = new XReal(swarm_->get(i))  ;
-        speed_[i] = snew double[problem_->getNumberOfVariables()];
+        particles_->loadPosition(i, swarm_->get(i));
+        double * position = particles_->getPosition(i);
+        double * speed = particles_->getVelocity(i);
         for (int j = 0; j < problem_->getNumberOfVariables(); j++)
         {
-            speed_[i][j] = (PseudoRandom::randDouble(particle->getLowerBound(j),particle->getUpperBound(j))
-                            - particle->getValue(j))/2.0 ;
+            speed[j] = (PseudoRandom::randDouble(problem_->getLowerLimit(j),problem_->getUpperLimit(j))
+                        - position[j])/2.0 ;
         }
-        delete particle;
     }
 
     //-> Step 6. Initialize the memory of each particle
@@ -234,6 +209,7 @@ SolutionSet * StandardPSO2007::execute()
     {
         Solution * particle = new Solution(swarm_->get(i));
         localBest_[i] = particle;
+        particles_->saveBestPosition(i);
     }
 
     for (int i = 0; i < swarm_->size(); i++)
@@ -254,7 +230,7 @@ SolutionSet * StandardPSO2007::execute()
     }
 
     std::cout << "localBest_i " << localBest_[0]->getObjective(0) << std::endl;
-    std::cout << "neighborhoodBest_i " << getNeighborBest(0)->getObjective(0) << std::endl;
+    std::cout << "neighborhoodBest_i " << localBest_[getNeighborBest(0)]->getObjective(0) << std::endl;
 
     std::cout << "Swarm: " << swarm_ << std::endl;
     swarm_->printObjectives();
@@ -263,7 +239,7 @@ SolutionSet * StandardPSO2007::execute()
 
     double bestFoundFitness = numeric_limits<double>::max();
 
-    while (iteration_ < maxIterations_)
+    while ((iteration_ < maxIterations_) && !isTerminated(swarm_, evaluations_))
     {
         //Compute the speed
         computeSpeed() ;
@@ -274,6 +250,7 @@ SolutionSet * StandardPSO2007::execute()
         //Evaluate the new swarm_ in new positions
         for (int i = 0; i < swarm_->size(); i++)
         {
+            JMETAL_TIME_EVALUATIONS(1);
             Solution * particle = swarm_->get(i);
             problem_->evaluate(particle);
             evaluations_ ++ ;
@@ -287,6 +264,7 @@ SolutionSet * StandardPSO2007::execute()
                 Solution * particle = new Solution(swarm_->get(i));
                 delete localBest_[i];
                 localBest_[i] = particle;
+                particles_->saveBestPosition(i);
             } // if
         }
         for (int i = 0; i < swarm_->size(); i++)
@@ -319,10 +297,6 @@ SolutionSet * StandardPSO2007::execute()
     delete bestSolutionIdx;
 
     // Free memory
-    for (int i = 0; i < swarmSize_; i++)
-    {
-        delete [] speed_[i];
-    }
     for (int i = 0; i < swarm_->size(); i++)
     {
         delete localBest_[i];
@@ -330,5 +304,7 @@ SolutionSet * StandardPSO2007::execute()
     delete neighborhood_;
     deleteParams();
 
+    publishInstrumentation();
+
     return resultPopulation ;
 } // execute
@@ -27,6 +27,7 @@
 #include <Problem.h>
 #include <SolutionSet.h>
 #include <XReal.h>
+#include <ParticleSwarm.h>
 #include <Comparator.h>
 #include <ObjectiveComparator.h>
 #include <BestSolutionSelection.h>
@@ -48,8 +49,8 @@ private:
     int iteration_;
     int numberOfParticlesToInform_ ; // Referred a K in the SPSO document
     Solution ** localBest_;
-    Solution ** neighborhoodBest_;
-    double ** speed_;
+    int * neighborhoodBest_;
+    ParticleSwarm * particles_;
     AdaptiveRandomNeighborhood * neighborhood_ ;
 
     int evaluations_ ;
@@ -66,7 +67,7 @@ private:
 
     void initParams();
     void deleteParams();
-    Solution * getNeighborBest(int i);
+    int getNeighborBest(int i);
     void computeSpeed();
     void computeNewPositions();
 
@@ -87,10 +87,13 @@ void StandardPSO2011::initParams()
 
     swarm_ = new SolutionSet(swarmSize_);
     localBest_ = new Solution*[swarmSize_];
-    neighborhoodBest_ = new Solution*[swarmSize_];
+    neighborhoodBest_ = new int[swarmSize_];
 
-    // Create the speed_ vector
-    speed_ = snew double*[swarmSize_];
+    // Create the positions, speeds and best positions of the particles, and
+    // the buffers used to compute the speeds
+    particles_ = snew ParticleSwarm(problem_, swarmSize_);
+    gravityCenter_.resize(problem_->getNumberOfVariables());
+    randomPoint_.resize(problem_->getNumberOfVariables());
 } // initParams
 
 
@@ -102,89 +105,82 @@ void StandardPSO2011::deleteParams()
     delete swarm_;
     delete [] localBest_;
     delete [] neighborhoodBest_;
-    delete [] speed_;
+    delete particles_;
 } // deleteParams
 
 
-Solution * StandardPSO2011::getNeighborBest(int i)
+/**
+ * Returns the index of the particle with the best local best among the
+ * neighbours of particle i
+ */
+int StandardPSO2011::getNeighborBest(int i)
 {
-    Solution * bestLocalBestSolution = nullptr ;
+    int bestLocalBestIndex = -1 ;
+    const int * neighbors = neighborhood_->getNeighborIndices(i);
+    int numberOfNeighbors = neighborhood_->getNumberOfNeighbors(i);
 
-    for (int index : neighborhood_->getNeighbors(i))
+    for (int j = 0; j < numberOfNeighbors; j++)
     {
-        if ((bestLocalBestSolution == nullptr) || (bestLocalBestSolution->getObjective(0) > localBest_[index]->getObjective(0)))
+        int index = neighbors[j];
+        if ((bestLocalBestIndex == -1) || (localBest_[bestLocalBestIndex]->getObjective(0) > localBest_[index]->getObjective(0)))
         {
-            bestLocalBestSolution = localBest_[index] ;
+            bestLocalBestIndex = index ;
         }
     }
 
-    return bestLocalBestSolution ;
+    return bestLocalBestIndex ;
 } // getNeighborBest
 
 
+/**
+ * Computes the speed of each particle: a point is drawn uniformly in the
+ * hypersphere centred on the gravity centre of the particle, its local best
+ * and its neighbourhood best, and passing through the particle
+ */
 void StandardPSO2011::computeSpeed()
 {
+    int numberOfVariables = particles_->getNumberOfVariables();
+    double * gravityCenter = gravityCenter_.data();
+    double * random = randomPoint_.data();
 
     for (int i = 0; i < swarmSize_; i++)
     {
-        XReal * particle = new XReal(swarm_->get(i)) ;
-        XReal * localBest = new XReal(localBest_[i]) ;
-        XReal * neighborhoodBest = new XReal(neighborhoodBest_[i]) ;
+        const double * particle = particles_->getPosition(i);
+        const double * localBest = particles_->getBestPosition(i);
+        const double * neighborhoodBest = particles_->getBestPosition(neighborhoodBest_[i]);
+        double * speed = particles_->getVelocity(i);
 
-        Solution * gravityCenterSolution = new Solution(problem_);
-        XReal * gravityCenter = new XReal(gravityCenterSolution) ;
-        Solution * randomParticleSolution = new Solution(swarm_->get(i));
-        XReal * randomParticle = new XReal (randomParticleSolution) ;
-
-        if (localBest_[i] != neighborhoodBest_[i])
+        if (neighborhoodBest_[i] != i)
         {
-            for (int var = 0; var < particle->size(); var++)
+            for (int var = 0; var < numberOfVariables; var++)
             {
-                double G;
-                G = particle->getValue(var) +
-                    C_ * (localBest->getValue(var) + neighborhoodBest->getValue(var) - 2 * particle->getValue(var)) / 3.0;
-
-                gravityCenter->setValue(var, G);
+                gravityCenter[var] = particle[var] +
+                                     C_ * (localBest[var] + neighborhoodBest[var] - 2 * particle[var]) / 3.0;
             }
         }
         else
         {
-            for (int var = 0; var < particle->size(); var++)
+            for (int var = 0; var < numberOfVariables; var++)
             {
-                double G;
-                G = particle->getValue(var) +
-                    C_ * (localBest->getValue(var) - particle->getValue(var)) / 2.0;
-
-                gravityCenter->setValue(var, G);
+                gravityCenter[var] = particle[var] +
+                                     C_ * (localBest[var] - particle[var]) / 2.0;
             }
         }
 
-        double radius = 0;
-        Distance * distance = new Distance();
-        radius = distance->distanceBetweenSolutions(gravityCenter->getSolution(), particle->getSolution());
-        delete distance;
-
-        double * random = PseudoRandom::randSphere(problem_->getNumberOfVariables()) ;
-        for (int var = 0; var < particle->size(); var++)
+        double radius = 0.0;
+        for (int var = 0; var < numberOfVariables; var++)
         {
-            randomParticle->setValue(var, gravityCenter->getValue(var) + radius*random[var]) ;
+            double diff = gravityCenter[var] - particle[var];
+            radius += diff * diff;
         }
-        delete [] random;
+        radius = sqrt(radius);
 
-        for (int var = 0; var < particle->getNumberOfDecisionVariables(); var++)
+        PseudoRandom::randSphere(numberOfVariables, random);
+        for (int var = 0; var < numberOfVariables; var++)
         {
-            speed_[i][var] = W_*speed_[i][var] + randomParticle->getValue(var) - particle->getValue(var);
+            double randomParticle = gravityCenter[var] + radius * random[var];
+            speed[var] = W_ * speed[var] + randomParticle - particle[var];
         }
-
-        delete particle;
-        delete localBest;
-        delete neighborhoodBest;
-
-        delete gravityCenterSolution;
-        delete gravityCenter;
-        delete randomParticleSolution;
-        delete randomParticle;
-
     }
 } // computeSpeed
 
@@ -196,24 +192,8 @@ void StandardPSO2011::computeNewPositions()
 {
     for (int i = 0; i < swarmSize_; i++)
     {
-        //Variable[] particle = swarm_.get(i).getDecisionVariables();
-        XReal * particle = new XReal(swarm_->get(i)) ;
-        //particle.move(speed_[i]);
-        for (int var = 0; var < particle->size(); var++)
-        {
-            particle->setValue(var, particle->getValue(var) +  speed_[i][var]) ;
-            if (particle->getValue(var) < problem_->getLowerLimit(var))
-            {
-                particle->setValue(var, problem_->getLowerLimit(var));
-                speed_[i][var] = ChVel_ * speed_[i][var];
-            }
-            if (particle->getValue(var) > problem_->getUpperLimit(var))
-            {
-                particle->setValue(var, problem_->getUpperLimit(var));
-                speed_[i][var] = ChVel_ * speed_[i][var];
-            }
-        }
-        delete particle;
+        particles_->move(i, ChVel_, ChVel_);
+        particles_->storePosition(i, swarm_->get(i));
     }
 } // computeNewPositions
 
@@ -225,13 +205,19 @@ void StandardPSO2011::computeNewPositions()
  */
 SolutionSet * StandardPSO2011::execute()
 {
+    startInstrumentation();
+    startTermination();
+
     initParams();
 
     // Step 1 Create the initial population and evaluate
     for (int i = 0; i < swarmSize_; i++)
     {
         Solution * particle = new Solution(problem_);
-        problem_->evaluate(particle);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(particle);
+        }
         evaluations_ ++ ;
         swarm_->add(particle);
     }
@@ -245,15 +231,15 @@ SolutionSet * StandardPSO2011::execute()
     //-> Step2. Initialize the speed_ of each particle
     for (int i = 0; i < swarmSize_; i++)
     {
-        XReal * particle = new XReal(swarm_->get(i))  ;
-        speed_[i] = snew double[problem_->getNumberOfVariables()];
+        particles_->loadPosition(i, swarm_->get(i));
+        double * position = particles_->getPosition(i);
+        double * speed = particles_->getVelocity(i);
         for (int j = 0; j < problem_->getNumberOfVariables(); j++)
         {
-            speed_[i][j] = (PseudoRandom::randDouble(
-                                particle->getLowerBound(j) - particle->getValue(0),
-                                particle->getUpperBound(j) - particle->getValue(0))) ;
+            speed[j] = (PseudoRandom::randDouble(
+                            problem_->getLowerLimit(j) - position[0],
+                            problem_->getUpperLimit(j) - position[0])) ;
         }
-        delete particle;
     }
 
     //-> Step 6. Initialize the memory of each particle
@@ -261,6 +247,7 @@ SolutionSet * StandardPSO2011::execute()
     {
         Solution * particle = new Solution(swarm_->get(i));
         localBest_[i] = particle;
+        particles_->saveBestPosition(i);
     }
 
     for (int i = 0; i < swarm_->size(); i++)
@@ -281,7 +268,7 @@ SolutionSet * StandardPSO2011::execute()
     }
 
     std::cout << "localBest_i " << localBest_[0]->getObjective(0) << std::endl;
-    std::cout << "neighborhoodBest_i " << getNeighborBest(0)->getObjective(0) << std::endl;
+    std::cout << "neighborhoodBest_i " << localBest_[getNeighborBest(0)]->getObjective(0) << std::endl;
 
     std::cout << "Swarm: " << swarm_ << std::endl;
     swarm_->printObjectives();
@@ -290,7 +277,7 @@ SolutionSet * StandardPSO2011::execute()
 
     double bestFoundFitness = numeric_limits<double>::max();
 
-    while (iteration_ < maxIterations_)
+    while ((iteration_ < maxIterations_) && !isTerminated(swarm_, evaluations_))
     {
         //Compute the speed
         computeSpeed() ;
@@ -301,19 +288,29 @@ SolutionSet * StandardPSO2011::execute()
         //Evaluate the new swarm_ in new positions
         for (int i = 0; i < swarm_->size(); i++)
         {
+            JMETAL_TIME_EVALUATIONS(1);
             Solution * particle = swarm_->get(i);
             problem_->evaluate(particle);
             evaluations_ ++ ;
         }
 
-        //Update the memory of the particles
+        //Update the memory of the particles. The local bests are overwritten
+        //in place rather than copied
         for (int i = 0; i < swarm_->size(); i++)
         {
-            if ((swarm_->get(i)->getObjective(0) < localBest_[i]->getObjective(0)))
+            Solution * particle = swarm_->get(i);
+            if ((particle->getObjective(0) < localBest_[i]->getObjective(0)))
             {
-                Solution * particle = new Solution(swarm_->get(i));
-                delete localBest_[i];
-                localBest_[i] = particle;
+                particles_->saveBestPosition(i);
+                particles_->storePosition(i, localBest_[i]);
+                for (int j = 0; j < problem_->getNumberOfObjectives(); j++)
+                {
+                    localBest_[i]->setObjective(j, particle->getObjective(j));
+                }
+                localBest_[i]->setOverallConstraintViolation(
+                    particle->getOverallConstraintViolation());
+                localBest_[i]->setNumberOfViolatedConstraints(
+                    particle->getNumberOfViolatedConstraints());
             } // if
         }
         for (int i = 0; i < swarm_->size(); i++)
@@ -346,10 +343,6 @@ SolutionSet * StandardPSO2011::execute()
     delete bestSolutionIdx;
 
     // Free memory
-    for (int i = 0; i < swarmSize_; i++)
-    {
-        delete [] speed_[i];
-    }
     for (int i = 0; i < swarm_->size(); i++)
     {
         delete localBest_[i];
@@ -357,5 +350,7 @@ SolutionSet * StandardPSO2011::execute()
     delete neighborhood_;
     deleteParams();
 
+    publishInstrumentation();
+
     return resultPopulation ;
 } // execute
@@ -32,11 +32,18 @@
 #include <ObjectiveComparator.h>
 #include <BestSolutionSelection.h>
 #include <AdaptiveRandomNeighborhood.h>
+#include <ParticleSwarm.h>
+#include <vector>
 
 #include <math.h>
 
 /**
  * Class implementing a Standard PSO 2011 algorithm
+ *
+ * The positions, velocities and personal best positions of the particles are
+ * kept in a <code>ParticleSwarm</code>, and the gravity centre and the point
+ * sampled in its hypersphere in preallocated buffers, so an iteration does
+ * not allocate memory.
  */
 class StandardPSO2011 : public Algorithm
 {
@@ -49,8 +56,10 @@ private:
     int iteration_;
     int numberOfParticlesToInform_ ; // Referred a K in the SPSO document
     Solution ** localBest_;
-    Solution ** neighborhoodBest_;
-    double ** speed_;
+    int * neighborhoodBest_;
+    ParticleSwarm * particles_;
+    std::vector<double> gravityCenter_;
+    std::vector<double> randomPoint_;
     AdaptiveRandomNeighborhood * neighborhood_ ;
 
     int evaluations_ ;
@@ -68,7 +77,7 @@ private:
 
     void initParams();
     void deleteParams();
-    Solution * getNeighborBest(int i);
+    int getNeighborBest(int i);
     void computeSpeed();
     void computeNewPositions();
 
@@ -0,0 +1,280 @@
+//  ParallelRestarts.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <ParallelRestarts.h>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <ctime>
+#include <limits>
+
+
+/**
+ * Constructor
+ * @param problem Problem to solve. It is only used to describe the problem;
+ * every restart works on the instance created by the factory
+ * @param factory Creates the algorithm run by each restart
+ */
+ParallelRestarts::ParallelRestarts(Problem * problem, AlgorithmFactory factory)
+    : Algorithm(problem), remainingEvaluations_(0), restartsRun_(0),
+      bestFitness_(0.0)
+{
+    factory_ = factory;
+    maxEvaluations_ = 0;
+    best_ = nullptr;
+    bestAlgorithm_ = nullptr;
+    terminated_ = false;
+} // ParallelRestarts
+
+
+/**
+ * Destructor. Deletes the restart that found the best solution, which is
+ * kept alive because the returned solution refers to its problem
+ */
+ParallelRestarts::~ParallelRestarts()
+{
+    delete best_;
+    delete bestAlgorithm_;
+} // ~ParallelRestarts
+
+
+SolutionSet * ParallelRestarts::execute()
+{
+    startInstrumentation();
+    startTermination();
+
+    int maxEvaluations = *(int *) getInputParameter("maxEvaluations");
+    numberOfRestarts_ = *(int *) getInputParameter("numberOfRestarts");
+
+    restartEvaluations_ = maxEvaluations / numberOfRestarts_;
+    if (getInputParameter("restartEvaluations") != nullptr)
+    {
+        restartEvaluations_ = *(int *) getInputParameter("restartEvaluations");
+    }
+    int numberOfThreads = 1;
+    if (getInputParameter("numberOfThreads") != nullptr)
+    {
+        numberOfThreads = *(int *) getInputParameter("numberOfThreads");
+    }
+    seed_ = (unsigned long long) time(nullptr);
+    if (getInputParameter("seed") != nullptr)
+    {
+        seed_ = *(int *) getInputParameter("seed");
+    }
+    useTarget_ = false;
+    if (getInputParameter("targetFitness") != nullptr)
+    {
+        useTarget_ = true;
+        targetFitness_ = *(double *) getInputParameter("targetFitness");
+    }
+
+    delete best_;
+    delete bestAlgorithm_;
+    best_ = nullptr;
+    bestAlgorithm_ = nullptr;
+    bestFitness_ = std::numeric_limits<double>::max();
+    maxEvaluations_ = maxEvaluations;
+    remainingEvaluations_ = maxEvaluations;
+    restartsRun_ = 0;
+    terminated_ = false;
+    budgets_.assign(numberOfRestarts_, 0);
+    iterations_.assign(numberOfRestarts_, 0);
+
+    ThreadPool pool(numberOfThreads);
+    pool.parallelFor(numberOfRestarts_, [this](int restart)
+    {
+        runRestart(restart);
+    });
+
+    restarts_ = restartsRun_;
+    evaluations_ = maxEvaluations - std::max(0, remainingEvaluations_.load());
+    setOutputParameter("evaluations", &evaluations_);
+    setOutputParameter("restarts", &restarts_);
+
+    SolutionSet * resultPopulation = snew SolutionSet(1);
+    if (best_ != nullptr)
+    {
+        resultPopulation->add(snew Solution(best_));
+    }
+
+    publishInstrumentation();
+
+    return resultPopulation;
+} // execute
+
+
+/**
+ * Runs a restart, if there is budget left and the target has not been
+ * reached yet
+ * @param restart Index of the restart
+ */
+void ParallelRestarts::runRestart(int restart)
+{
+    if (useTarget_ && (bestFitness_.load() <= targetFitness_))
+    {
+        return;
+    }
+    if (isRestartTerminated())
+    {
+        return;
+    }
+
+    // Claim the budget of the restart
+    int available = remainingEvaluations_.fetch_sub(restartEvaluations_);
+    if (available <= 0)
+    {
+        return;
+    }
+    budgets_[restart] = std::min(restartEvaluations_, available);
+    restartsRun_++;
+
+    RandomGenerator generator(RandomGenerator::streamSeed(seed_, restart));
+    PseudoRandom::setRandomGenerator(&generator);
+
+    Algorithm * algorithm = factory_(restart);
+    algorithm->setInputParameter("maxEvaluations", &budgets_[restart]);
+    if (algorithm->getInputParameter("swarmSize") != nullptr)
+    {
+        int swarmSize = *(int *) algorithm->getInputParameter("swarmSize");
+        iterations_[restart] = std::max(1, budgets_[restart] / swarmSize - 1);
+        algorithm->setInputParameter("maxIterations", &iterations_[restart]);
+    }
+
+    SolutionSet * result = algorithm->execute();
+
+    int index = -1;
+    for (int i = 0; i < result->size(); i++)
+    {
+        if ((index == -1) ||
+                (result->get(i)->getObjective(0) < result->get(index)->getObjective(0)))
+        {
+            index = i;
+        }
+    }
+
+    if (index != -1)
+    {
+        Solution * solution = result->get(index);
+        result->remove(index);
+        updateBest(algorithm, solution);
+    }
+    else
+    {
+        delete algorithm;
+    }
+    delete result;
+
+    PseudoRandom::setRandomGenerator(nullptr);
+} // runRestart
+
+
+/**
+ * Keeps a solution if it is the best one found so far. Otherwise, the
+ * solution and the algorithm that found it are deleted
+ * @param algorithm The algorithm of the restart
+ * @param solution The best solution of the restart
+ */
+void ParallelRestarts::updateBest(Algorithm * algorithm, Solution * solution)
+{
+    double fitness = solution->getObjective(0);
+
+    if (fitness < bestFitness_.load())
+    {
+        std::unique_lock<std::mutex> lock(bestMutex_);
+        if ((best_ == nullptr) || (fitness < best_->getObjective(0)))
+        {
+            std::swap(best_, solution);
+            std::swap(bestAlgorithm_, algorithm);
+            bestFitness_ = fitness;
+        }
+    }
+
+    // Either the discarded restart or the previous best one
+    delete solution;
+    delete algorithm;
+} // updateBest
+
+
+/**
+ * Checks the termination criteria on the best solution found so far. The
+ * criteria keep state, so they are checked by one restart at a time
+ * @return true if no new restart must be started
+ */
+bool ParallelRestarts::isRestartTerminated()
+{
+    std::unique_lock<std::mutex> lock(terminationMutex_);
+    if (terminated_)
+    {
+        return true;
+    }
+
+    SolutionSet best(1);
+    {
+        std::unique_lock<std::mutex> bestLock(bestMutex_);
+        if (best_ != nullptr)
+        {
+            best.add(snew Solution(best_));
+        }
+    }
+    long evaluations = maxEvaluations_ - std::max(0, remainingEvaluations_.load());
+    terminated_ = isTerminated(&best, evaluations);
+    return terminated_;
+} // isRestartTerminated
+
+
+/**
+ * Population size of a restart in the IPOP strategy: it is doubled on every
+ * restart
+ * @param populationSize Population size of the first run
+ * @param restart Index of the restart
+ */
+int ParallelRestarts::ipopPopulationSize(int populationSize, int restart)
+{
+    int size = populationSize;
+    for (int i = 0; (i < restart) && (size <= INT_MAX / 2); i++)
+    {
+        size *= 2;
+    }
+    return size;
+} // ipopPopulationSize
+
+
+/**
+ * Population size of a restart in the BIPOP strategy. Even restarts belong
+ * to the large population regime (IPOP doubling); odd restarts belong to the
+ * small population regime and draw a size between the default one and half
+ * the size of the next large restart. It must be called from the thread
+ * running the restart, as it uses its random stream.
+ * @param populationSize Population size of the first run
+ * @param restart Index of the restart
+ */
+int ParallelRestarts::bipopPopulationSize(int populationSize, int restart)
+{
+    if (restart % 2 == 0)
+    {
+        return ipopPopulationSize(populationSize, restart / 2);
+    }
+
+    int large = ipopPopulationSize(populationSize, (restart + 1) / 2);
+    double u = PseudoRandom::randDouble();
+    double ratio = 0.5 * large / populationSize;
+    return std::max(populationSize,
+                    (int) floor(populationSize * pow(ratio, u * u)));
+} // bipopPopulationSize
@@ -0,0 +1,111 @@
+//  ParallelRestarts.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __PARALLEL_RESTARTS__
+#define __PARALLEL_RESTARTS__
+
+#include <Algorithm.h>
+#include <Problem.h>
+#include <SolutionSet.h>
+#include <PseudoRandom.h>
+#include <RandomGenerator.h>
+#include <ThreadPool.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+/**
+ * This class runs independent restarts of a single-objective algorithm
+ * (CMAES, DE, gGA, ssGA, PSO, StandardPSO2011...) concurrently and returns
+ * the best solution found by any of them.
+ *
+ * The restarts are created by a factory, which receives the index of the
+ * restart. Each restart must get its own Problem instance, because an
+ * Algorithm deletes its problem when it is destroyed. The factory is called
+ * on the thread that runs the restart, after its random stream has been
+ * installed, so it can draw random numbers (e.g. a BIPOP population size).
+ *
+ * Input parameters:
+ *  - maxEvaluations (int): total budget shared by all the restarts
+ *  - numberOfRestarts (int): maximum number of restarts
+ *  - restartEvaluations (int, optional): budget of each restart. By default
+ *    maxEvaluations / numberOfRestarts
+ *  - numberOfThreads (int, optional): 1 by default
+ *  - seed (int, optional): base seed of the random streams of the restarts.
+ *    By default it is taken from the clock
+ *  - targetFitness (double, optional): no new restart is started once a
+ *    solution this good has been found
+ *
+ * Termination criteria (addTerminationCriterion) are checked before each
+ * restart, on the best solution found so far and the budget claimed so far.
+ * Once one is met, no new restart is started.
+ *
+ * Each restart receives its budget in the "maxEvaluations" input parameter.
+ * Algorithms configured with a "swarmSize" also receive it as
+ * "maxIterations".
+ *
+ * Output parameters: "evaluations" and "restarts" (int), the budget claimed
+ * and the number of restarts actually run.
+ */
+class ParallelRestarts : public Algorithm
+{
+
+public:
+    using AlgorithmFactory = std::function<Algorithm * (int restart)>;
+
+private:
+    AlgorithmFactory factory_;
+    int numberOfRestarts_;
+    int restartEvaluations_;
+    unsigned long long seed_;
+    bool useTarget_;
+    double targetFitness_;
+    int maxEvaluations_;
+    int evaluations_;
+    int restarts_;
+
+    std::atomic<int> remainingEvaluations_;
+    std::atomic<int> restartsRun_;
+    std::atomic<double> bestFitness_;
+    std::mutex bestMutex_;
+    Solution * best_;
+    Algorithm * bestAlgorithm_;
+    std::mutex terminationMutex_;
+    bool terminated_;
+
+    JMetal::VectorOfInteger budgets_;
+    JMetal::VectorOfInteger iterations_;
+
+    void runRestart(int restart);
+    void updateBest(Algorithm * algorithm, Solution * solution);
+    bool isRestartTerminated();
+
+public:
+    ParallelRestarts(Problem * problem, AlgorithmFactory factory);
+    ~ParallelRestarts();
+    SolutionSet * execute();
+
+    static int ipopPopulationSize(int populationSize, int restart);
+    static int bipopPopulationSize(int populationSize, int restart);
+
+}; // ParallelRestarts
+
+#endif /* __PARALLEL_RESTARTS__ */
@@ -77,20 +77,13 @@ void SMPSO::initParams()
     crowdingDistanceComparator_ = new CrowdingDistanceComparator();
     distance_ = new Distance();
 
-    // Create the speed_ vector
-    int numberOfVariables = problem_->getNumberOfVariables();
-    //speed_ = snew double[swarmSize_][numberOfVariables];
-    speed_ = snew double*[swarmSize_];
-    // TODO: Liberar memoria al finalizar
-
-    deltaMax_ = snew double[problem_->getNumberOfVariables()];
-    deltaMin_ = snew double[problem_->getNumberOfVariables()];
-    for (int i = 0; i < problem_->getNumberOfVariables(); i++)
-    {
-        deltaMax_[i] = (problem_->getUpperLimit(i) -
-                        problem_->getLowerLimit(i)) / 2.0;
-        deltaMin_[i] = -deltaMax_[i];
-    } // for
+    // Create the swarm (positions, speeds and best positions)
+    swarm_ = snew ParticleSwarm(problem_, swarmSize_);
+    globalBest_ = snew double[problem_->getNumberOfVariables()];
+    r1_ = snew double[swarmSize_];
+    r2_ = snew double[swarmSize_];
+    C1_ = snew double[swarmSize_];
+    C2_ = snew double[swarmSize_];
 } // initParams
 
 /**
@@ -136,16 +129,15 @@ void SMPSO::setAlgParams()
 void SMPSO::deleteParams()
 {
 
-    for (int i = 0; i < swarmSize_; i++)
-    {
-        delete [] speed_[i];
-    }
-    delete [] speed_;
+    delete swarm_;
+    delete [] globalBest_;
+    delete [] r1_;
+    delete [] r2_;
+    delete [] C1_;
+    delete [] C2_;
     delete dominance_;
     delete crowdingDistanceComparator_;
     delete distance_;
-    delete [] deltaMax_;
-    delete [] deltaMin_;
     delete particles_;
     for (int i = 0; i < swarmSize_; i++)
     {
@@ -180,47 +172,25 @@ double SMPSO::constrictionCoefficient(double c1, double c2)
 } // constrictionCoefficient
 
 
-// velocity bounds
-double SMPSO::velocityConstriction(double v, double * deltaMax,
-                                   double * deltaMin, int variableIndex,
-                                   int particleIndex)
-{
-
-    double result;
-
-    double dmax = deltaMax[variableIndex];
-    double dmin = deltaMin[variableIndex];
-
-    result = v;
-
-    if (v > dmax)
-    {
-        result = dmax;
-    }
-
-    if (v < dmin)
-    {
-        result = dmin;
-    }
-
-    return result;
-} // velocityConstriction
-
-
 /**
  * Update the speed of each particle
  */
 void SMPSO::computeSpeed(int iter, int miter)
 {
-    double r1, r2, W, C1, C2;
-    double wmax, wmin, deltaMax, deltaMin;
-    XReal * bestGlobal;
+    double wmax, wmin;
+
+    //Params for velocity equation, drawn for the whole swarm at once
+    ParticleSwarm::randDouble(r1_, swarmSize_, r1Min_, r1Max_);
+    ParticleSwarm::randDouble(r2_, swarmSize_, r2Min_, r2Max_);
+    ParticleSwarm::randDouble(C1_, swarmSize_, C1Min_, C1Max_);
+    ParticleSwarm::randDouble(C2_, swarmSize_, C2Min_, C2Max_);
+    //
+    wmax = WMax_;
+    wmin = WMin_;
+    double inertia = inertiaWeight(iter, miter, wmax, wmin);
 
     for (int i = 0; i < swarmSize_; i++)
     {
-        XReal * particle = new XReal(particles_->get(i)) ;
-        XReal * bestParticle = new XReal(best_[i]) ;
-
         //Select a global best_ for calculate the speed of particle i, bestGlobal
         Solution * one;
         Solution * two;
@@ -229,43 +199,14 @@ void SMPSO::computeSpeed(int iter, int miter)
         one = leaders_->get(pos1);
         two = leaders_->get(pos2);
 
-        if (crowdingDistanceComparator_->compare(one, two) < 1)
-        {
-            bestGlobal = new XReal(one);
-        }
-        else
-        {
-            bestGlobal = new XReal(two);
-        }
-        //Params for velocity equation
-        r1 = PseudoRandom::randDouble(r1Min_, r1Max_);
-        r2 = PseudoRandom::randDouble(r2Min_, r2Max_);
-        C1 = PseudoRandom::randDouble(C1Min_, C1Max_);
-        C2 = PseudoRandom::randDouble(C2Min_, C2Max_);
-        W  = PseudoRandom::randDouble(WMin_, WMax_);
-        //
-        wmax = WMax_;
-        wmin = WMin_;
-
-        for (int var = 0; var < particle->getNumberOfDecisionVariables(); var++)
-        {
-            //Computing the velocity of this particle
-            speed_[i][var] = velocityConstriction(constrictionCoefficient(C1, C2) *
-                                                  (inertiaWeight(iter, miter, wmax, wmin) *
-                                                   speed_[i][var] +
-                                                   C1 * r1 * (bestParticle->getValue(var) -
-                                                           particle->getValue(var)) +
-                                                   C2 * r2 * (bestGlobal->getValue(var) -
-                                                           particle->getValue(var))), deltaMax_, //[var],
-                                                  deltaMin_, //[var],
-                                                  var,
-                                                  i);
-        } // for
-
-        delete bestGlobal;
-        delete particle;
-        delete bestParticle;
+        XReal bestGlobal((crowdingDistanceComparator_->compare(one, two) < 1) ? one : two);
+        bestGlobal.getValues(globalBest_);
 
+        //Computing the velocity of this particle
+        swarm_->updateVelocity(i, globalBest_, inertia, C1_[i] * r1_[i],
+                               C2_[i] * r2_[i],
+                               constrictionCoefficient(C1_[i], C2_[i]));
+        swarm_->constrainVelocity(i);
     }// for
 
 } // computeSpeed
@@ -278,23 +219,8 @@ void SMPSO::computeNewPositions()
 {
     for (int i = 0; i < swarmSize_; i++)
     {
-        XReal * particle = new XReal(particles_->get(i)) ;
-        for (int var = 0; var < particle->getNumberOfDecisionVariables(); var++)
-        {
-            particle->setValue(var, particle->getValue(var) +  speed_[i][var]) ;
-
-            if (particle->getValue(var) < problem_->getLowerLimit(var))
-            {
-                particle->setValue(var, problem_->getLowerLimit(var));
-                speed_[i][var] = speed_[i][var] * ChVel1_; //
-            }
-            if (particle->getValue(var) > problem_->getUpperLimit(var))
-            {
-                particle->setValue(var, problem_->getUpperLimit(var));
-                speed_[i][var] = speed_[i][var] * ChVel2_; //
-            }
-        }// for
-        delete particle;
+        swarm_->move(i, ChVel1_, ChVel2_);
+        swarm_->storePosition(i, particles_->get(i));
     }// for
 } // computeNewPositions
 
@@ -307,7 +233,10 @@ void SMPSO::mopsoMutation(int actualIteration, int totalIterations)
     for (int i = 0; i < particles_->size(); i++)
     {
         if ( (i % 6) == 0)
+        {
             polynomialMutation_->execute(particles_->get(i));
+            swarm_->loadPosition(i, particles_->get(i));
+        }
         //if (i % 3 == 0) { //particles_ mutated with a non-uniform mutation %3
         //  nonUniformMutation_.execute(particles_.get(i));
         //} else if (i % 3 == 1) { //particles_ mutated with a uniform mutation operator
@@ -325,52 +254,84 @@ void SMPSO::mopsoMutation(int actualIteration, int totalIterations)
  */
 SolutionSet * SMPSO::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     initParams();
 
     success_ = false;
-    //->Step 1 (and 3) Create the initial population and evaluate
-    for (int i = 0; i < swarmSize_; i++)
+    Checkpoint snapshot;
+    int numberOfVariables = problem_->getNumberOfVariables();
+    if (beginResume(snapshot, "SMPSO"))
     {
-        Solution * particle = new Solution(problem_);
-        problem_->evaluate(particle);
-        problem_->evaluateConstraints(particle);
-        particles_->add(particle);
+        // Continue from a snapshot: the particles, their memories and
+        // velocities, and the leaders with their crowding distances
+        iteration_ = snapshot.readInt();
+        snapshot.readSolutionSet(particles_, problem_);
+        int numberOfLeaders = snapshot.readInt();
+        for (int i = 0; i < numberOfLeaders; i++)
+        {
+            // The leaders are inserted in their original order, so the
+            // archive breaks crowding ties as it did before
+            Solution * leader = snapshot.readSolution(problem_);
+            if (leaders_->add(leader) == false)
+            {
+                delete leader;
+            }
+        }
+        for (int i = 0; i < particles_->size(); i++)
+        {
+            best_[i] = snapshot.readSolution(problem_);
+            swarm_->loadPosition(i, best_[i]);
+            swarm_->saveBestPosition(i);
+            swarm_->loadPosition(i, particles_->get(i));
+            snapshot.readDoubles(swarm_->getVelocity(i), numberOfVariables);
+        }
+        endResume(snapshot);
     }
-
-    //-> Step2. Initialize the speed_ of each particle to 0
-    for (int i = 0; i < swarmSize_; i++)
+    else
     {
-        speed_[i] = snew double[problem_->getNumberOfVariables()];
-        for (int j = 0; j < problem_->getNumberOfVariables(); j++)
+        //->Step 1 (and 3) Create the initial population and evaluate
+        for (int i = 0; i < swarmSize_; i++)
         {
-            speed_[i][j] = 0.0;
+            Solution * particle = new Solution(problem_);
+            particles_->add(particle);
+        }
+        {
+            JMETAL_TIME_EVALUATIONS(particles_->size());
+            problem_->evaluateSolutions(particles_);
         }
-    }
 
-    // Step4 and 5
-    for (int i = 0; i < particles_->size(); i++)
-    {
-        Solution * particle = new Solution(particles_->get(i));
-        bool isAdded = leaders_->add(particle);
-        if (isAdded == false)
+        //-> Step2. Initialize the speed_ of each particle to 0
+        swarm_->resetVelocities();
+
+        // Step4 and 5
+        for (int i = 0; i < particles_->size(); i++)
         {
-            delete particle;
+            Solution * particle = new Solution(particles_->get(i));
+            bool isAdded = leaders_->add(particle);
+            if (isAdded == false)
+            {
+                delete particle;
+            }
         }
-    }
 
-    //-> Step 6. Initialize the memory of each particle
-    for (int i = 0; i < particles_->size(); i++)
-    {
-        Solution * particle = new Solution(particles_->get(i));
-        best_[i] = particle;
-    }
+        //-> Step 6. Initialize the memory of each particle
+        for (int i = 0; i < particles_->size(); i++)
+        {
+            Solution * particle = new Solution(particles_->get(i));
+            best_[i] = particle;
+            swarm_->loadPosition(i, particle);
+            swarm_->saveBestPosition(i);
+        }
 
-    //Crowding the leaders_
-    distance_->crowdingDistanceAssignment(leaders_, problem_->getNumberOfObjectives());
+        //Crowding the leaders_
+        distance_->crowdingDistanceAssignment(leaders_, problem_->getNumberOfObjectives());
+    } // if
 
     //-> Step 7. Iterations ..
-    while (iteration_ < maxIterations_)
+    while ((iteration_ < maxIterations_) &&
+            !isTerminated(leaders_, (long) (iteration_ + 1) * particles_->size()))
     {
 //    try {
 //      //Compute the speed_
@@ -387,11 +348,9 @@ SolutionSet * SMPSO::execute()
         mopsoMutation(iteration_, maxIterations_);
 
         //Evaluate the new particles_ in new positions
-        for (int i = 0; i < particles_->size(); i++)
         {
-            Solution * particle = particles_->get(i);
-            problem_->evaluate(particle);
-            problem_->evaluateConstraints(particle);
+            JMETAL_TIME_EVALUATIONS(particles_->size());
+            problem_->evaluateSolutions(particles_);
         }
 
         //Update the archive
@@ -414,15 +373,51 @@ SolutionSet * SMPSO::execute()
                 Solution * particle = new Solution(particles_->get(i));
                 delete best_[i];
                 best_[i] = particle;
+                swarm_->saveBestPosition(i);
+            }
+        }
+
+        //Exchange leaders with the other islands of an island model. The
+        //swarm has been evaluated iteration_ + 2 times so far
+        SolutionSet * immigrants = exchangeMigrants(leaders_,
+                                   (long) (iteration_ + 2) * particles_->size());
+        if (immigrants != nullptr)
+        {
+            while (immigrants->size() > 0)
+            {
+                Solution * immigrant = immigrants->release(immigrants->size() - 1).release();
+                if (leaders_->add(immigrant) == false)
+                {
+                    delete immigrant;
+                }
             }
+            delete immigrants;
         }
 
         //Assign crowding distance to the leaders_
         distance_->crowdingDistanceAssignment(leaders_,
                                               problem_->getNumberOfObjectives());
         iteration_++;
+
+        //Take a snapshot to resume from
+        long evaluations = (long) (iteration_ + 1) * particles_->size();
+        if ((iteration_ < maxIterations_) && isCheckpointDue(evaluations))
+        {
+            beginCheckpoint(snapshot, "SMPSO", evaluations);
+            snapshot.writeInt(iteration_);
+            snapshot.writeSolutionSet(particles_);
+            snapshot.writeSolutionSet(leaders_);
+            for (int i = 0; i < particles_->size(); i++)
+            {
+                snapshot.writeSolution(best_[i]);
+                snapshot.writeDoubles(swarm_->getVelocity(i), numberOfVariables);
+            }
+            endCheckpoint(snapshot);
+        }
     }
 
+    finishCheckpoints();
+
     // Build the solution set result
     SolutionSet * result = new SolutionSet(leaders_->size());
     for (int i=0; i<leaders_->size(); i++)
@@ -433,5 +428,7 @@ SolutionSet * SMPSO::execute()
     // Free memory
     deleteParams();
 
+    publishInstrumentation();
+
     return result;
 } // execute
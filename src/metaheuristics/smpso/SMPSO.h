@@ -24,12 +24,15 @@
 
 #include <Algorithm.h>
 #include <CrowdingArchive.h>
+#include <CrowdingDistanceComparator.h>
 #include <Distance.h>
 //#include <Hypervolume.h>
 #include <Problem.h>
 //#include <QualityIndicator.h>
 #include <SolutionSet.h>
 #include <XReal.h>
+#include <ParticleSwarm.h>
+#include <Checkpoint.h>
 #include <PseudoRandom.h>
 #include <math.h>
 #include <vector>
@@ -77,9 +80,21 @@ private:
      */
     CrowdingArchive * leaders_;
     /**
-     * Stores the speed_ of each particle
+     * Stores the positions, speeds and best positions of the particles
      */
-    double ** speed_;
+    ParticleSwarm * swarm_;
+    /**
+     * Stores the position of the leader of the current particle
+     */
+    double * globalBest_;
+    /**
+     * Stores the random coefficients of the velocity equation, one per
+     * particle
+     */
+    double * r1_;
+    double * r2_;
+    double * C1_;
+    double * C2_;
     /**
      * Stores a comparator for checking dominance
      */
@@ -115,17 +130,11 @@ private:
     double trueHypervolume_;
     //Hypervolume * hy_;
     SolutionSet * trueFront_;
-    double * deltaMax_;
-    double * deltaMin_;
     bool success_;
 
     double inertiaWeight(int iter, int miter, double wma,
                          double wmin);
     double constrictionCoefficient(double c1, double c2);
-    double velocityConstriction(double v, double * deltaMax,
-                                double * deltaMin,
-                                int variableIndex,
-                                int particleIndex);
     void computeSpeed(int iter, int miter);
     void computeNewPositions();
     void mopsoMutation(int actualIteration, int totalIterations);
@@ -67,23 +67,23 @@ void SMPSOhv::initParams()
     particles     = new SolutionSet(swarmSize);
     best          = new Solution*[swarmSize];
     leaders       = new FastHypervolumeArchive(archiveSize,problem_->getNumberOfObjectives());
+    if (getInputParameter("numberOfSamples") != nullptr)
+    {
+        leaders->setNumberOfSamples(*(int *) getInputParameter("numberOfSamples"));
+    }
 
     // Create the dominator for equadless and dominance
     dominance          = new DominanceComparator();
     crowdingDistanceComparator = new CrowdingDistanceComparator();
     distance           = new Distance();
 
-    // Create the speed_ vector
-    speed = snew double*[swarmSize];
-
-    deltaMax = snew double[problem_->getNumberOfVariables()];
-    deltaMin = snew double[problem_->getNumberOfVariables()];
-    for (int i = 0; i < problem_->getNumberOfVariables(); i++)
-    {
-        deltaMax[i] = (problem_->getUpperLimit(i) -
-                       problem_->getLowerLimit(i)) / 2.0;
-        deltaMin[i] = -deltaMax[i];
-    } // for
+    // Create the swarm (positions, speeds and best positions)
+    swarm      = snew ParticleSwarm(problem_, swarmSize);
+    globalBest = snew double[problem_->getNumberOfVariables()];
+    r1         = snew double[swarmSize];
+    r2         = snew double[swarmSize];
+    C1         = snew double[swarmSize];
+    C2         = snew double[swarmSize];
 } // initParams
 
 
@@ -93,11 +93,12 @@ void SMPSOhv::initParams()
 void SMPSOhv::deleteParams()
 {
 
-    for (int i = 0; i < swarmSize; i++)
-    {
-        delete [] speed[i];
-    }
-    delete [] speed;
+    delete swarm;
+    delete [] globalBest;
+    delete [] r1;
+    delete [] r2;
+    delete [] C1;
+    delete [] C2;
     delete dominance;
     delete crowdingDistanceComparator;
     delete distance;
@@ -107,8 +108,6 @@ void SMPSOhv::deleteParams()
         delete best[i];
     }
     delete [] best;
-    delete [] deltaMax;
-    delete [] deltaMin;
     delete leaders;
 
 } // deleteParams
@@ -140,49 +139,26 @@ double SMPSOhv::constrictionCoefficient(double c1, double c2)
     }
 } // constrictionCoefficient
 
-/**
- * velocity bounds
- */
-double SMPSOhv::velocityConstriction(double v, double *deltaMax,
-                                     double *deltaMin, int variableIndex,
-                                     int particleIndex)
-{
-
-    double result;
-
-    double dmax = deltaMax[variableIndex];
-    double dmin = deltaMin[variableIndex];
-
-    result = v;
-
-    if (v > dmax)
-    {
-        result = dmax;
-    }
-
-    if (v < dmin)
-    {
-        result = dmin;
-    }
-
-    return result;
-} // velocityConstriction
-
 
 /**
  * Update the speed of each particle
  */
 void SMPSOhv::computeSpeed(int iter, int miter)
 {
-    double r1, r2, W, C1, C2;
     double wmax, wmin;
-    XReal *bestGlobal;
+
+    //Params for velocity equation, drawn for the whole swarm at once
+    ParticleSwarm::randDouble(r1, swarmSize, r1Min, r1Max);
+    ParticleSwarm::randDouble(r2, swarmSize, r2Min, r2Max);
+    ParticleSwarm::randDouble(C1, swarmSize, C1Min, C1Max);
+    ParticleSwarm::randDouble(C2, swarmSize, C2Min, C2Max);
+
+    wmax = WMax;
+    wmin = WMin;
+    double inertia = inertiaWeight(iter, miter, wmax, wmin);
 
     for (int i = 0; i < swarmSize; i++)
     {
-        XReal *particle     = new XReal(particles->get(i));
-        XReal *bestParticle = new XReal(best[i]);
-
         //Select a global best for calculate the speed of particle i, bestGlobal
         Solution *one, *two;
         int pos1 = PseudoRandom::randInt(0,leaders->size()-1);
@@ -192,42 +168,14 @@ void SMPSOhv::computeSpeed(int iter, int miter)
         one = leaders->get(pos1);
         two = leaders->get(pos2);
 
-        if (crowdingDistanceComparator->compare(one,two) < 1)
-        {
-            bestGlobal = new XReal(one);
-        }
-        else
-        {
-            bestGlobal = new XReal(two);
-        }
+        XReal bestGlobal((crowdingDistanceComparator->compare(one,two) < 1) ? one : two);
+        bestGlobal.getValues(globalBest);
 
-        //Params for velocity equation
-        r1 = PseudoRandom::randDouble(r1Min, r1Max);
-        r2 = PseudoRandom::randDouble(r2Min, r2Max);
-        C1 = PseudoRandom::randDouble(C1Min, C1Max);
-        C2 = PseudoRandom::randDouble(C2Min, C2Max);
-        W  = PseudoRandom::randDouble(WMin, WMax);
-
-        wmax = WMax;
-        wmin = WMin;
-
-        for (int var = 0; var < particle->getNumberOfDecisionVariables(); var++)
-        {
-            //Computing the velocity of this particle
-            speed[i][var] = velocityConstriction(constrictionCoefficient(C1, C2) *
-                                                 (inertiaWeight(iter, miter, wmax, wmin) *
-                                                  speed[i][var] +
-                                                  C1 * r1 * (bestParticle->getValue(var) -
-                                                          particle->getValue(var)) +
-                                                  C2 * r2 * (bestGlobal->getValue(var) -
-                                                          particle->getValue(var))), deltaMax,
-                                                 deltaMin,
-                                                 var,
-                                                 i);
-        }
-        delete bestGlobal;
-        delete particle;
-        delete bestParticle;
+        //Computing the velocity of this particle
+        swarm->updateVelocity(i, globalBest, inertia, C1[i] * r1[i],
+                              C2[i] * r2[i],
+                              constrictionCoefficient(C1[i], C2[i]));
+        swarm->constrainVelocity(i);
     }
 } // computeSpeed
 
@@ -240,23 +188,8 @@ void SMPSOhv::computeNewPositions()
 
     for (int i = 0; i < swarmSize; i++)
     {
-        XReal * particle = new XReal(particles->get(i));
-        for (int var = 0; var < particle->getNumberOfDecisionVariables(); var++)
-        {
-            particle->setValue(var, particle->getValue(var) + speed[i][var]);
-
-            if (particle->getValue(var) < problem_->getLowerLimit(var))
-            {
-                particle->setValue(var, problem_->getLowerLimit(var));
-                speed[i][var] = speed[i][var] * ChVel1;
-            }
-            if (particle->getValue(var) > problem_->getUpperLimit(var))
-            {
-                particle->setValue(var, problem_->getUpperLimit(var));
-                speed[i][var] = speed[i][var] * ChVel2;
-            }
-        }
-        delete particle;
+        swarm->move(i, ChVel1, ChVel2);
+        swarm->storePosition(i, particles->get(i));
     }
 
 } // computeNewPositions
@@ -272,6 +205,7 @@ void SMPSOhv::mopsoMutation(int actualIteration, int totalIterations)
         if ( (i % 6) == 0)
         {
             polynomialMutation->execute(particles->get(i));
+            swarm->loadPosition(i, particles->get(i));
         }
     }
 } // mopsoMutation
@@ -284,6 +218,8 @@ void SMPSOhv::mopsoMutation(int actualIteration, int totalIterations)
  */
 SolutionSet *SMPSOhv::execute()
 {
+    startInstrumentation();
+    startTermination();
 
     initParams();
 
@@ -292,20 +228,16 @@ SolutionSet *SMPSOhv::execute()
     for (int i = 0; i < swarmSize; i++)
     {
         Solution *particle = new Solution(problem_);
-        problem_->evaluate(particle);
-        problem_->evaluateConstraints(particle);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(particle);
+            problem_->evaluateConstraints(particle);
+        }
         particles->add(particle);
     }
 
     //-> Step2. Initialize the speed of each particle to 0
-    for (int i = 0; i < swarmSize; i++)
-    {
-        speed[i] = snew double[problem_->getNumberOfVariables()];
-        for (int j = 0; j < problem_->getNumberOfVariables(); j++)
-        {
-            speed[i][j] = 0.0;
-        }
-    }
+    swarm->resetVelocities();
 
     // Step4 and 5
     for (int i = 0; i < particles->size(); i++)
@@ -322,6 +254,8 @@ SolutionSet *SMPSOhv::execute()
     {
         Solution *particle = new Solution(particles->get(i));
         best[i] = particle;
+        swarm->loadPosition(i, particle);
+        swarm->saveBestPosition(i);
     }
 
     //Crowding the leaders_
@@ -329,7 +263,8 @@ SolutionSet *SMPSOhv::execute()
     leaders->computeHVContribution();
 
     //-> Step 7. Iterations ..
-    while (iteration < maxIterations)
+    while ((iteration < maxIterations) &&
+            !isTerminated(leaders, (long) (iteration + 1) * particles->size()))
     {
         //Compute the speed_
         computeSpeed(iteration, maxIterations);
@@ -343,6 +278,7 @@ SolutionSet *SMPSOhv::execute()
         //Evaluate the new particles in new positions
         for (int i = 0; i < particles->size(); i++)
         {
+            JMETAL_TIME_EVALUATIONS(1);
             Solution *particle = particles->get(i);
             problem_->evaluate(particle);
             problem_->evaluateConstraints(particle);
@@ -367,6 +303,7 @@ SolutionSet *SMPSOhv::execute()
                 Solution *particle = new Solution(particles->get(i));
                 delete best[i];
                 best[i] = particle;
+                swarm->saveBestPosition(i);
             }
         }
 
@@ -383,5 +320,7 @@ SolutionSet *SMPSOhv::execute()
     // Free memory
     deleteParams();
 
+    publishInstrumentation();
+
     return result;
 } // execute
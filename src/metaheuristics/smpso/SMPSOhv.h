@@ -30,6 +30,7 @@
 #include <FastHypervolumeArchive.h>
 #include <Hypervolume.h>
 #include <XReal.h>
+#include <ParticleSwarm.h>
 
 /**
  * This class implements the SMPSOhv algorithm described in:
@@ -77,9 +78,23 @@ private:
     FastHypervolumeArchive *leaders;
 
     /**
-     * Stores the speed of each particle
+     * Stores the positions, speeds and best positions of the particles
      */
-    double **speed;
+    ParticleSwarm *swarm;
+
+    /**
+     * Stores the position of the leader of the current particle
+     */
+    double *globalBest;
+
+    /**
+     * Stores the random coefficients of the velocity equation, one per
+     * particle
+     */
+    double *r1;
+    double *r2;
+    double *C1;
+    double *C2;
 
     /**
      * Stores a comparator for checking dominance
@@ -119,8 +134,6 @@ private:
     double trueHypervolume;
     Hypervolume *hy;
     SolutionSet *trueFront;
-    double *deltaMax;
-    double *deltaMin;
     bool success;
 
     /**
@@ -143,13 +156,6 @@ private:
      */
     double constrictionCoefficient(double c1, double c2);
 
-    /**
-     * velocity bounds
-     */
-    double velocityConstriction(double v, double *deltaMax,
-                                double *deltaMin, int variableIndex,
-                                int particleIndex);
-
     /**
      * Update the speed of each particle
      */
@@ -21,6 +21,7 @@
 
 
 #include <FastSMSEMOA.h>
+#include <SolutionOrder.h>
 
 /*
  * This class implements the SMS-EMOA algorithm using the FastHypervolume
@@ -54,6 +55,9 @@ FastSMSEMOA::~FastSMSEMOA()
 */
 SolutionSet * FastSMSEMOA::execute()
 {
+    startInstrumentation();
+    startTermination();
+
     int populationSize;
     int maxEvaluations;
     int evaluations;
@@ -85,6 +89,10 @@ SolutionSet * FastSMSEMOA::execute()
     requiredEvaluations = 0;
 
     fastHypervolume = snew FastHypervolume(offset);
+    if (getInputParameter("numberOfSamples") != nullptr)
+    {
+        fastHypervolume->setNumberOfSamples(*(int *) getInputParameter("numberOfSamples"));
+    }
 
     //Read the operator
     mutationOperator = operators_["mutation"];
@@ -96,14 +104,17 @@ SolutionSet * FastSMSEMOA::execute()
     for (int i = 0; i < populationSize; i++)
     {
         newSolution = snew Solution(problem_);
-        problem_->evaluate(newSolution);
-        problem_->evaluateConstraints(newSolution);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(newSolution);
+            problem_->evaluateConstraints(newSolution);
+        }
         evaluations++;
         population->add(newSolution);
     } //for
 
     // Generations ...
-    while (evaluations < maxEvaluations)
+    while ((evaluations < maxEvaluations) && !isTerminated(population, evaluations))
     {
 
         // select parents
@@ -133,8 +144,11 @@ SolutionSet * FastSMSEMOA::execute()
         mutationOperator->execute(offSpring[0]);
 
         // evaluation
-        problem_->evaluate(offSpring[0]);
-        problem_->evaluateConstraints(offSpring[0]);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(offSpring[0]);
+            problem_->evaluateConstraints(offSpring[0]);
+        }
 
         // insert child into the offspring population
         offspringPopulation->add(offSpring[0]);
@@ -163,9 +177,7 @@ SolutionSet * FastSMSEMOA::execute()
 
         //FastHypervolume fastHypervolume = new FastHypervolume() ;
         fastHypervolume->computeHVContributions(lastFront);
-        CrowdingDistanceComparator * cd = snew CrowdingDistanceComparator();
-        lastFront->sort(cd);
-        delete cd;
+        lastFront->sortBy(CrowdingDistanceOrder());
 
         // all but the worst are carried over to the survivor population
         SolutionSet * front = nullptr;
@@ -219,6 +231,8 @@ SolutionSet * FastSMSEMOA::execute()
     delete population;
     delete fastHypervolume;
 
+    publishInstrumentation();
+
     return result;
 
 }
@@ -20,6 +20,9 @@
 
 
 #include <SMSEMOA.h>
+#include <SolutionOrder.h>
+#include <algorithm>
+#include <limits>
 
 /*
  * This class implements the SMS-EMOA algorithm.
@@ -32,8 +35,8 @@
  */
 SMSEMOA::SMSEMOA(Problem *problem) : Algorithm(problem)
 {
-    utils_ = new MetricsUtil();
-    hv_ = new Hypervolume();
+    monteCarlo_ = nullptr;
+    reuseContributions_ = false;
 } // SMSEMOA
 
 /**
@@ -41,8 +44,7 @@ SMSEMOA::SMSEMOA(Problem *problem) : Algorithm(problem)
  */
 SMSEMOA::~SMSEMOA()
 {
-    delete utils_;
-    delete hv_;
+    delete monteCarlo_;
 } // ~SMSEMOA
 
 
@@ -53,14 +55,14 @@ SMSEMOA::~SMSEMOA()
 */
 SolutionSet * SMSEMOA::execute()
 {
+    startInstrumentation();
+    startTermination();
+
     int populationSize;
     int maxEvaluations;
     int evaluations;
     double offset = 100.0;
 
-    QualityIndicator * indicators; // QualityIndicator object
-    int requiredEvaluations; // Use in the example of use of the indicators object (see below)
-
     SolutionSet * population;
     SolutionSet * offspringPopulation;
     SolutionSet * unionSolution;
@@ -73,15 +75,21 @@ SolutionSet * SMSEMOA::execute()
     populationSize = *(int *) getInputParameter("populationSize");
     maxEvaluations = *(int *) getInputParameter("maxEvaluations");
     offset = *(double *) getInputParameter("offset");
-
-    //indicators = (QualityIndicator*) getInputParameter("indicators");
+    if (getInputParameter("numberOfSamples") != nullptr)
+    {
+        delete monteCarlo_;
+        monteCarlo_ = new MonteCarloHypervolume(*(int *) getInputParameter("numberOfSamples"));
+    }
+    if (getInputParameter("reuseContributions") != nullptr)
+    {
+        reuseContributions_ = *(bool *) getInputParameter("reuseContributions");
+    }
+    cachedPoints_.clear();
 
     //Initialize the variables
     population = new SolutionSet(populationSize);
     evaluations = 0;
 
-    requiredEvaluations = 0;
-
     //Read the operators
     crossoverOperator = operators_["crossover"];
     mutationOperator = operators_["mutation"];
@@ -92,8 +100,11 @@ SolutionSet * SMSEMOA::execute()
     for (int i = 0; i < populationSize; i++)
     {
         newSolution = new Solution(problem_);
-        problem_->evaluate(newSolution);
-        problem_->evaluateConstraints(newSolution);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(newSolution);
+            problem_->evaluateConstraints(newSolution);
+        }
         evaluations++;
         population->add(newSolution);
     } //for
@@ -102,7 +113,7 @@ SolutionSet * SMSEMOA::execute()
     Solution ** offSpring;
 
     // Generations ...
-    while (evaluations < maxEvaluations)
+    while ((evaluations < maxEvaluations) && !isTerminated(population, evaluations))
     {
 
         // Create the offSpring solutionSet
@@ -115,8 +126,11 @@ SolutionSet * SMSEMOA::execute()
 
         mutationOperator->execute(offSpring[0]);
 
-        problem_->evaluate(offSpring[0]);
-        problem_->evaluateConstraints(offSpring[0]);
+        {
+            JMETAL_TIME_EVALUATIONS(1);
+            problem_->evaluate(offSpring[0]);
+            problem_->evaluateConstraints(offSpring[0]);
+        }
 
         // insert child into the offspring population
         offspringPopulation->add(offSpring[0]);
@@ -129,183 +143,239 @@ SolutionSet * SMSEMOA::execute()
         delete[] offSpring;
         delete[] parents;
 
-        // Create the solutionSet union of solutionSet and offSpring
-        unionSolution = population->join(offspringPopulation);
+        // Create the solutionSet union of solutionSet and offSpring. The
+        // solutions are moved, so population is left empty
+        unionSolution = population->joinByMove(offspringPopulation);
         delete offspringPopulation;
 
-        // Ranking the union (non-dominated sorting)
-        Ranking * ranking = new Ranking(unionSolution);
-
-        // ensure crowding distance values are up to date
-        // (may be important for parent selection)
-        for (int j = 0; j < population->size(); j++)
-        {
-            population->get(j)->setCrowdingDistance(0.0);
-        }
+        // Ranking the union (non-dominated sorting). The ranking takes the
+        // solutions of the union
+        Ranking * ranking = new Ranking(unionSolution, true);
 
         //std::cout << "front 0 size: " << ranking->getSubfront(0)->size()  << std::endl ;
 
         SolutionSet *lastFront = ranking->getSubfront(ranking->getNumberOfSubfronts() - 1);
         if (lastFront->size() > 1)
         {
-
-            std::vector <VectorOfDouble > frontValues = lastFront->writeObjectivesToMatrix();
             int numberOfObjectives = problem_->getNumberOfObjectives();
 
-            // STEP 1. Obtain the maximum and minimum values of the Pareto front
-            VectorOfDouble maximumValues = utils_->getMaximumValues(unionSolution->writeObjectivesToMatrix(), numberOfObjectives);
-            VectorOfDouble minimumValues = utils_->getMinimumValues(unionSolution->writeObjectivesToMatrix(), numberOfObjectives);
-
-            // STEP 2. Get the normalized front
-            std::vector <VectorOfDouble > normalizedFront = utils_->getNormalizedFront(frontValues, maximumValues, minimumValues);
-
-            // compute offsets for reference point in normalized space
-            VectorOfDouble offsets;
-            for (int i = 0; i < maximumValues.size(); i++)
+            // The contributions are computed in the objective space, with the
+            // reference point at the maximum values of the union plus the
+            // offset. Dividing them by the volume of the bounds of the union
+            // gives the contributions in the normalized space
+            referencePoint_.assign(numberOfObjectives, -std::numeric_limits<double>::max());
+            vector<double> minimumValues(numberOfObjectives, std::numeric_limits<double>::max());
+            for (int k = 0; k < ranking->getNumberOfSubfronts(); k++)
             {
-                offsets.push_back(offset / (maximumValues[i] - minimumValues[i]));
-            }
-
-            // STEP 3. Inverse the pareto front. This is needed because the original
-            //metric by Zitzler is for maximization problems
-            std::vector <VectorOfDouble > invertedFront = utils_->invertedFront(normalizedFront);
-            // shift away from origin, so that boundary points also get a contribution > 0
-            for (int i = 0; i < invertedFront.size(); i++)
-            {
-                for (int j = 0; j < invertedFront[i].size(); j++)
+                SolutionSet * front = ranking->getSubfront(k);
+                for (int i = 0; i < front->size(); i++)
                 {
-                    invertedFront[i][j] = invertedFront[i][j] + offsets[j];
+                    const double * objectives = front->get(i)->getObjectives();
+                    for (int j = 0; j < numberOfObjectives; j++)
+                    {
+                        referencePoint_[j] = std::max(referencePoint_[j], objectives[j]);
+                        minimumValues[j] = std::min(minimumValues[j], objectives[j]);
+                    }
                 }
             }
+            double volume = 1.0;
+            for (int j = 0; j < numberOfObjectives; j++)
+            {
+                volume *= referencePoint_[j] - minimumValues[j];
+                referencePoint_[j] += offset;
+            }
 
             // calculate contributions and sort
-            VectorOfDouble contributions = hvContributions(invertedFront);
-            for (int i = 0; i < contributions.size(); i++)
+            hvContributions(lastFront);
+            for (int i = 0; i < lastFront->size(); i++)
             {
                 // contribution values are used analogously to crowding distance
-                lastFront->get(i)->setCrowdingDistance(contributions[i]);
+                lastFront->get(i)->setCrowdingDistance(contributions_[i] / volume);
             }
 
-            CrowdingDistanceComparator *cd = new CrowdingDistanceComparator();
-            lastFront->sort(cd);
-            delete cd;
+            lastFront->sortBy(CrowdingDistanceOrder());
 
         }
 
-        // all but the worst are carried over to the survivor population
-        SolutionSet *front = nullptr;
-        for (int i=0; i<population->size(); i++)
-        {
-            delete population->get(i);
-        }
-        population->clear();
-
+        // all but the worst are carried over to the survivor population; the
+        // worst one is deleted with the ranking
         for (int i = 0; i < ranking->getNumberOfSubfronts() - 1; i++)
         {
-            front = ranking->getSubfront(i);
-            for (int j = 0; j < front->size(); j++)
-                population->add(new Solution(front->get(j)));
+            population->moveFrom(ranking->getSubfront(i));
         }
-        for (int i = 0; i < lastFront->size() - 1; i++)
-            population->add(new Solution(lastFront->get(i)));
+        population->moveFrom(lastFront, lastFront->size() - 1);
 
         delete ranking;
         delete unionSolution;
 
-        // This piece of code shows how to use the indicator object into the code
-        // of SMS-EMOA. In particular, it finds the number of evaluations required
-        // by the algorithm to obtain a Pareto front with a hypervolume higher
-        // than the hypervolume of the true Pareto front.
-        /*if (indicators != nullptr && requiredEvaluations == 0) {
-          double HV = indicators->getHypervolume(population);
-          if (HV >= (0.98 * indicators->getTrueParetoFrontHypervolume())) {
-            requiredEvaluations = evaluations;
-          } // if
-        } // if */
-
     } //WHILE
 
     // Return the first non-dominated front
-    Ranking *ranking = new Ranking(population);
+    Ranking *ranking = new Ranking(population, true);
     SolutionSet * result = new SolutionSet(ranking->getSubfront(0)->size());
-    for (int i=0; i<ranking->getSubfront(0)->size(); i++)
-    {
-        result->add(new Solution(ranking->getSubfront(0)->get(i)));
-    }
+    result->moveFrom(ranking->getSubfront(0));
     delete ranking;
     delete population;
 
+    publishInstrumentation();
+
     return result;
 }
 
-VectorOfDouble SMSEMOA::hvContributions(MatrixOfDouble front)
+/**
+ * Computes in contributions_ the hypervolume contribution of every solution
+ * of a front with respect to referencePoint_. If reuseContributions_ is set
+ * and the front differs in a few solutions from the one of the previous call,
+ * the previous contributions are updated instead of recomputed.
+ */
+void SMSEMOA::hvContributions(SolutionSet * front)
 {
+    JMETAL_TIME_PHASE(DENSITY);
+
     int numberOfObjectives = problem_->getNumberOfObjectives();
+    int size = front->size();
+
+    points_.resize(size * numberOfObjectives);
+    for (int i = 0; i < size; i++)
+    {
+        const double * objectives = front->get(i)->getObjectives();
+        std::copy(objectives, objectives + numberOfObjectives,
+                  points_.begin() + i * numberOfObjectives);
+    }
+    contributions_.resize(size);
 
-    VectorOfDouble contributions;
-    double hv;
+    if (monteCarlo_ != nullptr)
+    {
+        monteCarlo_->contributions(points_.data(), size, numberOfObjectives,
+                                   referencePoint_.data(), contributions_.data());
+        return;
+    }
 
-    double** frontSubset;
+    if (!reuseContributions_ || !updateContributions(size, numberOfObjectives))
+    {
+        engine_.contributions(points_.data(), size, numberOfObjectives,
+                              referencePoint_.data(), contributions_.data());
+    }
+
+    if (reuseContributions_)
+    {
+        cachedPoints_ = points_;
+        cachedReferencePoint_ = referencePoint_;
+        cachedContributions_ = contributions_;
+    }
+} // hvContributions
 
-    MatrixOfDouble frontCopy;
 
-    double** totalFront = snew double*[front.size()];
+/**
+ * Obtains the contributions of the current front from those of the previous
+ * call, removing and adding points one at a time. Removing r increases the
+ * contribution of each remaining point q by the exclusive contribution of
+ * max(q, r); adding a decreases it by that of max(q, a). Returns false if the
+ * reference point has changed or the fronts are too different
+ */
+bool SMSEMOA::updateContributions(int size, int numberOfObjectives)
+{
+    int m = numberOfObjectives;
+    int cachedSize = cachedPoints_.size() / m;
+    if ((cachedSize == 0) || (cachedReferencePoint_ != referencePoint_))
+    {
+        return false;
+    }
 
-    for (int i = 0; i < front.size(); i++)
+    // Match the points of both fronts
+    vector<int> match(size, -1);
+    vector<bool> matched(cachedSize, false);
+    int changes = 0;
+    for (int i = 0; i < size; i++)
     {
-        frontCopy.push_back(VectorOfDouble());
-        totalFront[i] = snew double[front[i].size()];
-        for (int j = 0; j < front[i].size(); j++)
+        const double * point = points_.data() + i * m;
+        for (int j = 0; j < cachedSize; j++)
         {
-            frontCopy[i].push_back(front[i][j]);
-            totalFront[i][j] = front[i][j];
+            if (!matched[j] && std::equal(point, point + m, cachedPoints_.data() + j * m))
+            {
+                match[i] = j;
+                matched[j] = true;
+                break;
+            }
+        }
+        if (match[i] == -1)
+        {
+            changes++;
         }
     }
-
-    double totalVolume = hv_->calculateHypervolume(totalFront, front.size(), numberOfObjectives);
-
-    for (int i = 0; i < front.size(); i++)
+    changes += std::count(matched.begin(), matched.end(), false);
+    if (2 * changes > size)
     {
+        return false;
+    }
 
-        VectorOfDouble evaluatedPoint;
-        for (int j = 0; j < frontCopy[i].size(); j++)
+    // The working front starts as the cached one; 'owner' maps its rows to
+    // the points of the current front (-1 = removed)
+    vector<double> work = cachedPoints_;
+    vector<double> contribution = cachedContributions_;
+    vector<int> owner(cachedSize, -1);
+    for (int i = 0; i < size; i++)
+    {
+        if (match[i] != -1)
         {
-            evaluatedPoint.push_back(frontCopy[i][j]);
+            owner[match[i]] = i;
         }
-        frontCopy.erase(frontCopy.begin() + i);
+    }
+    vector<double> removed(m);
+    vector<double> bounded(m);
 
-        /*Makes a copy in pointer of pointer format*/
-        frontSubset = snew double*[frontCopy.size()];
-        for (int f = 0; f < frontCopy.size(); f++)
+    int n = cachedSize;
+    for (int r = n - 1; r >= 0; r--)
+    {
+        if (owner[r] != -1)
         {
-            frontSubset[f] = snew double[frontCopy[f].size()];
-            for (int c = 0; c < frontCopy[f].size(); c++)
+            continue;
+        }
+        std::copy(work.begin() + r * m, work.begin() + (r + 1) * m, removed.begin());
+        n--;
+        std::copy(work.begin() + n * m, work.begin() + (n + 1) * m, work.begin() + r * m);
+        contribution[r] = contribution[n];
+        owner[r] = owner[n];
+        for (int q = 0; q < n; q++)
+        {
+            for (int k = 0; k < m; k++)
             {
-                frontSubset[f][c]=frontCopy[f][c];
+                bounded[k] = std::max(work[q * m + k], removed[k]);
             }
+            contribution[q] += engine_.exclusive(bounded.data(), work.data(), n, m,
+                                                 referencePoint_.data(), q);
         }
+    }
+    work.resize(n * m);
+    contribution.resize(n);
+    owner.resize(n);
 
-        // STEP4. The hypervolume
-        hv = hv_->calculateHypervolume(frontSubset, frontCopy.size(), numberOfObjectives);
-        contributions.push_back(totalVolume - hv);
-
-        // put point back position i
-        frontCopy.insert(frontCopy.begin() + i, evaluatedPoint);
-
-        for( int y = 0 ; y < frontCopy.size()-1 ; y++ )
+    for (int i = 0; i < size; i++)
+    {
+        if (match[i] != -1)
         {
-            delete [] frontSubset[y] ;
+            continue;
         }
-        delete [] frontSubset;
-
+        const double * added = points_.data() + i * m;
+        for (int q = 0; q < n; q++)
+        {
+            for (int k = 0; k < m; k++)
+            {
+                bounded[k] = std::max(work[q * m + k], added[k]);
+            }
+            contribution[q] -= engine_.exclusive(bounded.data(), work.data(), n, m,
+                                                 referencePoint_.data(), q);
+        }
+        contribution.push_back(engine_.exclusive(added, work.data(), n, m,
+                               referencePoint_.data(), -1));
+        work.insert(work.end(), added, added + m);
+        owner.push_back(i);
+        n++;
     }
 
-    for( int y = 0 ; y < front.size() ; y++ )
+    for (int q = 0; q < n; q++)
     {
-        delete [] totalFront[y] ;
+        contributions_[owner[q]] = contribution[q];
     }
-    delete [] totalFront;
-
-    return contributions;
-
-}
+    return true;
+} // updateContributions
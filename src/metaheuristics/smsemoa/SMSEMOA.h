@@ -29,6 +29,8 @@
 #include <QualityIndicator.h>
 #include <MetricsUtil.h>
 #include <Hypervolume.h>
+#include <HypervolumeEngine.h>
+#include <MonteCarloHypervolume.h>
 #include <Ranking.h>
 #include <CrowdingDistanceComparator.h>
 
@@ -37,10 +39,21 @@ class SMSEMOA : public Algorithm
 
 private:
 
-    MetricsUtil * utils_;
-    Hypervolume * hv_;
+    HypervolumeEngine engine_;
+    MonteCarloHypervolume * monteCarlo_; // nullptr = exact contributions
+    bool reuseContributions_;
 
-    vector<double> hvContributions(vector< vector<double> > front);
+    // Objective values of the last front (row by row), reference point and
+    // contributions. The cached copies are those of the previous call
+    vector<double> points_;
+    vector<double> referencePoint_;
+    vector<double> contributions_;
+    vector<double> cachedPoints_;
+    vector<double> cachedReferencePoint_;
+    vector<double> cachedContributions_;
+
+    void hvContributions(SolutionSet * front);
+    bool updateContributions(int size, int numberOfObjectives);
 
 
 public:
@@ -21,6 +21,7 @@
 
 
 #include <DifferentialEvolutionCrossover.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -101,6 +102,7 @@ DifferentialEvolutionCrossover::DifferentialEvolutionCrossover(MapOfStringFunct
 */
 void * DifferentialEvolutionCrossover::execute(void *object)
 {
+    JMETAL_TIME_PHASE(VARIATION);
 
     void ** parameters = (void **) object;
     Solution * current = (Solution *) parameters[0];
@@ -20,6 +20,7 @@
 
 
 #include <HUXCrossover.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -96,6 +97,8 @@ Solution ** HUXCrossover::doCrossover(double probability, Solution *parent1, Sol
  */
 void * HUXCrossover::execute(void *object)
 {
+    JMETAL_TIME_PHASE(VARIATION);
+
     Solution ** parents = (Solution **) object;
     // TODO: Comprobar la longitud de parents
     // TODO: Chequear el tipo de parents
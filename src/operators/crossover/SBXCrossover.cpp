@@ -22,6 +22,7 @@
 
 
 #include <SBXCrossover.h>
+#include <Instrumentation.h>
 
 /**
   * @class SBXCrossover
@@ -206,6 +207,7 @@ Solution ** SBXCrossover::doCrossover(double probability, Solution *parent1, Sol
 */
 void * SBXCrossover::execute(void *object)
 {
+    JMETAL_TIME_PHASE(VARIATION);
 
 //  double probability = *(double *)getParameter("probability");
 
@@ -20,6 +20,7 @@
 
 
 #include <SinglePointCrossover.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -153,6 +154,8 @@ Solution ** SinglePointCrossover::doCrossover(double probability, Solution *pare
  */
 void * SinglePointCrossover::execute(void *object)
 {
+    JMETAL_TIME_PHASE(VARIATION);
+
     Solution ** parents = (Solution **) object;
     // TODO: Comprobar la longitud de parents
     // TODO: Chequear el tipo de parents
@@ -20,6 +20,7 @@
 
 
 #include <BitFlipMutation.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -69,6 +70,8 @@ void * BitFlipMutation::doMutation(double probability, Solution *solution)
  */
 void * BitFlipMutation::execute(void *object)
 {
+    JMETAL_TIME_PHASE(VARIATION);
+
     Solution *solution = (Solution *)object;
     // TODO: VALID_TYPES?
 
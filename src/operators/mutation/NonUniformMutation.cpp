@@ -20,6 +20,7 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <NonUniformMutation.h>
+#include <Instrumentation.h>
 
 /**
  * This class implements a non-uniform mutation operator.
@@ -132,6 +133,8 @@ double NonUniformMutation::delta(double y, double bMutationParameter)
  */
 void *NonUniformMutation::execute(void *object)
 {
+    JMETAL_TIME_PHASE(VARIATION);
+
     Solution *solution = (Solution *)object;
     // TODO: VALID_TYPES?
     if (getParameter("currentIteration") != nullptr)
@@ -22,6 +22,7 @@
 
 
 #include <PolynomialMutation.h>
+#include <Instrumentation.h>
 
 
 const double PolynomialMutation::ETA_M_DEFAULT_ = 20.0;
@@ -106,6 +107,8 @@ void * PolynomialMutation::doMutation(double probability, Solution *solution)
  */
 void * PolynomialMutation::execute(void *object)
 {
+    JMETAL_TIME_PHASE(VARIATION);
+
     Solution *solution = (Solution *)object;
     // TODO: VALID_TYPES?
     //double probability = *(double *)getParameter("probability");
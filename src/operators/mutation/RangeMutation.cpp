@@ -1,4 +1,5 @@
 #include "RangeMutation.h"
+#include <Instrumentation.h>
 
 RangeMutation::RangeMutation(MapOfStringFunct parameters): Mutation(parameters)
 {
@@ -66,6 +67,8 @@ double RangeMutation::doPertubation(XReal* array, short col)
 
 void * RangeMutation::execute(void * object)
 {
+    JMETAL_TIME_PHASE(VARIATION);
+
 	Solution *solution = (Solution *)object;
 	doMutation(mutationProbability_, solution);
 	return solution;
@@ -19,6 +19,7 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <UniformMutation.h>
+#include <Instrumentation.h>
 
 /**
  * This class implements a uniform mutation operator.
@@ -104,6 +105,8 @@ void UniformMutation::doMutation(double probability, Solution *solution)
  */
 void *UniformMutation::execute(void *object)
 {
+    JMETAL_TIME_PHASE(VARIATION);
+
     Solution *solution = (Solution *)object;
     // TODO: VALID_TYPES?
     doMutation(mutationProbability_,solution);
@@ -20,6 +20,7 @@
 
 
 #include <BestSolutionSelection.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -30,6 +31,9 @@
 
 /**
  * Constructor
+ * @param parameters The "comparator" used to compare solutions and,
+ * optionally, a "heap" (<code>SolutionHeap</code>) keyed consistently with
+ * it that indexes the solution set being searched
  */
 BestSolutionSelection::BestSolutionSelection(MapOfStringFunct parameters)
     : Selection(parameters)
@@ -39,6 +43,11 @@ BestSolutionSelection::BestSolutionSelection(MapOfStringFunct parameters)
     {
         comparator_ = (Comparator *) parameters["comparator"];
     }
+    heap_ = nullptr;
+    if (parameters["heap"] != nullptr)
+    {
+        heap_ = (SolutionHeap *) parameters["heap"];
+    }
 }
 
 
@@ -49,6 +58,7 @@ BestSolutionSelection::BestSolutionSelection(MapOfStringFunct parameters)
 */
 void * BestSolutionSelection::execute(void * object)
 {
+    JMETAL_TIME_PHASE(SELECTION);
 
     SolutionSet * solutionSet = (SolutionSet *)object;
 
@@ -57,6 +67,12 @@ void * BestSolutionSelection::execute(void * object)
         return nullptr;
     }
 
+    // The optional heap answers in O(1) when it indexes this solution set
+    if ((heap_ != nullptr) && (heap_->getSolutionSet() == solutionSet))
+    {
+        return snew int(heap_->best());
+    }
+
     int bestSolution = 0;
 
     for (int i = 1; i < solutionSet->size(); i++)
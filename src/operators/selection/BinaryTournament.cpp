@@ -20,6 +20,7 @@
 
 
 #include <BinaryTournament.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -58,6 +59,7 @@ BinaryTournament::~BinaryTournament()
 */
 void * BinaryTournament::execute(void * object)
 {
+    JMETAL_TIME_PHASE(SELECTION);
 
     SolutionSet * solutionSet = (SolutionSet *) object;
     int index1 = PseudoRandom::randInt(0,solutionSet->size()-1);
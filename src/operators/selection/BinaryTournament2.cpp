@@ -22,6 +22,8 @@
 
 
 #include <BinaryTournament2.h>
+#include <Checkpoint.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -40,13 +42,7 @@ BinaryTournament2::BinaryTournament2(MapOfStringFunct parameters)
 {
     index_ = 0;
     a_ = snew int[1]; // Initialized as dummy
-    dominance_ = snew DominanceComparator();
-    if (dominance_ == nullptr)
-    {
-        std::cout << "BinaryTournament::BinaryTournament: error creating comparator" ;
-        std::cout << std::endl ;
-        exit(-1) ;
-    }
+    capacity_ = 1;
 }
 
 
@@ -55,7 +51,6 @@ BinaryTournament2::BinaryTournament2(MapOfStringFunct parameters)
  */
 BinaryTournament2::~BinaryTournament2()
 {
-    delete dominance_;
     delete [] a_;
 } // ~BinaryTournament2
 
@@ -67,15 +62,20 @@ BinaryTournament2::~BinaryTournament2()
 */
 void * BinaryTournament2::execute(void * object)
 {
+    JMETAL_TIME_PHASE(SELECTION);
 
     SolutionSet * population = (SolutionSet *)object;
 
     if (index_ == 0) //Create the permutation
     {
-        PermutationUtility * permutationUtility = snew PermutationUtility();
-        delete [] a_;
-        a_= permutationUtility->intPermutation(population->size());
-        delete permutationUtility;
+        if (capacity_ < population->size())
+        {
+            delete [] a_;
+            capacity_ = population->size();
+            a_ = snew int[capacity_];
+        }
+        PermutationUtility::intPermutation(a_, population->size(),
+                                           PseudoRandom::getRandomGenerator());
     }
 
     Solution * solution1;
@@ -85,7 +85,7 @@ void * BinaryTournament2::execute(void * object)
 
     index_ = (index_ + 2) % population->size();
 
-    int flag = dominance_->compare(solution1,solution2);
+    int flag = Dominance::compare(solution1,solution2);
     if (flag == -1)
         return solution1;
     else if (flag == 1)
@@ -100,3 +100,29 @@ void * BinaryTournament2::execute(void * object)
         return solution2;
 
 } // execute
+
+
+/**
+ * Writes the permutation being consumed and the position in it
+ * @param checkpoint The snapshot
+ */
+void BinaryTournament2::writeState(Checkpoint & checkpoint)
+{
+    checkpoint.writeInt(capacity_);
+    checkpoint.writeInt(index_);
+    checkpoint.writeInts(a_, capacity_);
+} // writeState
+
+
+/**
+ * Restores the permutation being consumed and the position in it
+ * @param checkpoint The snapshot
+ */
+void BinaryTournament2::readState(Checkpoint & checkpoint)
+{
+    delete [] a_;
+    capacity_ = checkpoint.readInt();
+    index_ = checkpoint.readInt();
+    a_ = snew int[capacity_];
+    checkpoint.readInts(a_, capacity_);
+} // readState
@@ -27,7 +27,7 @@
 #include <Selection.h>
 #include <Comparator.h>
 #include <PermutationUtility.h>
-#include <DominanceComparator.h>
+#include <Dominance.h>
 
 /**
  * This class implements an operator for binary selections using the same code
@@ -37,14 +37,16 @@ class BinaryTournament2 : public Selection
 {
 
 private:
-    Comparator * dominance_;
     int * a_;
+    int capacity_;
     int index_;
 
 public:
     BinaryTournament2(MapOfStringFunct parameters);
     ~BinaryTournament2();
     void *execute(void *);
+    void writeState(Checkpoint & checkpoint);
+    void readState(Checkpoint & checkpoint);
 
 };
 
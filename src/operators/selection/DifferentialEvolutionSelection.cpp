@@ -20,6 +20,7 @@
 
 
 #include <DifferentialEvolutionSelection.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -44,6 +45,7 @@ DifferentialEvolutionSelection::DifferentialEvolutionSelection(MapOfStringFunct
  */
 void * DifferentialEvolutionSelection::execute(void * object)
 {
+    JMETAL_TIME_PHASE(SELECTION);
 
     void ** parameters = (void **)object ;
     SolutionSet * population = (SolutionSet *) parameters[0];
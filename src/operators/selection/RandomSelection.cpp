@@ -20,6 +20,7 @@
 
 
 #include <RandomSelection.h>
+#include <Instrumentation.h>
 
 /**
  * @class RandomSelection
@@ -50,6 +51,7 @@ RandomSelection::~RandomSelection() { } // ~RandomSelection
  */
 void * RandomSelection::execute(void * object)
 {
+    JMETAL_TIME_PHASE(SELECTION);
 
     SolutionSet * population = (SolutionSet *) object;
     int pos1 = PseudoRandom::randInt(0,population->size()-1);
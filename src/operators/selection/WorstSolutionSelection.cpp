@@ -20,6 +20,7 @@
 
 
 #include <WorstSolutionSelection.h>
+#include <Instrumentation.h>
 
 
 /**
@@ -30,6 +31,9 @@
 
 /**
  * Constructor
+ * @param parameters The "comparator" used to compare solutions and,
+ * optionally, a "heap" (<code>SolutionHeap</code>) keyed consistently with
+ * it that indexes the solution set being searched
  */
 WorstSolutionSelection::WorstSolutionSelection(MapOfStringFunct parameters)
     : Selection(parameters)
@@ -39,6 +43,11 @@ WorstSolutionSelection::WorstSolutionSelection(MapOfStringFunct parameters)
     {
         comparator_ = (Comparator *) parameters["comparator"];
     }
+    heap_ = nullptr;
+    if (parameters["heap"] != nullptr)
+    {
+        heap_ = (SolutionHeap *) parameters["heap"];
+    }
 }
 
 
@@ -49,6 +58,7 @@ WorstSolutionSelection::WorstSolutionSelection(MapOfStringFunct parameters)
 */
 void * WorstSolutionSelection::execute(void * object)
 {
+    JMETAL_TIME_PHASE(SELECTION);
 
     SolutionSet * solutionSet = (SolutionSet *)object;
 
@@ -57,6 +67,12 @@ void * WorstSolutionSelection::execute(void * object)
         return nullptr;
     }
 
+    // The optional heap answers in O(1) when it indexes this solution set
+    if ((heap_ != nullptr) && (heap_->getSolutionSet() == solutionSet))
+    {
+        return snew int(heap_->worst());
+    }
+
     int worstSolution = 0;
 
     for (int i = 1; i < solutionSet->size(); i++)
@@ -24,6 +24,7 @@
 #include <SolutionSet.h>
 #include <Selection.h>
 #include <Comparator.h>
+#include <SolutionHeap.h>
 
 /**
  * This class implements a selection operator used for selecting the worst
@@ -34,6 +35,7 @@ class WorstSolutionSelection : public Selection
 
 private:
     Comparator * comparator_;
+    SolutionHeap * heap_;
 
 public:
     WorstSolutionSelection(map<string, void *> parameters);
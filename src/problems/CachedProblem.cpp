@@ -0,0 +1,293 @@
+//  CachedProblem.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#include <CachedProblem.h>
+#include <Hash.h>
+
+
+/**
+ * Constructor.
+ * Creates a cache of evaluations of a problem
+ * @param problem The problem to wrap. It must outlive the cache
+ * @param capacity The maximum number of evaluations kept
+ */
+CachedProblem::CachedProblem(Problem * problem, int capacity)
+{
+    if (capacity <= 0)
+    {
+        std::cout << "CachedProblem: the capacity must be positive: "
+                  << capacity << std::endl;
+        exit(-1);
+    }
+
+    problem_ = problem;
+    numberOfVariables_ = problem->numberOfVariables_;
+    numberOfObjectives_ = problem->numberOfObjectives_;
+    numberOfConstraints_ = problem->numberOfConstraints_;
+    problemName_ = problem->problemName_;
+    solutionType_ = problem->solutionType_;
+    lowerLimit_ = problem->lowerLimit_;
+    upperLimit_ = problem->upperLimit_;
+    precision_ = problem->precision_;
+    length_ = problem->length_;
+
+    Entry empty = {0, nullptr, false, false};
+    entries_.assign(capacity, empty);
+    index_.reserve(capacity);
+    hand_ = 0;
+    hits_ = 0;
+    misses_ = 0;
+} // CachedProblem
+
+
+/**
+ * Destructor. The description of the problem is shared with the wrapped
+ * problem, so only the cached solutions are deleted.
+ */
+CachedProblem::~CachedProblem()
+{
+    clear();
+} // ~CachedProblem
+
+
+/**
+ * Evaluates a solution, copying the objective values from the cache when
+ * a solution with the same decision variables has been evaluated before
+ * @param solution The solution to evaluate
+ */
+void CachedProblem::evaluate(Solution * solution)
+{
+    unsigned long long hash = Hash::genome(solution);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        int slot = find(solution, hash);
+        if (slot >= 0)
+        {
+            Solution * cached = entries_[slot].solution;
+            for (int i = 0; i < numberOfObjectives_; i++)
+            {
+                solution->setObjective(i, cached->getObjective(i));
+            }
+            entries_[slot].referenced = true;
+            hits_++;
+            return;
+        }
+        misses_++;
+    }
+
+    problem_->evaluate(solution);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (find(solution, hash) < 0)
+    {
+        store(solution);
+    }
+} // evaluate
+
+
+/**
+ * Evaluates the constraints of a solution, copying them from the cache when
+ * they have been computed for the same decision variables
+ * @param solution The solution to evaluate
+ */
+void CachedProblem::evaluateConstraints(Solution * solution)
+{
+    unsigned long long hash = Hash::genome(solution);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        int slot = find(solution, hash);
+        if ((slot >= 0) && entries_[slot].constraintsEvaluated)
+        {
+            Solution * cached = entries_[slot].solution;
+            solution->setOverallConstraintViolation(
+                cached->getOverallConstraintViolation());
+            solution->setNumberOfViolatedConstraints(
+                cached->getNumberOfViolatedConstraints());
+            return;
+        }
+    }
+
+    problem_->evaluateConstraints(solution);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    int slot = find(solution, hash);
+    if (slot >= 0)
+    {
+        Solution * cached = entries_[slot].solution;
+        cached->setOverallConstraintViolation(
+            solution->getOverallConstraintViolation());
+        cached->setNumberOfViolatedConstraints(
+            solution->getNumberOfViolatedConstraints());
+        entries_[slot].constraintsEvaluated = true;
+    }
+} // evaluateConstraints
+
+
+/**
+ * Vector evaluations are not cached; they are forwarded to the wrapped
+ * problem
+ */
+void CachedProblem::evaluateVector(const double * x, double * fx)
+{
+    problem_->evaluateVector(x, fx);
+} // evaluateVector
+
+
+/**
+ * Batch evaluations are not cached; they are forwarded to the wrapped
+ * problem
+ */
+void CachedProblem::evaluateBatch(const double * x, double * fx, int count)
+{
+    problem_->evaluateBatch(x, fx, count);
+} // evaluateBatch
+
+
+/**
+ * Returns the number of evaluations answered by the cache
+ */
+long CachedProblem::getHits()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+} // getHits
+
+
+/**
+ * Returns the number of evaluations forwarded to the wrapped problem
+ */
+long CachedProblem::getMisses()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+} // getMisses
+
+
+/**
+ * Returns the fraction of the evaluations answered by the cache
+ */
+double CachedProblem::getHitRate()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (hits_ + misses_ == 0)
+    {
+        return 0.0;
+    }
+    return (double) hits_ / (hits_ + misses_);
+} // getHitRate
+
+
+/**
+ * Removes all the cached evaluations. The counters are kept.
+ */
+void CachedProblem::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < entries_.size(); i++)
+    {
+        delete entries_[i].solution;
+        entries_[i].solution = nullptr;
+        entries_[i].referenced = false;
+        entries_[i].constraintsEvaluated = false;
+    }
+    index_.clear();
+    hand_ = 0;
+} // clear
+
+
+/**
+ * Looks for the entry of a solution. The caller must hold the lock.
+ * @param solution The solution
+ * @param hash The genome hash of the solution
+ * @return The slot of the entry, or -1 if it is not cached
+ */
+int CachedProblem::find(Solution * solution, unsigned long long hash)
+{
+    auto range = index_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        Variable ** cached = entries_[it->second].solution->getDecisionVariables();
+        Variable ** variables = solution->getDecisionVariables();
+        bool equal = true;
+        for (int i = 0; equal && (i < solution->getNumberOfVariables()); i++)
+        {
+            equal = cached[i]->equals(variables[i]);
+        }
+        if (equal)
+        {
+            return it->second;
+        }
+    }
+    return -1;
+} // find
+
+
+/**
+ * Stores a copy of an evaluated solution, replacing the entry chosen by the
+ * CLOCK policy. The caller must hold the lock. The hash is taken from the
+ * copy, as the evaluation may have repaired the decision variables.
+ * @param solution The evaluated solution
+ */
+void CachedProblem::store(Solution * solution)
+{
+    int slot = victim();
+    Entry & entry = entries_[slot];
+    if (entry.solution != nullptr)
+    {
+        auto range = index_.equal_range(entry.hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == slot)
+            {
+                index_.erase(it);
+                break;
+            }
+        }
+        delete entry.solution;
+    }
+
+    entry.solution = snew Solution(solution);
+    entry.hash = Hash::genome(entry.solution);
+    entry.referenced = false;
+    entry.constraintsEvaluated = false;
+    index_.insert(std::make_pair(entry.hash, slot));
+} // store
+
+
+/**
+ * Advances the clock hand to the first empty or not recently used entry,
+ * clearing the reference bits it passes over
+ * @return The slot to replace
+ */
+int CachedProblem::victim()
+{
+    while (true)
+    {
+        int slot = hand_;
+        hand_ = (hand_ + 1) % entries_.size();
+        if ((entries_[slot].solution == nullptr) || !entries_[slot].referenced)
+        {
+            return slot;
+        }
+        entries_[slot].referenced = false;
+    }
+} // victim
@@ -0,0 +1,83 @@
+//  CachedProblem.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef __CACHED_PROBLEM__
+#define __CACHED_PROBLEM__
+
+#include <Problem.h>
+#include <Solution.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * This class wraps a problem with a bounded cache of evaluations, so that
+ * the solutions whose decision variables have already been evaluated get
+ * their objective values and constraint violations copied from the cache
+ * instead of being evaluated again. It pays off when evaluations are costly
+ * and the operators often reproduce existing individuals.
+ *
+ * Entries are found by genome hash (see <code>Hash</code>) and confirmed by
+ * comparing the variables, and they are replaced following the CLOCK policy.
+ * The cache may be used from several threads; the evaluations of the wrapped
+ * problem run outside its lock. Only deterministic problems may be wrapped.
+ * The wrapped problem is not owned by the cache.
+ */
+class CachedProblem : public Problem
+{
+
+private:
+
+    struct Entry
+    {
+        unsigned long long hash;
+        Solution * solution;
+        bool referenced;
+        bool constraintsEvaluated;
+    };
+
+    Problem * problem_;
+    std::vector<Entry> entries_;
+    std::unordered_multimap<unsigned long long, int> index_;
+    int hand_;
+    std::mutex mutex_;
+    long hits_;
+    long misses_;
+
+    int find(Solution * solution, unsigned long long hash);
+    void store(Solution * solution);
+    int victim();
+
+public:
+    CachedProblem(Problem * problem, int capacity);
+    ~CachedProblem();
+    void evaluate(Solution * solution);
+    void evaluateConstraints(Solution * solution);
+    void evaluateVector(const double * x, double * fx);
+    void evaluateBatch(const double * x, double * fx, int count);
+    long getHits();
+    long getMisses();
+    double getHitRate();
+    void clear();
+
+}; // CachedProblem
+
+#endif
@@ -63,9 +63,6 @@ DTLZ1::DTLZ1(std::string solutionType, int numberOfVariables, int numberOfObject
         std::cout << "Error: solution type " << solutionType << " invalid" << std::endl;
         exit(-1) ;
     }
-
-    fx_ = snew double[numberOfObjectives_] ;
-    x_ = snew double[numberOfVariables_];
 }
 
 DTLZ1::~DTLZ1()
@@ -73,8 +70,6 @@ DTLZ1::~DTLZ1()
     delete [] lowerLimit_ ;
     delete [] upperLimit_ ;
     delete solutionType_ ;
-    delete [] fx_ ;
-    delete [] x_ ;
 }
 
 /**
@@ -83,35 +78,32 @@ DTLZ1::~DTLZ1()
  */
 void DTLZ1::evaluate(Solution *solution)
 {
-    XReal * vars = snew XReal(solution);
+    evaluateVector(readVariables(solution), solution->getObjectives());
+} // evaluate
 
-    int k = numberOfVariables_ - numberOfObjectives_ + 1;
 
-    for (int i = 0; i < numberOfVariables_; i++)
-        x_[i] = vars->getValue(i);
+/**
+ * Evaluates a vector of decision variables
+ * @param x The decision variables
+ * @param fx Array receiving the objective values
+ */
+void DTLZ1::evaluateVector(const double * x, double * fx)
+{
+    int k = numberOfVariables_ - numberOfObjectives_ + 1;
 
     double g = 0.0 ;
-
     for (int i = numberOfVariables_ - k; i < numberOfVariables_; i++)
-        g += (x_[i] - 0.5)*(x_[i] - 0.5) - cos(20.0 * PI * (x_[i] - 0.5));
+        g += (x[i] - 0.5)*(x[i] - 0.5) - cos(20.0 * PI * (x[i] - 0.5));
 
     g = 100 * (k + g);
-    for (int i = 0; i < numberOfObjectives_; i++)
-        fx_[i] = (1.0 + g) * 0.5;
 
-    for (int i = 0; i < numberOfObjectives_; i++)
+    // fx[i] multiplies the first M-i-1 position factors, so a running
+    // product visits every variable once instead of once per objective
+    double product = (1.0 + g) * 0.5;
+    for (int j = 0; j < numberOfObjectives_ - 1; j++)
     {
-        for (int j = 0; j < numberOfObjectives_ - (i + 1); j++)
-            fx_[i] *= x_[j];
-        if (i != 0)
-        {
-            int aux = numberOfObjectives_ - (i + 1);
-            fx_[i] *= 1 - x_[aux];
-        } //if
-    }//for
-
-    for (int i = 0; i < numberOfObjectives_; i++)
-        solution->setObjective(i, fx_[i]);
-
-    delete vars ;
-} // evaluate
+        fx[numberOfObjectives_ - (j + 1)] = product * (1 - x[j]);
+        product *= x[j];
+    } // for
+    fx[0] = product;
+} // evaluateVector
@@ -34,11 +34,10 @@ class DTLZ1 : public Problem
 public:
     DTLZ1(std::string solutionType, int numberOfVariables = 7, int numberOfObjectives = 3);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
 
     virtual ~DTLZ1();
 private:
-    double * fx_ ;
-    double * x_  ;
     static const double PI;
 };
 
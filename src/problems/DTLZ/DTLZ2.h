@@ -34,11 +34,10 @@ class DTLZ2 : public Problem
 public:
     DTLZ2(std::string solutionType, int numberOfVariables = 12, int numberOfObjectives = 3);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
 
     virtual ~DTLZ2();
 private:
-    double * fx_ ;
-    double * x_  ;
     static const double PI;
 };
 
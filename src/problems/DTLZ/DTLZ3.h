@@ -34,11 +34,10 @@ class DTLZ3 : public Problem
 public:
     DTLZ3(std::string solutionType, int numberOfVariables = 12, int numberOfObjectives = 3);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
 
     virtual ~DTLZ3();
 private:
-    double * fx_ ;
-    double * x_  ;
     static const double PI ;
 };
 
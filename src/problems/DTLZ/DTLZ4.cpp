@@ -63,9 +63,6 @@ DTLZ4::DTLZ4(std::string solutionType, int numberOfVariables, int numberOfObject
         std::cout << "Error: solution type " << solutionType << " invalid" << std::endl;
         exit(-1) ;
     }
-
-    fx_ = snew double[numberOfObjectives_] ;
-    x_ = snew double[numberOfVariables_];
 }
 
 DTLZ4::~DTLZ4()
@@ -81,34 +78,33 @@ DTLZ4::~DTLZ4()
  */
 void DTLZ4::evaluate(Solution *solution)
 {
-    XReal * vars = snew XReal(solution);
+    evaluateVector(readVariables(solution), solution->getObjectives());
+} // evaluate
 
+
+/**
+ * Evaluates a vector of decision variables
+ * @param x The decision variables
+ * @param fx Array receiving the objective values
+ */
+void DTLZ4::evaluateVector(const double * x, double * fx)
+{
     int k = numberOfVariables_ - numberOfObjectives_ + 1;
-    double alpha = 100.0;
 
-    for (int i = 0; i < numberOfVariables_; i++)
-        x_[i] = vars->getValue(i);
+    double alpha = 100.0;
 
     double g = 0.0;
     for (int i = numberOfVariables_ - k; i < numberOfVariables_; i++)
-        g += (x_[i] - 0.5)*(x_[i] - 0.5);
-
-    for (int i = 0; i < numberOfObjectives_; i++)
-        fx_[i] = 1.0 + g;
+        g += (x[i] - 0.5)*(x[i] - 0.5);
 
-    for (int i = 0; i < numberOfObjectives_; i++)
+    // fx[i] multiplies the first M-i-1 position factors, so a running
+    // product visits every variable once instead of once per objective
+    double product = 1.0 + g;
+    for (int j = 0; j < numberOfObjectives_ - 1; j++)
     {
-        for (int j = 0; j < numberOfObjectives_ - (i + 1); j++)
-            fx_[i] *= cos(pow(x_[j],alpha)*(PI/2.0));
-        if (i != 0)
-        {
-            int aux = numberOfObjectives_ - (i + 1);
-            fx_[i] *= sin(pow(x_[aux],alpha)*(PI/2.0));
-        } //if
+        double angle = pow(x[j],alpha)*(PI/2.0);
+        fx[numberOfObjectives_ - (j + 1)] = product * sin(angle);
+        product *= cos(angle);
     } // for
-
-    for (int i = 0; i < numberOfObjectives_; i++)
-        solution->setObjective(i, fx_[i]);
-
-    delete vars ;
-} // evaluate
+    fx[0] = product;
+} // evaluateVector
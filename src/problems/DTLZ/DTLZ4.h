@@ -34,11 +34,10 @@ class DTLZ4 : public Problem
 public:
     DTLZ4(std::string solutionType, int numberOfVariables = 12, int numberOfObjectives = 3);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
 
     virtual ~DTLZ4();
 private:
-    double * fx_ ;
-    double * x_  ;
     static const double PI ;
 };
 
@@ -34,12 +34,10 @@ class DTLZ5 : public Problem
 public:
     DTLZ5(std::string solutionType, int numberOfVariables = 12, int numberOfObjectives = 3);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
 
     virtual ~DTLZ5();
 private:
-    double * fx_ ;
-    double * x_  ;
-    double * theta_ ;
 private:
     static const double PI ;
 };
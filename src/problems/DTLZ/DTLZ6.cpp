@@ -63,10 +63,6 @@ DTLZ6::DTLZ6(std::string solutionType, int numberOfVariables, int numberOfObject
         std::cout << "Error: solution type " << solutionType << " invalid" << std::endl;
         exit(-1) ;
     }
-
-    fx_ = snew double[numberOfObjectives_] ;
-    x_ = snew double[numberOfVariables_];
-    theta_ = snew double[numberOfObjectives_-1];
 }
 
 DTLZ6::~DTLZ6()
@@ -74,7 +70,6 @@ DTLZ6::~DTLZ6()
     delete [] lowerLimit_ ;
     delete [] upperLimit_ ;
     delete solutionType_ ;
-    delete [] theta_     ;
 }
 
 /**
@@ -83,40 +78,33 @@ DTLZ6::~DTLZ6()
  */
 void DTLZ6::evaluate(Solution *solution)
 {
-    XReal * vars = snew XReal(solution);
-    double g = 0.0;
+    evaluateVector(readVariables(solution), solution->getObjectives());
+} // evaluate
 
-    int k = numberOfVariables_ - numberOfObjectives_ + 1;
-    double alpha = 100.0;
 
-    for (int i = 0; i < numberOfVariables_; i++)
-        x_[i] = vars->getValue(i);
+/**
+ * Evaluates a vector of decision variables
+ * @param x The decision variables
+ * @param fx Array receiving the objective values
+ */
+void DTLZ6::evaluateVector(const double * x, double * fx)
+{
+    int k = numberOfVariables_ - numberOfObjectives_ + 1;
 
+    double g = 0.0;
     for (int i = numberOfVariables_ - k; i < numberOfVariables_; i++)
-        g += pow(x_[i],0.1);
+        g += pow(x[i],0.1);
 
     double t = PI / (4.0 * (1.0 + g));
 
-    theta_[0] = x_[0] * PI / 2.0;
-    for (int i = 1; i < (numberOfObjectives_-1); i++)
-        theta_[i] = t * (1.0 + 2.0 * g * x_[i]);
-
-    for (int i = 0; i < numberOfObjectives_; i++)
-        fx_[i] = 1.0 + g;
-
-    for (int i = 0; i < numberOfObjectives_; i++)
+    // fx[i] multiplies the first M-i-1 position factors, so a running
+    // product visits every angle once instead of once per objective
+    double product = 1.0 + g;
+    for (int j = 0; j < numberOfObjectives_ - 1; j++)
     {
-        for (int j = 0; j < numberOfObjectives_ - (i + 1); j++)
-            fx_[i] *= cos(theta_[j]);
-        if (i != 0)
-        {
-            int aux = numberOfObjectives_ - (i + 1);
-            fx_[i] *= sin(theta_[aux]);
-        } // if
-    } //for
-
-    for (int i = 0; i < numberOfObjectives_; i++)
-        solution->setObjective(i, fx_[i]);
-
-    delete vars ;
-} // evaluate
+        double theta = (j == 0) ? x[0] * PI / 2.0 : t * (1.0 + 2.0 * g * x[j]);
+        fx[numberOfObjectives_ - (j + 1)] = product * sin(theta);
+        product *= cos(theta);
+    } // for
+    fx[0] = product;
+} // evaluateVector
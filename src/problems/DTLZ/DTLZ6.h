@@ -34,12 +34,10 @@ class DTLZ6 : public Problem
 public:
     DTLZ6(std::string solutionType, int numberOfVariables = 12, int numberOfObjectives = 2);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
 
     virtual ~DTLZ6();
 private:
-    double * fx_ ;
-    double * x_  ;
-    double * theta_ ;
     static const double PI ;
 };
 
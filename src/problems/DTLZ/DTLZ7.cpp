@@ -63,9 +63,6 @@ DTLZ7::DTLZ7(std::string solutionType, int numberOfVariables, int numberOfObject
         std::cout << "Error: solution type " << solutionType << " invalid" << std::endl;
         exit(-1) ;
     }
-
-    fx_ = snew double[numberOfObjectives_] ;
-    x_ = snew double[numberOfVariables_];
 }
 
 DTLZ7::~DTLZ7()
@@ -81,36 +78,35 @@ DTLZ7::~DTLZ7()
  */
 void DTLZ7::evaluate(Solution *solution)
 {
-    XReal * vars = snew XReal(solution);
-    double g = 0.0;
+    evaluateVector(readVariables(solution), solution->getObjectives());
+} // evaluate
 
-    int k = numberOfVariables_ - numberOfObjectives_ + 1;
-    double alpha = 100.0;
 
-    for (int i = 0; i < numberOfVariables_; i++)
-        x_[i] = vars->getValue(i);
+/**
+ * Evaluates a vector of decision variables
+ * @param x The decision variables
+ * @param fx Array receiving the objective values
+ */
+void DTLZ7::evaluateVector(const double * x, double * fx)
+{
+    int k = numberOfVariables_ - numberOfObjectives_ + 1;
 
+    double g = 0.0;
     for (int i = numberOfVariables_ - k; i < numberOfVariables_; i++)
-        g += x_[i] ;
+        g += x[i] ;
 
     g = 1 + (9.0 * g)/k ;
 
-
     for (int i = 0; i < numberOfObjectives_ - 1; i++)
-        fx_[i] = x_[i] ;
+        fx[i] = x[i] ;
 
     double h = 0.0 ;
     for (int i = 0; i < numberOfObjectives_ - 1; i++)
     {
-        h+=(fx_[i]/(1.0+g))*(1 + sin(3.0*PI*fx_[i])) ;
+        h+=(fx[i]/(1.0+g))*(1 + sin(3.0*PI*fx[i])) ;
     } //for
 
     h = numberOfObjectives_ - h ;
 
-    fx_[numberOfObjectives_ - 1] = (1+g)*h ;
-
-    for (int i = 0; i < numberOfObjectives_; i++)
-        solution->setObjective(i, fx_[i]);
-
-    delete vars ;
-} // evaluate
+    fx[numberOfObjectives_ - 1] = (1+g)*h ;
+} // evaluateVector
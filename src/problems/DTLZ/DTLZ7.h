@@ -34,11 +34,10 @@ class DTLZ7 : public Problem
 public:
     DTLZ7(string solutionType, int numberOfVariables = 12, int numberOfObjectives = 3);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
 
     virtual ~DTLZ7();
 private:
-    double * fx_ ;
-    double * x_  ;
     static const double PI ;
 };
 
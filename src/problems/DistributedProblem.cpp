@@ -0,0 +1,862 @@
+//  DistributedProblem.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <DistributedProblem.h>
+#include <XReal.h>
+#include <RealSolutionType.h>
+#include <ArrayRealSolutionType.h>
+#include <BinaryRealSolutionType.h>
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <typeinfo>
+#include <poll.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+
+const int DistributedProblem::RING_CAPACITY = 1024;
+
+
+/**
+ * Header of the messages exchanged with the workers. A request is followed
+ * by count vectors of decision variables, and its reply by count rows with
+ * the objective values, the overall constraint violation and the number of
+ * violated constraints.
+ */
+struct DistributedMessage
+{
+    int chunk;
+    int count;
+};
+
+
+/**
+ * Requests to the process that forks the workers, and its replies. The
+ * reply to SPAWN_WORKER carries the socket of the master to the new worker.
+ */
+struct SpawnerMessage
+{
+    int command;
+    pid_t pid;
+};
+
+static const int SPAWN_WORKER = 0;
+static const int STOP_WORKER = 1;
+
+
+/**
+ * Sends a whole buffer through a socket
+ * @return false if the other end has been closed
+ */
+static bool sendAll(int socket, const void * data, size_t size)
+{
+    const char * bytes = (const char *) data;
+    while (size > 0)
+    {
+        ssize_t sent = send(socket, bytes, size, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (sent <= 0)
+        {
+            return false;
+        }
+        bytes += sent;
+        size -= sent;
+    }
+    return true;
+} // sendAll
+
+
+/**
+ * Receives a whole buffer from a socket
+ * @return false if the other end has been closed or the timeout expired
+ */
+static bool receiveAll(int socket, void * data, size_t size)
+{
+    char * bytes = (char *) data;
+    while (size > 0)
+    {
+        ssize_t received = recv(socket, bytes, size, 0);
+        if (received < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (received <= 0)
+        {
+            return false;
+        }
+        bytes += received;
+        size -= received;
+    }
+    return true;
+} // receiveAll
+
+
+/**
+ * Sends a message to or from the process that forks the workers, together
+ * with a file descriptor if it is not negative
+ * @return false if the other end has been closed
+ */
+static bool sendMessage(int socket, const SpawnerMessage & message, int descriptor)
+{
+    struct iovec data = {(void *) &message, sizeof(message)};
+    char control[CMSG_SPACE(sizeof(int))];
+    struct msghdr header;
+    memset(&header, 0, sizeof(header));
+    memset(control, 0, sizeof(control));
+    header.msg_iov = &data;
+    header.msg_iovlen = 1;
+    if (descriptor >= 0)
+    {
+        header.msg_control = control;
+        header.msg_controllen = sizeof(control);
+        struct cmsghdr * item = CMSG_FIRSTHDR(&header);
+        item->cmsg_level = SOL_SOCKET;
+        item->cmsg_type = SCM_RIGHTS;
+        item->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(item), &descriptor, sizeof(int));
+    }
+
+    ssize_t sent;
+    do
+    {
+        sent = sendmsg(socket, &header, MSG_NOSIGNAL);
+    }
+    while ((sent < 0) && (errno == EINTR));
+    return (sent == sizeof(message));
+} // sendMessage
+
+
+/**
+ * Receives a message sent by <code>sendMessage</code>
+ * @param descriptor The file descriptor sent with the message, or -1
+ * @return false if the other end has been closed
+ */
+static bool receiveMessage(int socket, SpawnerMessage & message, int & descriptor)
+{
+    struct iovec data = {&message, sizeof(message)};
+    char control[CMSG_SPACE(sizeof(int))];
+    struct msghdr header;
+    memset(&header, 0, sizeof(header));
+    header.msg_iov = &data;
+    header.msg_iovlen = 1;
+    header.msg_control = control;
+    header.msg_controllen = sizeof(control);
+
+    ssize_t received;
+    do
+    {
+        received = recvmsg(socket, &header, 0);
+    }
+    while ((received < 0) && (errno == EINTR));
+
+    descriptor = -1;
+    struct cmsghdr * item = CMSG_FIRSTHDR(&header);
+    if ((received > 0) && (item != nullptr) &&
+            (item->cmsg_level == SOL_SOCKET) && (item->cmsg_type == SCM_RIGHTS))
+    {
+        memcpy(&descriptor, CMSG_DATA(item), sizeof(int));
+    }
+    return (received == sizeof(message));
+} // receiveMessage
+
+
+/**
+ * Constructor.
+ * Starts the process that forks the workers, and the workers
+ * @param problem The problem to wrap. It must outlive the wrapper
+ * @param numberOfWorkers The number of worker processes
+ * @param timeout Milliseconds a worker may take to evaluate a chunk before
+ * it is replaced (0 = no timeout)
+ * @param maxRetries Number of times an evaluation may fail before giving up
+ * @param transport How the vectors are handed to the workers
+ */
+DistributedProblem::DistributedProblem(Problem * problem, int numberOfWorkers,
+                                       int timeout, int maxRetries,
+                                       Transport transport)
+{
+    if (numberOfWorkers <= 0)
+    {
+        std::cout << "DistributedProblem: the number of workers must be positive: "
+                  << numberOfWorkers << std::endl;
+        exit(-1);
+    }
+    SolutionType * type = problem->solutionType_;
+    if ((typeid(*type) != typeid(RealSolutionType)) &&
+            (typeid(*type) != typeid(ArrayRealSolutionType)) &&
+            (typeid(*type) != typeid(BinaryRealSolutionType)))
+    {
+        std::cout << "DistributedProblem: problem " << problem->problemName_
+                  << " is not real-coded" << std::endl;
+        exit(-1);
+    }
+
+    problem_ = problem;
+    numberOfVariables_ = problem->numberOfVariables_;
+    numberOfObjectives_ = problem->numberOfObjectives_;
+    numberOfConstraints_ = problem->numberOfConstraints_;
+    problemName_ = problem->problemName_;
+    solutionType_ = problem->solutionType_;
+    lowerLimit_ = problem->lowerLimit_;
+    upperLimit_ = problem->upperLimit_;
+    precision_ = problem->precision_;
+    length_ = problem->length_;
+
+    timeout_ = timeout;
+    maxRetries_ = maxRetries;
+    restarts_ = 0;
+    ring_ = nullptr;
+    if (transport == SHARED_MEMORY)
+    {
+        ring_ = snew EvaluationRing(RING_CAPACITY, numberOfVariables_,
+                                    numberOfObjectives_ + 2);
+    }
+
+    // Forking is only safe while the program has a single thread, so every
+    // worker, including the replacements, is forked by a helper process
+    int sockets[2];
+    if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets) != 0)
+    {
+        std::cout << "DistributedProblem: socketpair failed" << std::endl;
+        exit(-1);
+    }
+    spawner_ = fork();
+    if (spawner_ < 0)
+    {
+        std::cout << "DistributedProblem: fork failed" << std::endl;
+        exit(-1);
+    }
+    if (spawner_ == 0)
+    {
+        close(sockets[0]);
+        control_ = sockets[1];
+        serveSpawner();
+    }
+    close(sockets[1]);
+    control_ = sockets[0];
+
+    Worker stopped = {-1, -1, -1, std::chrono::steady_clock::time_point()};
+    workers_.assign(numberOfWorkers, stopped);
+    for (int i = 0; i < numberOfWorkers; i++)
+    {
+        startWorker(i);
+    }
+} // DistributedProblem
+
+
+/**
+ * Destructor. Closes the sockets or stops the ring, so that the workers
+ * finish, and waits for the helper process, which waits for them. The
+ * description of the problem is shared with the wrapped problem.
+ */
+DistributedProblem::~DistributedProblem()
+{
+    if (ring_ != nullptr)
+    {
+        ring_->stop();
+    }
+    for (int i = 0; i < workers_.size(); i++)
+    {
+        close(workers_[i].socket);
+    }
+    close(control_);
+    waitpid(spawner_, nullptr, 0);
+    delete ring_;
+} // ~DistributedProblem
+
+
+/**
+ * Evaluates the objectives and the constraints of a solution in a worker
+ * @param solution The solution to evaluate
+ */
+void DistributedProblem::evaluate(Solution * solution)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_.resize(numberOfVariables_);
+    pack(solution, 0);
+    run(1);
+    unpack(solution, 0);
+} // evaluate
+
+
+/**
+ * Does nothing: the constraints are evaluated together with the objectives
+ * @param solution The solution to evaluate
+ */
+void DistributedProblem::evaluateConstraints(Solution * solution)
+{
+} // evaluateConstraints
+
+
+/**
+ * Evaluates the objectives and the constraints of the solutions of a set,
+ * spreading them over the workers
+ * @param solutionSet The solutions to evaluate
+ */
+void DistributedProblem::evaluateSolutions(SolutionSet * solutionSet)
+{
+    int count = solutionSet->size();
+    if (count == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_.resize((size_t) count * numberOfVariables_);
+    for (int i = 0; i < count; i++)
+    {
+        pack(solutionSet->get(i), i);
+    }
+    run(count);
+    for (int i = 0; i < count; i++)
+    {
+        unpack(solutionSet->get(i), i);
+    }
+} // evaluateSolutions
+
+
+/**
+ * Evaluates count vectors of decision variables stored row by row in x,
+ * spreading them over the workers
+ * @param x Matrix of count x numberOfVariables_ decision variables
+ * @param fx Matrix of count x numberOfObjectives_ objective values
+ * @param count The number of vectors
+ */
+void DistributedProblem::evaluateBatch(const double * x, double * fx, int count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_.assign(x, x + (size_t) count * numberOfVariables_);
+    run(count);
+    int rowSize = numberOfObjectives_ + 2;
+    for (int i = 0; i < count; i++)
+    {
+        std::copy(replies_.begin() + (size_t) i * rowSize,
+                  replies_.begin() + (size_t) i * rowSize + numberOfObjectives_,
+                  fx + (size_t) i * numberOfObjectives_);
+    }
+} // evaluateBatch
+
+
+/**
+ * Evaluates a vector of decision variables in a worker
+ * @param x The numberOfVariables_ decision variables
+ * @param fx The numberOfObjectives_ objective values
+ */
+void DistributedProblem::evaluateVector(const double * x, double * fx)
+{
+    evaluateBatch(x, fx, 1);
+} // evaluateVector
+
+
+/**
+ * Returns the number of worker processes
+ */
+int DistributedProblem::getNumberOfWorkers()
+{
+    return workers_.size();
+} // getNumberOfWorkers
+
+
+/**
+ * Returns the number of workers that have been replaced because they died
+ * or timed out
+ */
+long DistributedProblem::getRestarts()
+{
+    return restarts_;
+} // getRestarts
+
+
+/**
+ * Evaluates the count vectors stored in requests_, writing the replies to
+ * replies_. The vectors are split in chunks, which are handed to the idle
+ * workers as they finish their previous ones.
+ * @param count The number of vectors
+ */
+void DistributedProblem::run(int count)
+{
+    if (ring_ != nullptr)
+    {
+        runRing(count);
+        return;
+    }
+
+    int numberOfWorkers = workers_.size();
+    int rowSize = numberOfObjectives_ + 2;
+    replies_.resize((size_t) count * rowSize);
+
+    // About two chunks per worker, to balance the load
+    int chunkSize = std::max(1, (count + 2 * numberOfWorkers - 1) / (2 * numberOfWorkers));
+    int numberOfChunks = (count + chunkSize - 1) / chunkSize;
+
+    std::deque<int> pending;
+    for (int i = 0; i < numberOfChunks; i++)
+    {
+        pending.push_back(i);
+    }
+    std::vector<int> failures(numberOfChunks, 0);
+    std::vector<struct pollfd> descriptors(numberOfWorkers);
+    std::vector<int> busy(numberOfWorkers);
+    int completed = 0;
+
+    // Replaces a worker and sends its chunk again
+    auto fail = [&](int index)
+    {
+        int chunk = workers_[index].chunk;
+        stopWorker(index);
+        startWorker(index);
+        restarts_++;
+        if (++failures[chunk] > maxRetries_)
+        {
+            std::cout << "DistributedProblem: the evaluation of " << problemName_
+                      << " failed " << failures[chunk] << " times" << std::endl;
+            exit(-1);
+        }
+        pending.push_front(chunk);
+    };
+
+    while (completed < numberOfChunks)
+    {
+        // Hand the pending chunks to the idle workers
+        for (int i = 0; (i < numberOfWorkers) && !pending.empty(); i++)
+        {
+            if (workers_[i].chunk >= 0)
+            {
+                continue;
+            }
+            int chunk = pending.front();
+            pending.pop_front();
+            int first = chunk * chunkSize;
+            DistributedMessage request = {chunk, std::min(chunkSize, count - first)};
+            workers_[i].chunk = chunk;
+            workers_[i].deadline = std::chrono::steady_clock::now() +
+                                   std::chrono::milliseconds(timeout_);
+            if (!sendAll(workers_[i].socket, &request, sizeof(request)) ||
+                    !sendAll(workers_[i].socket, &requests_[(size_t) first * numberOfVariables_],
+                             (size_t) request.count * numberOfVariables_ * sizeof(double)))
+            {
+                fail(i);
+            }
+        }
+
+        // Wait for the replies of the busy workers
+        int size = 0;
+        int wait = -1;
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        for (int i = 0; i < numberOfWorkers; i++)
+        {
+            if (workers_[i].chunk >= 0)
+            {
+                descriptors[size].fd = workers_[i].socket;
+                descriptors[size].events = POLLIN;
+                descriptors[size].revents = 0;
+                busy[size++] = i;
+                if (timeout_ > 0)
+                {
+                    long left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    workers_[i].deadline - now).count();
+                    left = std::max(0L, left);
+                    wait = (wait < 0) ? left : std::min((long) wait, left);
+                }
+            }
+        }
+        if (size == 0)
+        {
+            continue;
+        }
+        if ((poll(descriptors.data(), size, wait) < 0) && (errno != EINTR))
+        {
+            std::cout << "DistributedProblem: poll failed" << std::endl;
+            exit(-1);
+        }
+
+        now = std::chrono::steady_clock::now();
+        for (int j = 0; j < size; j++)
+        {
+            int i = busy[j];
+            int chunk = workers_[i].chunk;
+            if (descriptors[j].revents != 0)
+            {
+                DistributedMessage reply;
+                int first = chunk * chunkSize;
+                if (receiveAll(workers_[i].socket, &reply, sizeof(reply)) &&
+                        (reply.chunk == chunk) &&
+                        receiveAll(workers_[i].socket, &replies_[(size_t) first * rowSize],
+                                   (size_t) reply.count * rowSize * sizeof(double)))
+                {
+                    workers_[i].chunk = -1;
+                    completed++;
+                }
+                else
+                {
+                    fail(i);
+                }
+            }
+            else if ((timeout_ > 0) && (now >= workers_[i].deadline))
+            {
+                fail(i);
+            }
+        }
+    }
+} // run
+
+
+/**
+ * Evaluates the count vectors stored in requests_ through the ring, writing
+ * the replies to replies_. Batches larger than the ring are published in
+ * several rounds.
+ * @param count The number of vectors
+ */
+void DistributedProblem::runRing(int count)
+{
+    int rowSize = numberOfObjectives_ + 2;
+    replies_.resize((size_t) count * rowSize);
+
+    // Dead workers are looked for at least this often
+    int interval = (timeout_ > 0) ? std::min(timeout_, 50) : 50;
+    std::vector<int> failures(ring_->getCapacity());
+    std::vector<int> owners(ring_->getCapacity());
+    std::vector<std::chrono::steady_clock::time_point> claims(ring_->getCapacity());
+
+    for (int first = 0; first < count; first += ring_->getCapacity())
+    {
+        int size = std::min(ring_->getCapacity(), count - first);
+        for (int i = 0; i < size; i++)
+        {
+            std::copy(requests_.begin() + (size_t) (first + i) * numberOfVariables_,
+                      requests_.begin() + (size_t) (first + i + 1) * numberOfVariables_,
+                      ring_->getVariables(i));
+        }
+        std::fill(failures.begin(), failures.begin() + size, 0);
+        std::fill(owners.begin(), owners.begin() + size, 0);
+        ring_->publish(size);
+
+        while (!ring_->wait(interval))
+        {
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            for (int i = 0; i < workers_.size(); i++)
+            {
+                // Replace the worker if it has died or is late with a slot
+                pid_t pid = workers_[i].pid;
+                bool failed = !isAlive(i);
+                for (int j = 0; (j < size) && !failed; j++)
+                {
+                    if (ring_->getState(j) != pid)
+                    {
+                        continue;
+                    }
+                    if (owners[j] != pid)
+                    {
+                        owners[j] = pid;
+                        claims[j] = now;
+                    }
+                    failed = (timeout_ > 0) &&
+                             (now - claims[j] >= std::chrono::milliseconds(timeout_));
+                }
+                if (!failed)
+                {
+                    continue;
+                }
+
+                stopWorker(i);
+                startWorker(i);
+                restarts_++;
+                for (int j = 0; j < size; j++)
+                {
+                    if (ring_->getState(j) != pid)
+                    {
+                        continue;
+                    }
+                    if (++failures[j] > maxRetries_)
+                    {
+                        std::cout << "DistributedProblem: the evaluation of " << problemName_
+                                  << " failed " << failures[j] << " times" << std::endl;
+                        exit(-1);
+                    }
+                    owners[j] = 0;
+                    ring_->retry(j);
+                }
+            }
+        }
+
+        for (int i = 0; i < size; i++)
+        {
+            std::copy(ring_->getResults(i), ring_->getResults(i) + rowSize,
+                      replies_.begin() + (size_t) (first + i) * rowSize);
+        }
+    }
+} // runRing
+
+
+/**
+ * Starts a worker process, forked by the helper process
+ * @param index The position of the worker
+ */
+void DistributedProblem::startWorker(int index)
+{
+    SpawnerMessage request = {SPAWN_WORKER, 0};
+    SpawnerMessage reply;
+    int socket = -1;
+    if (!sendMessage(control_, request, -1) ||
+            !receiveMessage(control_, reply, socket) || (reply.pid < 0) || (socket < 0))
+    {
+        std::cout << "DistributedProblem: unable to start a worker" << std::endl;
+        exit(-1);
+    }
+
+    workers_[index].pid = reply.pid;
+    workers_[index].socket = socket;
+    workers_[index].chunk = -1;
+
+    // A worker hanging in the middle of a reply is detected as well
+    if ((ring_ == nullptr) && (timeout_ > 0))
+    {
+        struct timeval limit;
+        limit.tv_sec = timeout_ / 1000;
+        limit.tv_usec = (timeout_ % 1000) * 1000;
+        setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &limit, sizeof(limit));
+    }
+} // startWorker
+
+
+/**
+ * Kills a worker process
+ * @param index The position of the worker
+ */
+void DistributedProblem::stopWorker(int index)
+{
+    close(workers_[index].socket);
+    if (workers_[index].pid > 0)
+    {
+        SpawnerMessage request = {STOP_WORKER, workers_[index].pid};
+        SpawnerMessage reply;
+        int unused;
+        if (!sendMessage(control_, request, -1) ||
+                !receiveMessage(control_, reply, unused))
+        {
+            std::cout << "DistributedProblem: unable to stop a worker" << std::endl;
+            exit(-1);
+        }
+    }
+    workers_[index].pid = -1;
+    workers_[index].socket = -1;
+    workers_[index].chunk = -1;
+} // stopWorker
+
+
+/**
+ * Checks whether a worker is still running. Every worker keeps its end of
+ * its socket open, even with the ring, so the end of the master hangs up
+ * when the worker dies
+ * @param index The position of the worker
+ */
+bool DistributedProblem::isAlive(int index)
+{
+    struct pollfd descriptor = {workers_[index].socket, POLLIN, 0};
+    int ready;
+    do
+    {
+        ready = poll(&descriptor, 1, 0);
+    }
+    while ((ready < 0) && (errno == EINTR));
+    return (ready == 0);
+} // isAlive
+
+
+/**
+ * Main loop of the helper process: forks and kills workers on request of
+ * the master, until the master closes its socket. The helper never starts
+ * a thread, so it is always safe to fork from it
+ */
+void DistributedProblem::serveSpawner()
+{
+    // The helper, and therefore its workers, must not outlive the master
+    prctl(PR_SET_PDEATHSIG, SIGKILL);
+
+    SpawnerMessage request;
+    int unused;
+    while (receiveMessage(control_, request, unused))
+    {
+        SpawnerMessage reply = {request.command, -1};
+        int sockets[2] = {-1, -1};
+        if (request.command == STOP_WORKER)
+        {
+            kill(request.pid, SIGKILL);
+            waitpid(request.pid, nullptr, 0);
+            reply.pid = request.pid;
+        }
+        else if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0)
+        {
+            reply.pid = fork();
+            if (reply.pid == 0)
+            {
+                // The worker would wait forever for a master that has died
+                prctl(PR_SET_PDEATHSIG, SIGKILL);
+                close(control_);
+                close(sockets[0]);
+                if (ring_ != nullptr)
+                {
+                    serveRing();
+                }
+                serve(sockets[1]);
+            }
+            close(sockets[1]);
+        }
+        sendMessage(control_, reply, (reply.pid > 0) ? sockets[0] : -1);
+        if (sockets[0] >= 0)
+        {
+            close(sockets[0]);
+        }
+    }
+
+    // The workers finish once the master has closed their sockets or
+    // stopped the ring
+    while (waitpid(-1, nullptr, 0) > 0)
+    {
+    }
+    _exit(0);
+} // serveSpawner
+
+
+/**
+ * Main loop of a worker process: evaluates the chunks it receives until the
+ * master closes the socket
+ * @param socket The socket connected to the master
+ */
+void DistributedProblem::serve(int socket)
+{
+    int rowSize = numberOfObjectives_ + 2;
+    Solution * solution = snew Solution(problem_);
+    XReal vars(solution);
+    std::vector<double> x;
+    std::vector<double> y;
+    DistributedMessage message;
+
+    while (receiveAll(socket, &message, sizeof(message)))
+    {
+        x.resize((size_t) message.count * numberOfVariables_);
+        y.resize((size_t) message.count * rowSize);
+        if (!receiveAll(socket, x.data(), x.size() * sizeof(double)))
+        {
+            break;
+        }
+        for (int i = 0; i < message.count; i++)
+        {
+            vars.setValues(&x[(size_t) i * numberOfVariables_]);
+            solution->setOverallConstraintViolation(0.0);
+            solution->setNumberOfViolatedConstraints(0);
+            problem_->evaluate(solution);
+            problem_->evaluateConstraints(solution);
+
+            double * row = &y[(size_t) i * rowSize];
+            for (int j = 0; j < numberOfObjectives_; j++)
+            {
+                row[j] = solution->getObjective(j);
+            }
+            row[numberOfObjectives_] = solution->getOverallConstraintViolation();
+            row[numberOfObjectives_ + 1] = solution->getNumberOfViolatedConstraints();
+        }
+        if (!sendAll(socket, &message, sizeof(message)) ||
+                !sendAll(socket, y.data(), y.size() * sizeof(double)))
+        {
+            break;
+        }
+    }
+
+    // The worker must not run the destructors and exit handlers of the master
+    _exit(0);
+} // serve
+
+
+/**
+ * Main loop of a worker process using the ring: evaluates the slots it
+ * claims until the ring is stopped
+ */
+void DistributedProblem::serveRing()
+{
+    int owner = getpid();
+    Solution * solution = snew Solution(problem_);
+    XReal vars(solution);
+    int slot;
+
+    while ((slot = ring_->claim(owner)) >= 0)
+    {
+        vars.setValues(ring_->getVariables(slot));
+        solution->setOverallConstraintViolation(0.0);
+        solution->setNumberOfViolatedConstraints(0);
+        problem_->evaluate(solution);
+        problem_->evaluateConstraints(solution);
+
+        double * row = ring_->getResults(slot);
+        for (int j = 0; j < numberOfObjectives_; j++)
+        {
+            row[j] = solution->getObjective(j);
+        }
+        row[numberOfObjectives_] = solution->getOverallConstraintViolation();
+        row[numberOfObjectives_ + 1] = solution->getNumberOfViolatedConstraints();
+        ring_->complete(slot);
+    }
+
+    _exit(0);
+} // serveRing
+
+
+/**
+ * Copies the decision variables of a solution to the requests
+ * @param solution The solution
+ * @param index Its row in the requests
+ */
+void DistributedProblem::pack(Solution * solution, int index)
+{
+    double * x = readVariables(solution);
+    std::copy(x, x + numberOfVariables_,
+              requests_.begin() + (size_t) index * numberOfVariables_);
+} // pack
+
+
+/**
+ * Copies the objectives and the constraint violation of a reply to a
+ * solution
+ * @param solution The solution
+ * @param index Its row in the replies
+ */
+void DistributedProblem::unpack(Solution * solution, int index)
+{
+    const double * row = &replies_[(size_t) index * (numberOfObjectives_ + 2)];
+    for (int j = 0; j < numberOfObjectives_; j++)
+    {
+        solution->setObjective(j, row[j]);
+    }
+    solution->setOverallConstraintViolation(row[numberOfObjectives_]);
+    solution->setNumberOfViolatedConstraints((int) row[numberOfObjectives_ + 1]);
+} // unpack
@@ -0,0 +1,118 @@
+//  DistributedProblem.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __DISTRIBUTED_PROBLEM__
+#define __DISTRIBUTED_PROBLEM__
+
+#include <Problem.h>
+#include <Solution.h>
+#include <SolutionSet.h>
+#include <EvaluationRing.h>
+#include <chrono>
+#include <mutex>
+#include <sys/types.h>
+#include <vector>
+
+/**
+ * This class wraps a real-coded problem so that its evaluations run in
+ * worker processes. It is meant for evaluators that are costly and cannot be
+ * called from several threads (e.g. external native code), so that they can
+ * use all the cores of a machine.
+ *
+ * The workers are not forked by the master, which may run other threads by
+ * the time a worker has to be replaced, but by a helper process started
+ * when the wrapper is created. Each worker is thus a copy of the
+ * single-threaded program as it was at that point, with its own copy of the
+ * wrapped problem. The workers receive the decision vectors and
+ * send back the objective values and the constraint violations, which are
+ * written to the solutions in their original order whatever the order in
+ * which they are completed. Two transports are available:
+ *  - SOCKETS: chunks of vectors are sent through Unix domain sockets
+ *  - SHARED_MEMORY: the vectors are written to an <code>EvaluationRing</code>
+ *    and the workers claim them one at a time, without system calls other
+ *    than the wake-ups. It only works on Linux
+ *
+ * A worker that dies, or that does not answer within the timeout, is killed
+ * and replaced by a new one, and its work is sent again. The program stops
+ * if the same work fails more than maxRetries times.
+ *
+ * Algorithms evaluating their solutions through
+ * <code>evaluateSolutions</code> (NSGAII, SMPSO) keep all the workers busy;
+ * <code>evaluate</code> sends one solution at a time. The constraints are
+ * computed together with the objectives, so
+ * <code>evaluateConstraints</code> does nothing. Calls from several threads
+ * are serialized. The wrapper must be created before starting any thread,
+ * and the wrapped problem, which is not owned, must outlive it.
+ */
+class DistributedProblem : public Problem
+{
+
+public:
+    enum Transport { SOCKETS, SHARED_MEMORY };
+
+private:
+    static const int RING_CAPACITY;
+
+    struct Worker
+    {
+        pid_t pid;
+        int socket;
+        int chunk;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    Problem * problem_;
+    pid_t spawner_;
+    int control_;
+    std::vector<Worker> workers_;
+    int timeout_;
+    int maxRetries_;
+    EvaluationRing * ring_;
+    long restarts_;
+    std::mutex mutex_;
+    std::vector<double> requests_;
+    std::vector<double> replies_;
+
+    void startWorker(int index);
+    void stopWorker(int index);
+    void serveSpawner();
+    bool isAlive(int index);
+    void serve(int socket);
+    void serveRing();
+    void run(int count);
+    void runRing(int count);
+    void pack(Solution * solution, int index);
+    void unpack(Solution * solution, int index);
+
+public:
+    DistributedProblem(Problem * problem, int numberOfWorkers, int timeout = 0,
+                       int maxRetries = 3, Transport transport = SOCKETS);
+    ~DistributedProblem();
+    void evaluate(Solution * solution);
+    void evaluateConstraints(Solution * solution);
+    void evaluateSolutions(SolutionSet * solutionSet);
+    void evaluateBatch(const double * x, double * fx, int count);
+    void evaluateVector(const double * x, double * fx);
+    int getNumberOfWorkers();
+    long getRestarts();
+
+}; // DistributedProblem
+
+#endif
@@ -20,170 +20,154 @@
 
 #include <LZ09.h>
 
-/**
- * Constructor
- */
-LZ09::LZ09(int nvar, int nobj, int ptype, int dtype, int ltype)
-{
-    nvar_ = nvar ;
-    nobj_ = nobj ;
-    ltype_ = ltype ;
-    dtype_ = dtype ;
-    ptype_ = ptype ;
-} // LZ09::LZ09
 
 /**
- * Alpha function
+ * Alpha (shape) function
  */
-void LZ09::alphaFunction(double *alpha, VectorOfDouble * x, int dim, int type)
+template <int TYPE>
+static inline void alphaFunction(double * alpha, const double * x)
 {
-    if (dim == 2)
+    if (TYPE == 21)
     {
-        if (type == 21)
-        {
-            alpha[0] = (*x)[0];
-            alpha[1] = 1 - sqrt((*x)[0]);
-        }
+        alpha[0] = x[0];
+        alpha[1] = 1 - sqrt(x[0]);
+    }
 
-        if (type == 22)
-        {
-            alpha[0] = (*x)[0];
-            alpha[1] = 1 - (*x)[0] * (*x)[0];
-        }
+    if (TYPE == 22)
+    {
+        alpha[0] = x[0];
+        alpha[1] = 1 - x[0] * x[0];
+    }
 
-        if (type == 23)
-        {
-            alpha[0] = (*x)[0];
-            alpha[1] = 1 - sqrt(alpha[0]) - alpha[0]
-                       * sin(10 * alpha[0] * alpha[0] * 3.141596);
-        }
+    if (TYPE == 23)
+    {
+        alpha[0] = x[0];
+        alpha[1] = 1 - sqrt(alpha[0]) - alpha[0]
+                   * sin(10 * alpha[0] * alpha[0] * 3.141596);
+    }
 
-        if (type == 24)
-        {
-            alpha[0] = (*x)[0];
-            alpha[1] = 1 - (*x)[0] - 0.05 * sin(4 * 3.141596 * (*x)[0]);
-        }
+    if (TYPE == 24)
+    {
+        alpha[0] = x[0];
+        alpha[1] = 1 - x[0] - 0.05 * sin(4 * 3.141596 * x[0]);
     }
-    else
+
+    if (TYPE == 31)
     {
-        if (type == 31)
-        {
-            alpha[0] = cos((*x)[0] * 3.141596 / 2) * cos(x->at(1) * 3.141596 / 2);
-            alpha[1] = cos((*x)[0] * 3.141596 / 2) * sin(x->at(1) * 3.141596 / 2);
-            alpha[2] = sin((*x)[0] * 3.141596 / 2);
-        }
+        alpha[0] = cos(x[0] * 3.141596 / 2) * cos(x[1] * 3.141596 / 2);
+        alpha[1] = cos(x[0] * 3.141596 / 2) * sin(x[1] * 3.141596 / 2);
+        alpha[2] = sin(x[0] * 3.141596 / 2);
+    }
 
-        if (type == 32)
-        {
-            alpha[0] = 1 - cos((*x)[0] * 3.141596 / 2)
-                       * cos(x->at(1) * 3.141596 / 2);
-            alpha[1] = 1 - cos((*x)[0] * 3.141596 / 2)
-                       * sin(x->at(1) * 3.141596 / 2);
-            alpha[2] = 1 - sin((*x)[0] * 3.141596 / 2);
-        }
+    if (TYPE == 32)
+    {
+        alpha[0] = 1 - cos(x[0] * 3.141596 / 2)
+                   * cos(x[1] * 3.141596 / 2);
+        alpha[1] = 1 - cos(x[0] * 3.141596 / 2)
+                   * sin(x[1] * 3.141596 / 2);
+        alpha[2] = 1 - sin(x[0] * 3.141596 / 2);
+    }
 
-        if (type == 33)
-        {
-            alpha[0] = (*x)[0];
-            alpha[1] = x->at(1);
-            alpha[2] = 3
-                       - (sin(3 * 3.141596 * (*x)[0]) + sin(3 * 3.141596 * x->at(1))) - 2
-                       * ((*x)[0] + x->at(1));
-        }
+    if (TYPE == 33)
+    {
+        alpha[0] = x[0];
+        alpha[1] = x[1];
+        alpha[2] = 3
+                   - (sin(3 * 3.141596 * x[0]) + sin(3 * 3.141596 * x[1])) - 2
+                   * (x[0] + x[1]);
+    }
 
-        if (type == 34)
-        {
-            alpha[0] = (*x)[0] * x->at(1);
-            alpha[1] = (*x)[0] * (1 - x->at(1));
-            alpha[2] = (1 - (*x)[0]);
-        }
+    if (TYPE == 34)
+    {
+        alpha[0] = x[0] * x[1];
+        alpha[1] = x[0] * (1 - x[1]);
+        alpha[2] = (1 - x[0]);
     }
-}
+} // alphaFunction
+
 
 /**
- * Beta function
+ * Beta (distance) function, accumulated one linkage value at a time so that
+ * the values do not have to be stored
  */
-
-
-double LZ09::betaFunction(VectorOfDouble * x, int type)
+template <int TYPE>
+class BetaFunction
 {
+private:
+    double sum_ ;
+    double prod_ ;
+    int dim_ ;
 
-    double beta;
-    beta = 0;
-
-    int dim = x->size() ;
-
-    if (dim == 0)
-        beta = 0;
+public:
+    BetaFunction() : sum_(0), prod_(1), dim_(0) { }
 
-    if (type == 1)
+    inline void add(double x)
     {
-        beta = 0;
-        for (int i = 0; i < dim; i++)
+        if (TYPE == 1)
         {
-            beta += x->at(i) * x->at(i);
+            sum_ += x * x;
         }
-        beta = 2.0 * beta / dim;
-    }
 
-    if (type == 2)
-    {
-        beta = 0;
-        for (int i = 0; i < dim; i++)
+        if (TYPE == 2)
         {
-            beta += sqrt(i + 1) * x->at(i) * x->at(i);
+            sum_ += sqrt(dim_ + 1) * x * x;
         }
-        beta = 2.0 * beta / dim;
-    }
 
-    if (type == 3)
-    {
-        double sum = 0, xx;
-        for (int i = 0; i < dim; i++)
+        if (TYPE == 3)
         {
-            xx = 2 * x->at(i);
-            sum += (xx * xx - cos(4 * 3.141596 * xx) + 1);
+            double xx = 2 * x;
+            sum_ += (xx * xx - cos(4 * 3.141596 * xx) + 1);
         }
-        beta = 2.0 * sum / dim;
-    }
 
-    if (type == 4)
+        if (TYPE == 4)
+        {
+            double xx = 2 * x;
+            sum_ += xx * xx;
+            prod_ *= cos(10 * 3.141596 * xx / sqrt(dim_ + 1));
+        }
+        dim_++;
+    } // add
+
+    inline double value() const
     {
-        double sum = 0, prod = 1, xx;
-        for (int i = 0; i < dim; i++)
+        if (TYPE == 4)
         {
-            xx = 2 * x->at(i);
-            sum += xx * xx;
-            prod *= cos(10 * 3.141596 * xx / sqrt(i + 1));
+            return 2.0 * (sum_ - 2 * prod_ + 2) / dim_;
         }
-        beta = 2.0 * (sum - 2 * prod + 2) / dim;
-    }
-    return beta;
-}
+        return 2.0 * sum_ / dim_;
+    } // value
+
+}; // BetaFunction
+
 
-double LZ09::psfunc2(double x, double t1, int dim, int type, int css)
+/**
+ * Linkage function of the two-objective problems
+ * @param exponent 0.5*(nvar + 3*dim - 8)/(nvar - 2), used by type 21
+ * @param phase dim*pi/nvar
+ */
+template <int TYPE>
+static inline double psfunc2(double x, double t1, double exponent,
+                             double phase, int css)
 {
     double beta;
     beta = 0.0;
 
-    dim++;
-
-    if(type==21)
+    if(TYPE==21)
     {
         double xy   = 2*(x - 0.5);
-        beta = xy - pow(t1, 0.5*(nvar_ + 3*dim - 8)/(nvar_ - 2));
+        beta = xy - pow(t1, exponent);
     }
 
-    if(type==22)
+    if(TYPE==22)
     {
-        double theta = 6*3.141596*t1 + dim*3.141596/nvar_;
+        double theta = 6*3.141596*t1 + phase;
         double xy    = 2*(x - 0.5);
         beta = xy - sin(theta);
     }
 
-    if(type==23)
+    if(TYPE==23)
     {
-        double theta = 6*3.141596*t1 + dim*3.141596/nvar_;
+        double theta = 6*3.141596*t1 + phase;
         double ra    = 0.8*t1;
         double xy    = 2*(x - 0.5);
         if(css==1)
@@ -194,9 +178,9 @@ double LZ09::psfunc2(double x, double t1, int dim, int type, int css)
         }
     }
 
-    if(type==24)
+    if(TYPE==24)
     {
-        double theta = 6*3.141596*t1 + dim*3.141596/nvar_;
+        double theta = 6*3.141596*t1 + phase;
         double xy    = 2*(x - 0.5);
         double ra    = 0.8*t1;
         if(css==1)
@@ -207,11 +191,11 @@ double LZ09::psfunc2(double x, double t1, int dim, int type, int css)
         }
     }
 
-    if(type==25)
+    if(TYPE==25)
     {
         double rho   = 0.8;
         double phi   = 3.141596*t1;
-        double theta = 6*3.141596*t1 + dim*3.141596/nvar_;
+        double theta = 6*3.141596*t1 + phase;
         double xy    = 2*(x - 0.5);
         if(css==1)
             beta = xy - rho*sin(phi)*sin(theta);
@@ -221,9 +205,9 @@ double LZ09::psfunc2(double x, double t1, int dim, int type, int css)
             beta = xy - rho*cos(phi);
     }
 
-    if(type==26)
+    if(TYPE==26)
     {
-        double theta = 6*3.141596*t1 + dim*3.141596/nvar_;
+        double theta = 6*3.141596*t1 + phase;
         double ra    = 0.3*t1*(t1*cos(4*theta) + 2);
         double xy    = 2*(x - 0.5);
         if(css==1)
@@ -235,142 +219,230 @@ double LZ09::psfunc2(double x, double t1, int dim, int type, int css)
     }
 
     return beta;
-}
+} // psfunc2
+
 
-double LZ09::psfunc3(double x, double t1, double t2, int dim, int type)
+/**
+ * Linkage function of the three-objective problems
+ * @param rate dim/nvar, used by type 31
+ * @param phase dim*pi/nvar, used by type 32
+ */
+template <int TYPE>
+static inline double psfunc3(double x, double t1, double t2, double rate,
+                             double phase)
 {
-    // type:  the type of curve
-    // css:   the class of index
     double beta;
     beta = 0.0 ;
 
-    dim++;
-
-    if(type==31)
+    if(TYPE==31)
     {
         double xy  = 4*(x - 0.5);
-        double rate = 1.0*dim/nvar_;
         beta = xy - 4*(t1*t1*rate + t2*(1.0-rate)) + 2;
     }
 
-    if(type==32)
+    if(TYPE==32)
     {
-        double theta = 2*3.141596*t1 + dim*3.141596/nvar_;
+        double theta = 2*3.141596*t1 + phase;
         double xy    = 4*(x - 0.5);
         beta = xy - 2*t2*sin(theta);
     }
 
     return beta;
-}
+} // psfunc3
 
-void LZ09::objective(VectorOfDouble *x_var, std::vector <double> *y_obj)
+
+/**
+ * Constructor
+ */
+LZ09::LZ09(int nvar, int nobj, int ptype, int dtype, int ltype)
 {
-    // 2-objective case
-    if(nobj_==2)
-    {
-        if(ltype_==21||ltype_==22||ltype_==23||ltype_==24||ltype_==26)
-        {
-            double g = 0, h = 0, a, b;
-            std::vector <double> aa  ; // *aa = new vector();
-            std::vector <double> bb ; // *bb = new vector();
-            for(int n=1; n<nvar_; n++)
-            {
+    nvar_ = nvar ;
+    nobj_ = nobj ;
+    ltype_ = ltype ;
+    dtype_ = dtype ;
+    ptype_ = ptype ;
 
-                if(n%2==0)
-                {
-                    a = psfunc2(x_var->at(n),x_var->at(0),n,ltype_,1);  // linkage
-                    aa.push_back(a);
-                }
-                else
-                {
-                    b = psfunc2(x_var->at(n),x_var->at(0),n,ltype_,2);
-                    bb.push_back(b);
-                }
+    kernel_ = selectKernel(ptype, dtype, ltype) ;
+    if ((kernel_ == nullptr) || ((nobj == 2) != (ptype < 30)) ||
+            ((nobj != 2) && (nobj != 3)))
+    {
+        std::cout << "LZ09::LZ09: invalid combination of " << nobj
+                  << " objectives, ptype " << ptype << ", dtype " << dtype
+                  << " and ltype " << ltype << std::endl;
+        exit(-1) ;
+    }
 
-            }
+    phase_.resize(nvar_) ;
+    exponent_.resize(nvar_) ;
+    rate_.resize(nvar_) ;
+    for (int n = 0; n < nvar_; n++)
+    {
+        int dim = n + 1 ;
+        phase_[n]    = dim*3.141596/nvar_ ;
+        exponent_[n] = 0.5*(nvar_ + 3*dim - 8)/(nvar_ - 2) ;
+        rate_[n]     = 1.0*dim/nvar_ ;
+    } // for
+} // LZ09::LZ09
 
-            g = betaFunction(&aa, dtype_);
-            h = betaFunction(&bb, dtype_);
 
-            double alpha[2] ;
-            alphaFunction(alpha,x_var,2,ptype_);  // shape function
-            y_obj->at(0) = alpha[0] + h;
-            y_obj->at(1) = alpha[1] + g;
-            aa.clear();
-            bb.clear();
-        }
+/**
+ * Two-objective kernel
+ */
+template <int PTYPE, int DTYPE, int LTYPE>
+void LZ09::objective2(const LZ09 * lz09, const double * x, double * y)
+{
+    BetaFunction<DTYPE> g ;
+    BetaFunction<DTYPE> h ;
 
-        if(ltype_==25)
+    for(int n=1; n<lz09->nvar_; n++)
+    {
+        double exponent = lz09->exponent_[n] ;
+        double phase    = lz09->phase_[n] ;
+        if(LTYPE==25)
         {
-            double g = 0, h = 0, a, b;
-            double e = 0, c;
-            std::vector <double> aa ; //= new Vector() ;
-            std::vector <double> bb ; //= new Vector() ;
-            for(int n=1; n<nvar_; n++)
+            if(n%3==0)
+                g.add(psfunc2<LTYPE>(x[n],x[0],exponent,phase,1));
+            else if(n%3==1)
+                h.add(psfunc2<LTYPE>(x[n],x[0],exponent,phase,2));
+            else
             {
-                if(n%3==0)
-                {
-                    a = psfunc2(x_var->at(n),x_var->at(0),n,ltype_,1);
-                    aa.push_back(a);
-                }
-                else if(n%3==1)
-                {
-                    b = psfunc2(x_var->at(n),x_var->at(0),n,ltype_,2);
-                    bb.push_back(b);
-                }
-                else
-                {
-                    c = psfunc2(x_var->at(n),x_var->at(0),n,ltype_,3);
-                    if(n%2==0)    aa.push_back(c);
-                    else          bb.push_back(c);
-                }
+                double c = psfunc2<LTYPE>(x[n],x[0],exponent,phase,3);
+                if(n%2==0)    g.add(c);
+                else          h.add(c);
             }
-            g = betaFunction(&aa,dtype_);          // distance function
-            h = betaFunction(&bb,dtype_);
-
-            //double * alpha = snew double[2];
-            double alpha[2] ;
-            alphaFunction(alpha,x_var,2,ptype_);  // shape function
-            y_obj->at(0) = alpha[0] + h;
-            y_obj->at(1) = alpha[1] + g;
-            aa.clear();
-            bb.clear();
         }
+        else
+        {
+            if(n%2==0)
+                g.add(psfunc2<LTYPE>(x[n],x[0],exponent,phase,1));  // linkage
+            else
+                h.add(psfunc2<LTYPE>(x[n],x[0],exponent,phase,2));
+        }
+    } // for
+
+    double alpha[2] ;
+    alphaFunction<PTYPE>(alpha,x);  // shape function
+    y[0] = alpha[0] + h.value();
+    y[1] = alpha[1] + g.value();
+} // objective2
+
+
+/**
+ * Three-objective kernel
+ */
+template <int PTYPE, int DTYPE, int LTYPE>
+void LZ09::objective3(const LZ09 * lz09, const double * x, double * y)
+{
+    BetaFunction<DTYPE> g ;
+    BetaFunction<DTYPE> h ;
+    BetaFunction<DTYPE> e ;
+
+    for(int n=2; n<lz09->nvar_; n++)
+    {
+        double a = psfunc3<LTYPE>(x[n],x[0],x[1],lz09->rate_[n],lz09->phase_[n]);
+        if(n%3==0)	    g.add(a);
+        else if(n%3==1)	h.add(a);
+        else            e.add(a);
+    } // for
+
+    double alpha[3] ;
+    alphaFunction<PTYPE>(alpha,x);  // shape function
+    y[0] = alpha[0] + h.value();
+    y[1] = alpha[1] + g.value();
+    y[2] = alpha[2] + e.value();
+} // objective3
+
+
+template <int PTYPE, int DTYPE>
+LZ09::Kernel LZ09::selectLinkage2(int ltype)
+{
+    switch (ltype)
+    {
+    case 21: return &objective2<PTYPE, DTYPE, 21> ;
+    case 22: return &objective2<PTYPE, DTYPE, 22> ;
+    case 23: return &objective2<PTYPE, DTYPE, 23> ;
+    case 24: return &objective2<PTYPE, DTYPE, 24> ;
+    case 25: return &objective2<PTYPE, DTYPE, 25> ;
+    case 26: return &objective2<PTYPE, DTYPE, 26> ;
+    default: return nullptr ;
     }
+} // selectLinkage2
 
 
-    // 3-objective case
-    if(nobj_==3)
+template <int PTYPE, int DTYPE>
+LZ09::Kernel LZ09::selectLinkage3(int ltype)
+{
+    switch (ltype)
     {
-        if(ltype_==31||ltype_==32)
-        {
-            double g = 0, h = 0, e = 0, a;
-            std::vector <double> aa ;
-            std::vector <double> bb ;
-            std::vector <double> cc ;
-            for(int n=2; n<nvar_; n++)
-            {
-                a = psfunc3(x_var->at(n),x_var->at(0),x_var->at(1),n,ltype_);
-                if(n%3==0)	    aa.push_back(a);
-                else if(n%3==1)	bb.push_back(a);
-                else            cc.push_back(a);
-            }
+    case 31: return &objective3<PTYPE, DTYPE, 31> ;
+    case 32: return &objective3<PTYPE, DTYPE, 32> ;
+    default: return nullptr ;
+    }
+} // selectLinkage3
 
-            g = betaFunction(&aa,dtype_);
-            h = betaFunction(&bb,dtype_);
-            e = betaFunction(&cc,dtype_);
-
-            //double * alpha = snew double[3];
-            double alpha[3] ;
-            alphaFunction(alpha,x_var,3,ptype_);  // shape function
-            y_obj->at(0) = alpha[0] + h;
-            y_obj->at(1) = alpha[1] + g;
-            y_obj->at(2) = alpha[2] + e;
-            aa.clear();
-            bb.clear();
-            cc.clear();
-        }
+
+template <int DTYPE>
+LZ09::Kernel LZ09::selectShape(int ptype, int ltype)
+{
+    switch (ptype)
+    {
+    case 21: return selectLinkage2<21, DTYPE>(ltype) ;
+    case 22: return selectLinkage2<22, DTYPE>(ltype) ;
+    case 23: return selectLinkage2<23, DTYPE>(ltype) ;
+    case 24: return selectLinkage2<24, DTYPE>(ltype) ;
+    case 31: return selectLinkage3<31, DTYPE>(ltype) ;
+    case 32: return selectLinkage3<32, DTYPE>(ltype) ;
+    case 33: return selectLinkage3<33, DTYPE>(ltype) ;
+    case 34: return selectLinkage3<34, DTYPE>(ltype) ;
+    default: return nullptr ;
+    }
+} // selectShape
+
+
+/**
+ * Returns the kernel instantiated for the given shape, distance and linkage
+ * types, or nullptr if the combination does not exist
+ */
+LZ09::Kernel LZ09::selectKernel(int ptype, int dtype, int ltype)
+{
+    switch (dtype)
+    {
+    case 1: return selectShape<1>(ptype, ltype) ;
+    case 2: return selectShape<2>(ptype, ltype) ;
+    case 3: return selectShape<3>(ptype, ltype) ;
+    case 4: return selectShape<4>(ptype, ltype) ;
+    default: return nullptr ;
     }
-}
+} // selectKernel
+
+
+/**
+ * Evaluates a vector of nvar decision variables
+ * @param x The decision variables
+ * @param y Array receiving the nobj objective values
+ */
+void LZ09::objective(const double * x, double * y) const
+{
+    kernel_(this, x, y) ;
+} // objective
 
 
+/**
+ * Evaluates count vectors of decision variables stored row by row
+ * @param x Matrix of count x nvar decision variables
+ * @param y Matrix of count x nobj objective values
+ * @param count The number of vectors
+ */
+void LZ09::objective(const double * x, double * y, int count) const
+{
+    for (int i = 0; i < count; i++)
+    {
+        kernel_(this, x + i * nvar_, y + i * nobj_) ;
+    } // for
+} // objective
+
+
+void LZ09::objective(VectorOfDouble *x_var, std::vector <double> *y_obj)
+{
+    objective(x_var->data(), y_obj->data()) ;
+} // objective
@@ -24,24 +24,56 @@
 #include "JMetalHeader.h"
 #include <math.h>
 #include <cstdlib>
+#include <iostream>
+#include <vector>
 
 using namespace JMetal;
 
+/**
+ * Objective functions of the LZ09 family. The shape (ptype), distance
+ * (dtype) and linkage (ltype) functions are template parameters of the
+ * evaluation kernels, and the kernel matching the requested types is
+ * selected once in the constructor. The per-variable constants of the
+ * linkage functions are computed there as well, so an evaluation does no
+ * allocation and no type dispatch.
+ */
 class LZ09
 {
 private:
+    typedef void (*Kernel)(const LZ09 * lz09, const double * x, double * y);
+
     int nvar_  ;
     int nobj_  ;
     int ltype_ ;
     int dtype_ ;
     int ptype_ ;
 
+    Kernel kernel_ ;
+
+    /**
+     * Per-variable constants of the linkage functions: the phase
+     * dim*pi/nvar, the exponent of linkage 21 and the rate of linkage 31
+     */
+    std::vector<double> phase_ ;
+    std::vector<double> exponent_ ;
+    std::vector<double> rate_ ;
+
+    template <int PTYPE, int DTYPE, int LTYPE>
+    static void objective2(const LZ09 * lz09, const double * x, double * y) ;
+    template <int PTYPE, int DTYPE, int LTYPE>
+    static void objective3(const LZ09 * lz09, const double * x, double * y) ;
+    template <int PTYPE, int DTYPE>
+    static Kernel selectLinkage2(int ltype) ;
+    template <int PTYPE, int DTYPE>
+    static Kernel selectLinkage3(int ltype) ;
+    template <int DTYPE>
+    static Kernel selectShape(int ptype, int ltype) ;
+    static Kernel selectKernel(int ptype, int dtype, int ltype) ;
+
 public:
     LZ09 (int nvar, int nobj, int ptype, int dtype, int ltype) ;
-    void alphaFunction(double *alpha, VectorOfDouble *x, int dim, int type) ;
-    double betaFunction(VectorOfDouble * x, int type) ;
-    double psfunc2(double x, double t1, int dim, int type, int css) ;
-    double psfunc3(double x, double t1, double t2, int dim, int type) ;
+    void objective(const double * x, double * y) const ;
+    void objective(const double * x, double * y, int count) const ;
     void objective(VectorOfDouble * x_var, std::vector <double> * y_obj) ;
 
 };
@@ -73,9 +73,6 @@ LZ09_F2::LZ09_F2(std::string solutionType, int ptype, int dtype, int ltype)
         std::cout << "LZ09_F2::LZ09_F2: solution type " << solutionType << " invalid" << std::endl;
         exit(-1) ;
     }
-
-    fx_ = snew double[numberOfObjectives_] ;
-    x_ = snew double[numberOfVariables_];
 } // LZ09_F2::LZ09_F2
 
 /**
@@ -91,26 +88,28 @@ LZ09_F2::~LZ09_F2 ()
 
 void LZ09_F2::evaluate(Solution * solution)
 {
-    XReal * vars = snew XReal(solution);
-
-    VectorOfDouble * x = snew VectorOfDouble(numberOfVariables_) ;
-    VectorOfDouble * y = snew VectorOfDouble(numberOfObjectives_);
+    evaluateVector(readVariables(solution), solution->getObjectives());
+} // evaluate
 
-    for (int i = 0; i < numberOfVariables_; i++)
-    {
-        x->at(i) = vars->getValue(i);
-    } // for
-    for (int i = 0; i < numberOfObjectives_; i++)
-    {
-        y->at(i) = 0.0 ;
-    } // for
 
-    LZ09_->objective(x, y) ;
+/**
+ * Evaluates a vector of decision variables
+ * @param x The decision variables
+ * @param fx Array receiving the objective values
+ */
+void LZ09_F2::evaluateVector(const double * x, double * fx)
+{
+    LZ09_->objective(x, fx) ;
+} // evaluateVector
 
-    for (int i = 0; i < numberOfObjectives_; i++)
-        solution->setObjective(i, y->at(i));
 
-    delete x;
-    delete y;
-    delete vars;
-}
+/**
+ * Evaluates count vectors of decision variables stored row by row
+ * @param x Matrix of count x numberOfVariables_ decision variables
+ * @param fx Matrix of count x numberOfObjectives_ objective values
+ * @param count The number of vectors
+ */
+void LZ09_F2::evaluateBatch(const double * x, double * fx, int count)
+{
+    LZ09_->objective(x, fx, count) ;
+} // evaluateBatch
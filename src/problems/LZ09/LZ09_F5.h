@@ -36,12 +36,12 @@ class LZ09_F5 : public Problem
 public:
     LZ09_F5(std::string solutionType, int ptype=21, int dtype=1, int ltype=26);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
+    void evaluateBatch(const double * x, double * fx, int count);
 
     virtual ~LZ09_F5();
 private:
     LZ09 * LZ09_ ;
-    double * fx_ ;
-    double * x_  ;
 };
 
 #endif /* __LZ09_F5_H__ */
@@ -36,12 +36,12 @@ class LZ09_F8 : public Problem
 public:
     LZ09_F8(std::string solutionType, int ptype=21, int dtype=4, int ltype=21);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
+    void evaluateBatch(const double * x, double * fx, int count);
 
     virtual ~LZ09_F8();
 private:
     LZ09 * LZ09_ ;
-    double * fx_ ;
-    double * x_  ;
 };
 
 #endif /* __LZ09_F8_H__ */
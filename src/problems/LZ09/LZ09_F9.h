@@ -36,12 +36,12 @@ class LZ09_F9 : public Problem
 public:
     LZ09_F9(string solutionType, int ptype=22, int dtype=1, int ltype=22);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
+    void evaluateBatch(const double * x, double * fx, int count);
 
     virtual ~LZ09_F9();
 private:
     LZ09 * LZ09_ ;
-    double * fx_ ;
-    double * x_  ;
 };
 
 #endif /* __LZ09_F9_H__ */
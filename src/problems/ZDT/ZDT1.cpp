@@ -61,7 +61,6 @@ ZDT1::ZDT1(std::string solutionType, int numberOfVariables)
         std::cout << "Error: solution type " << solutionType << " invalid" << std::endl;
         exit(-1) ;
     }
-    fx_ = snew double[numberOfObjectives_] ;
 }
 
 ZDT1::~ZDT1()
@@ -69,7 +68,6 @@ ZDT1::~ZDT1()
     delete [] lowerLimit_ ;
     delete [] upperLimit_ ;
     delete solutionType_ ;
-    delete [] fx_ ;
 }
 
 /**
@@ -78,24 +76,28 @@ ZDT1::~ZDT1()
  */
 void ZDT1::evaluate(Solution *solution)
 {
-    XReal * x = new XReal(solution);
-
-    fx_[0] = x->getValue(0) ;
-    double g = evalG(x) ;
-    double h = evalH(fx_[0], g) ;
-    fx_[1] = h * g ;
+    evaluateVector(readVariables(solution), solution->getObjectives());
+} // evaluate
 
-    solution->setObjective(0,fx_[0]);
-    solution->setObjective(1,fx_[1]);
 
-    delete x ;
-} // evaluate
+/**
+ * Evaluates a vector of decision variables
+ * @param x The decision variables
+ * @param fx Array receiving the objective values
+ */
+void ZDT1::evaluateVector(const double * x, double * fx)
+{
+    fx[0] = x[0] ;
+    double g = evalG(x) ;
+    double h = evalH(fx[0], g) ;
+    fx[1] = h * g ;
+} // evaluateVector
 
-double ZDT1::evalG(XReal * x)
+double ZDT1::evalG(const double * x)
 {
     double g = 0.0 ;
-    for (int i = 1; i < x->getNumberOfDecisionVariables(); i++)
-        g += x->getValue(i) ;
+    for (int i = 1; i < numberOfVariables_; i++)
+        g += x[i] ;
 
     double c = 9.0/(numberOfVariables_ - 1) ;
     g = c * g ;
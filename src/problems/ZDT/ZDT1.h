@@ -32,13 +32,13 @@
 class ZDT1 : public Problem
 {
 private:
-    double evalG(XReal *x) ;
+    double evalG(const double * x) ;
     double evalH(double f, double g) ;
-    double * fx_ ;
 
 public:
     ZDT1(std::string solutionType, int numberOfVariables = 30);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
 
     ~ZDT1();
 };
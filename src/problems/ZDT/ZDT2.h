@@ -33,13 +33,13 @@
 class ZDT2 : public Problem
 {
 private:
-    double evalG(XReal *x) ;
+    double evalG(const double * x) ;
     double evalH(double f, double g) ;
-    double * fx_ ;
 
 public:
     ZDT2(std::string solutionType, int numberOfVariables = 30);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
 
     virtual ~ZDT2();
 };
@@ -34,14 +34,14 @@
 class ZDT3 : public Problem
 {
 private:
-    double evalG(XReal *x) ;
+    double evalG(const double * x) ;
     double evalH(double f, double g) ;
-    double * fx_ ;
     static const double PI ;
 
 public:
     ZDT3(std::string solutionType, int numberOfVariables = 30);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
     virtual ~ZDT3();
 };
 
@@ -65,7 +65,6 @@ ZDT4::ZDT4(std::string solutionType, int numberOfVariables)
         std::cout << "Error: solution type " << solutionType << " invalid" << std::endl;
         exit(-1) ;
     }
-    fx_ = snew double[numberOfObjectives_] ;
 }
 
 
@@ -74,7 +73,6 @@ ZDT4::~ZDT4()
     delete [] lowerLimit_ ;
     delete [] upperLimit_ ;
     delete solutionType_ ;
-    delete [] fx_ ;
 }
 
 /**
@@ -83,27 +81,29 @@ ZDT4::~ZDT4()
  */
 void ZDT4::evaluate(Solution *solution)
 {
-    XReal * x = new XReal(solution);
-    double * fx = snew double[numberOfObjectives_] ;
-
-    fx_[0] = x->getValue(0) ;
-    double g = evalG(x) ;
-    double h = evalH(fx_[0], g) ;
-    fx_[1] = h * g ;
+    evaluateVector(readVariables(solution), solution->getObjectives());
+} // evaluate
 
-    solution->setObjective(0,fx_[0]);
-    solution->setObjective(1,fx_[1]);
 
-    delete [] fx ;
-    delete x ;
-} // evaluate
+/**
+ * Evaluates a vector of decision variables
+ * @param x The decision variables
+ * @param fx Array receiving the objective values
+ */
+void ZDT4::evaluateVector(const double * x, double * fx)
+{
+    fx[0] = x[0] ;
+    double g = evalG(x) ;
+    double h = evalH(fx[0], g) ;
+    fx[1] = h * g ;
+} // evaluateVector
 
-double ZDT4::evalG(XReal * x)
+double ZDT4::evalG(const double * x)
 {
     double g = 0.0 ;
-    for (int i = 1; i < x->getNumberOfDecisionVariables(); i++)
-        g += pow(x->getValue(i), 2.0) -
-             10.0 * cos(4.0 * PI * x->getValue(i));
+    for (int i = 1; i < numberOfVariables_; i++)
+        g += pow(x[i], 2.0) -
+             10.0 * cos(4.0 * PI * x[i]);
 
     double c = 1.0 + 10.0 * (numberOfVariables_ - 1) ;
     return g + c;
@@ -63,7 +63,6 @@ ZDT6::ZDT6(std::string solutionType, int numberOfVariables)
         std::cout << "Error: solution type " << solutionType << " invalid" << std::endl;
         exit(-1) ;
     }
-    fx_ = snew double[numberOfObjectives_] ;
 }
 
 
@@ -72,7 +71,6 @@ ZDT6::~ZDT6()
     delete [] lowerLimit_ ;
     delete [] upperLimit_ ;
     delete solutionType_ ;
-    delete [] fx_ ;
 }
 
 /**
@@ -81,25 +79,29 @@ ZDT6::~ZDT6()
  */
 void ZDT6::evaluate(Solution *solution)
 {
-    XReal * x = new XReal(solution);
-
-    double x1 = x->getValue(0) ;
-    fx_[0] = 1.0 - exp(-4.0*x1) * pow(sin(6.0*PI*x1), 6.0) ;
-    double g = evalG(x) ;
-    double h = evalH(fx_[0], g) ;
-    fx_[1] = h * g ;
+    evaluateVector(readVariables(solution), solution->getObjectives());
+} // evaluate
 
-    solution->setObjective(0,fx_[0]);
-    solution->setObjective(1,fx_[1]);
 
-    delete x ;
-} // evaluate
+/**
+ * Evaluates a vector of decision variables
+ * @param x The decision variables
+ * @param fx Array receiving the objective values
+ */
+void ZDT6::evaluateVector(const double * x, double * fx)
+{
+    double x1 = x[0] ;
+    fx[0] = 1.0 - exp(-4.0*x1) * pow(sin(6.0*PI*x1), 6.0) ;
+    double g = evalG(x) ;
+    double h = evalH(fx[0], g) ;
+    fx[1] = h * g ;
+} // evaluateVector
 
-double ZDT6::evalG(XReal * x)
+double ZDT6::evalG(const double * x)
 {
     double g = 0.0 ;
-    for (int i = 1; i < x->getNumberOfDecisionVariables(); i++)
-        g += x->getValue(i) ;
+    for (int i = 1; i < numberOfVariables_; i++)
+        g += x[i] ;
 
     g = g / (numberOfVariables_ - 1) ;
     g = pow(g, 0.25) ;
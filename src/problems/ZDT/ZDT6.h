@@ -33,14 +33,14 @@
 class ZDT6 : public Problem
 {
 private:
-    double evalG(XReal *x) ;
+    double evalG(const double * x) ;
     double evalH(double f, double g) ;
-    double * fx_ ;
     static const double PI ;
 
 public:
     ZDT6(string solutionType, int numberOfVariables = 10);
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
     virtual ~ZDT6();
 };
 
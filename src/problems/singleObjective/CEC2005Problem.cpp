@@ -137,19 +137,33 @@ CEC2005Problem::~CEC2005Problem()
  */
 void CEC2005Problem::evaluate(Solution *solution)
 {
-    Variable ** decisionVariables  = solution->getDecisionVariables();
-    double * x = snew double[numberOfVariables_] ;
-
-    for (int i = 0 ; i < numberOfVariables_; i++)
-    {
-        x[i] = decisionVariables[i]->getValue() ;
-    }
-
     double result ;
-    result = testFunction_->f(x) ;
-
-    delete [] x;
+    evaluateVector(readVariables(solution), &result) ;
 
     solution->setObjective(0, result);
 
 } // evaluate
+
+
+/**
+ * Evaluates a vector of decision variables
+ * @param x The decision variables
+ * @param fx The objective value
+ */
+void CEC2005Problem::evaluateVector(const double * x, double * fx)
+{
+    testFunction_->fBatch(x, fx, 1) ;
+} // evaluateVector
+
+
+/**
+ * Evaluates count vectors of decision variables stored row by row. The
+ * rotated functions shift and rotate all of them together.
+ * @param x Matrix of count x numberOfVariables_ decision variables.
+ * @param fx The count objective values.
+ * @param count The number of vectors.
+ */
+void CEC2005Problem::evaluateBatch(const double * x, double * fx, int count)
+{
+    testFunction_->fBatch(x, fx, count) ;
+} // evaluateBatch
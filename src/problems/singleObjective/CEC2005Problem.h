@@ -47,6 +47,8 @@ public:
     CEC2005Problem(std::string solutionType, int problemID, int numberOfVariables = 10);
     ~CEC2005Problem();
     void evaluate(Solution *solution);
+    void evaluateVector(const double * x, double * fx);
+    void evaluateBatch(const double * x, double * fx, int count);
 };
 
 #endif /* __CEC_2005_PROBLEM__ */
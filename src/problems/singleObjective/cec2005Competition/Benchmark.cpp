@@ -20,6 +20,7 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <Benchmark.h>
+#include <algorithm>
 
 //TODO: Cambiar ruta
 //const std::string Benchmark::DEFAULT_FILE_BIAS = Configuration.cec2005SupportDataDirectory + "/fbias_data.txt";
@@ -60,8 +61,24 @@ Benchmark::~Benchmark()
  * Random number generator
  * If you want to plan a specific seed, do it here
  */
-mt19937 Benchmark::e2 {std::random_device{}()};
-normal_distribution<double> Benchmark::dist (0,1);
+thread_local mt19937 Benchmark::e2 {std::random_device{}()};
+thread_local normal_distribution<double> Benchmark::dist (0,1);
+
+/**
+ * Returns a working area of at least size values owned by the calling
+ * thread. The area is overwritten by the next call from the same thread with
+ * the same index.
+ */
+double * Benchmark::workspace(int area, int size)
+{
+    static thread_local std::vector<double> areas[NUM_WORKSPACES];
+
+    if (areas[area].size() < size)
+    {
+        areas[area].resize(size);
+    }
+    return areas[area].data();
+}
 
 /**
  * Use this function to manufacture new test function objects.
@@ -324,33 +341,79 @@ void Benchmark::shift(double * results, double * x, double * o, int length)
 }
 
 
+/**
+ * Shift, batch version
+ */
+void Benchmark::shift(double * results, const double * x, const double * o,
+                      int count, int length)
+{
+    for (int r = 0; r < count; r++)
+    {
+        for (int i = 0; i < length; i++)
+        {
+            results[r * length + i] = x[r * length + i] - o[i];
+        }
+    }
+}
+
+
 /**
  * Weierstrass function
  */
 double Benchmark::weierstrass(double * x, int length)
 {
-    return (weierstrass(x, length, 0.5, 3.0, 20));
+    static const int Kmax = 20;
+    static double aPow[Kmax + 1];
+    static double bPow[Kmax + 1];
+    static const double offset = weierstrassTerms(0.5, 3.0, Kmax, aPow, bPow);
+
+    return (weierstrass(x, length, aPow, bPow, Kmax, offset));
 }
 
 double Benchmark::weierstrass(double * x, int length, double a, double b, int Kmax)
 {
+    double * aPow = workspace(WORKSPACE_TERMS, 2 * (Kmax + 1));
+    double * bPow = aPow + Kmax + 1;
+    double offset = weierstrassTerms(a, b, Kmax, aPow, bPow);
 
+    return (weierstrass(x, length, aPow, bPow, Kmax, offset));
+}
+
+/**
+ * Weierstrass function with the terms computed by weierstrassTerms
+ */
+double Benchmark::weierstrass(const double * x, int length, const double * aPow,
+                              const double * bPow, int Kmax, double offset)
+{
     double sum1 = 0.0;
     for (int i = 0; i < length; i++)
     {
+        double xi = x[i] + 0.5;
         for (int k = 0; k <= Kmax; k++)
         {
-            sum1 += pow(a, k) * cos(PIx2 * pow(b, k) * (x[i] + 0.5));
+            sum1 += aPow[k] * cos(bPow[k] * xi);
         }
     }
 
+    return (sum1 - offset*((double )(length)));
+}
+
+/**
+ * Computes the terms pow(a, k) and 2 * PI * pow(b, k), k = 0..Kmax, of the
+ * Weierstrass function, so that they are not recomputed for every variable.
+ * Returns the constant subtracted for each variable.
+ */
+double Benchmark::weierstrassTerms(double a, double b, int Kmax,
+                                   double * aPow, double * bPow)
+{
     double sum2 = 0.0;
     for (int k = 0; k <= Kmax; k++)
     {
-        sum2 += pow(a, k) * cos(PIx2 * pow(b, k) * (0.5));
+        aPow[k] = pow(a, k);
+        bPow[k] = PIx2 * pow(b, k);
+        sum2 += aPow[k] * cos(bPow[k] * (0.5));
     }
-
-    return (sum1 - sum2*((double )(length)));
+    return sum2;
 }
 
 /**
@@ -430,60 +493,92 @@ double Benchmark::elliptic(double * x, int length)
  * Hybrid composition
  */
 double Benchmark::hybrid_composition(double* x, HCJob* job, int length)
+{
+    double sumF;
+    hybrid_composition(x, job, length, &sumF, 1);
+    return sumF;
+}
+
+/**
+ * Hybrid composition, batch version. The count points of x are shifted and
+ * rotated together for each basic function, and the per-thread working areas
+ * are used, so the job can be shared by several threads.
+ */
+void Benchmark::hybrid_composition(const double * x, HCJob * job, int length,
+                                   double * results, int count)
 {
 
     int num_func = job->num_func;
     int num_dim = job->num_dim;
 
+    double * z = workspace(WORKSPACE_Z, count * length);
+    double * zM = workspace(WORKSPACE_ZM, count * length);
+    double * w = workspace(WORKSPACE_W, count * num_func);
+
     // Get the raw weights
-    double wMax = -numeric_limits<double>::max();
     for (int i=0; i<num_func; i++)
     {
-        double sumSqr = 0.0;
-        shift(job->z[i], x, job->o[i], length);
-        for (int j=0; j<num_dim; j++)
+        shift(z, x, job->o[i], count, length);
+        for (int r=0; r<count; r++)
         {
-            sumSqr += (job->z[i][j] * job->z[i][j]);
+            double sumSqr = 0.0;
+            for (int j=0; j<num_dim; j++)
+            {
+                sumSqr += (z[r * length + j] * z[r * length + j]);
+            }
+            w[r * num_func + i] = exp(-1.0 * sumSqr / (2.0 * num_dim * job->sigma[i] * job->sigma[i]));
         }
-        job->w[i] = exp(-1.0 * sumSqr / (2.0 * num_dim * job->sigma[i] * job->sigma[i]));
-        if (wMax < job->w[i])
-            wMax = job->w[i];
     }
 
-    // Modify the weights
-    double wSum = 0.0;
-    double w1mMaxPow = 1.0 - pow(wMax, 10.0);
-    for (int i=0; i<num_func; i++)
+    for (int r=0; r<count; r++)
     {
-        if (job->w[i] != wMax)
+        double * wr = w + r * num_func;
+        double wMax = -numeric_limits<double>::max();
+        for (int i=0; i<num_func; i++)
         {
-            job->w[i] *= w1mMaxPow;
+            if (wMax < wr[i])
+                wMax = wr[i];
         }
-        wSum += job->w[i];
-    }
 
-    // Normalize the weights
-    for (int i=0; i<num_func; i++)
-    {
-        job->w[i] /= wSum;
+        // Modify the weights
+        double wSum = 0.0;
+        double w1mMaxPow = 1.0 - pow(wMax, 10.0);
+        for (int i=0; i<num_func; i++)
+        {
+            if (wr[i] != wMax)
+            {
+                wr[i] *= w1mMaxPow;
+            }
+            wSum += wr[i];
+        }
+
+        // Normalize the weights
+        for (int i=0; i<num_func; i++)
+        {
+            wr[i] /= wSum;
+        }
+
+        results[r] = 0.0;
     }
 
-    double sumF = 0.0;
     for (int i=0; i<num_func; i++)
     {
-        for (int j=0; j<num_dim; j++)
+        shift(z, x, job->o[i], count, length);
+        for (int j=0; j<count * length; j++)
         {
-            job->z[i][j] /= job->lambda[i];
+            z[j] /= job->lambda[i];
+        }
+        rotate(zM, z, job->M[i][0], count, length);
+        for (int r=0; r<count; r++)
+        {
+            results[r] +=
+                w[r * num_func + i] *
+                (
+                    job->C * job->basic_func(i, zM + r * length, length) / job->fmax[i] +
+                    job->biases[i]
+                );
         }
-        rotate(job->zM[i], job->z[i], job->M[i], length);
-        sumF +=
-            job->w[i] *
-            (
-                job->C * job->basic_func(i, job->zM[i], length) / job->fmax[i] +
-                job->biases[i]
-            );
     }
-    return sumF;
 }
 
 
@@ -495,6 +590,43 @@ void Benchmark::rotate(double * results, double * x, double ** matrix, int lengt
     xA(results, x, matrix, length);
 }
 
+/**
+ * Rotate, batch version: (count x D) matrix * (D x D) matrix, all of them
+ * stored row by row. Every element is accumulated in the same order as in
+ * xA, so each row of the result is identical to rotating that row alone.
+ * The rows and columns are processed in blocks that keep a panel of the
+ * rotation matrix in cache while it is applied to several points.
+ */
+void Benchmark::rotate(double * results, const double * x, const double * matrix,
+                       int count, int length)
+{
+    static const int ROW_BLOCK = 8;
+    static const int COLUMN_BLOCK = 64;
+
+    std::fill(results, results + count * length, 0.0);
+    for (int r0 = 0; r0 < count; r0 += ROW_BLOCK)
+    {
+        int r1 = std::min(r0 + ROW_BLOCK, count);
+        for (int c0 = 0; c0 < length; c0 += COLUMN_BLOCK)
+        {
+            int c1 = std::min(c0 + COLUMN_BLOCK, length);
+            for (int j = 0; j < length; j++)
+            {
+                const double * __restrict a = matrix + j * length;
+                for (int r = r0; r < r1; r++)
+                {
+                    double xj = x[r * length + j];
+                    double * __restrict result = results + r * length;
+                    for (int c = c0; c < c1; c++)
+                    {
+                        result[c] += xj * a[c];
+                    }
+                }
+            }
+        }
+    }
+}
+
 /**
  * (1xD) row vector * (DxD) matrix = (1xD) row vector
  */
@@ -625,3 +757,26 @@ void Benchmark::loadMatrix(ifstream& in, int rows, int columns, double ** matrix
         loadRowVector(in, columns, matrix[i]);
     }
 }
+
+/**
+ * Allocates a (rows x columns) matrix whose rows are stored contiguously
+ */
+double ** Benchmark::allocateMatrix(int rows, int columns)
+{
+    double ** matrix = snew double*[rows];
+    matrix[0] = snew double[rows * columns];
+    for (int i=1; i<rows; i++)
+    {
+        matrix[i] = matrix[0] + i * columns;
+    }
+    return matrix;
+}
+
+/**
+ * Deletes a matrix allocated by allocateMatrix
+ */
+void Benchmark::deleteMatrix(double ** matrix)
+{
+    delete [] matrix[0];
+    delete [] matrix;
+}
@@ -28,6 +28,7 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "JMetalHeader.h"
 #include <F01ShiftedSphere.h>
@@ -87,9 +88,19 @@ public:
     Benchmark(std::string file_bias);
     ~Benchmark();
 
-    // Random number generator
-    static mt19937 e2;
-    static normal_distribution<double> dist;
+    // Random number generator for the noise of F04, F17, F24 and F25, one stream per thread
+    static thread_local mt19937 e2;
+    static thread_local normal_distribution<double> dist;
+
+    // Per-thread working areas, so that the test function objects can be
+    // shared by several threads
+    static const int WORKSPACE_INPUT = 0;
+    static const int WORKSPACE_Z = 1;
+    static const int WORKSPACE_ZM = 2;
+    static const int WORKSPACE_W = 3;
+    static const int WORKSPACE_TERMS = 4;
+    static const int NUM_WORKSPACES = 5;
+    static double * workspace(int area, int size);
 
     TestFunc * testFunctionFactory(int func_num, int dimension);
 
@@ -109,17 +120,29 @@ public:
     static double rastriginNonCont(double * x, int length);
     static double weierstrass(double * x, int length);
     static double weierstrass(double * x, int length, double a, double b, int Kmax);
+    static double weierstrass(const double * x, int length, const double * aPow,
+                              const double * bPow, int Kmax, double offset);
+    static double weierstrassTerms(double a, double b, int Kmax,
+                                   double * aPow, double * bPow);
     static double F8F2(double * x, int length);
     static double ScafferF6(double x, double y);
     static double EScafferF6(double * x, int length);
     static double EScafferF6NonCont(double * x, int length);
     static double elliptic(double* x, int length);
     static double hybrid_composition(double * x, HCJob * job, int length);
+    static void hybrid_composition(const double * x, HCJob * job, int length,
+                                   double * results, int count);
 
     // Elementary operations
     static void shift(double * results, double * x, double * o, int length);
     static void rotate(double * results, double * x, double ** matrix, int length);
 
+    // Batch operations on count row vectors stored one after another
+    static void shift(double * results, const double * x, const double * o,
+                      int count, int length);
+    static void rotate(double * results, const double * x, const double * matrix,
+                       int count, int length);
+
     // Matrix & vector operations
     static void xA(double * result, double * x, double ** A, int length);
     static void Ax(double * result, double ** A, double * x, int length);
@@ -131,6 +154,11 @@ public:
     static void loadMatrixFromFile(std::string file, int rows, int columns, double ** matrix);
     static void loadMatrix(ifstream& brSrc, int rows, int columns, double ** matrix);
 
+    // Matrices whose rows are stored contiguously, so that matrix[0] can be
+    // used as a (rows x columns) row-major array
+    static double ** allocateMatrix(int rows, int columns);
+    static void deleteMatrix(double ** matrix);
+
 }; // Benchmark
 
 #endif /* __BENCHMARK__ */
@@ -46,7 +46,6 @@ F01ShiftedSphere::F01ShiftedSphere(int dimension, double bias, std::string file_
 
     // Note: dimension starts from 0
     m_o = snew double[m_dimension];
-    m_z = snew double[m_dimension];
 
     // Load the shifted global optimum
     Benchmark::loadRowVectorFromFile(file_data, m_dimension, m_o);
@@ -60,7 +59,6 @@ F01ShiftedSphere::F01ShiftedSphere(int dimension, double bias, std::string file_
 F01ShiftedSphere::~F01ShiftedSphere()
 {
     delete [] m_o;
-    delete [] m_z;
 } // ~F01ShiftedSphere
 
 
@@ -71,9 +69,10 @@ double F01ShiftedSphere::f(double * x)
 {
     double result = 0.0;
 
-    Benchmark::shift(m_z, x, m_o, m_dimension);
+    double * z = Benchmark::workspace(Benchmark::WORKSPACE_Z, m_dimension);
+    Benchmark::shift(z, x, m_o, m_dimension);
 
-    result = Benchmark::sphere(m_z, m_dimension);
+    result = Benchmark::sphere(z, m_dimension);
 
     result += m_bias;
 
@@ -27,7 +27,7 @@
 const std::string F03ShiftedRotatedHighCondElliptic::FUNCTION_NAME = "Shifted Rotated High Conditioned Elliptic Function";
 // TODO: Cambiar ruta
 const std::string F03ShiftedRotatedHighCondElliptic::DEFAULT_FILE_DATA = "../../data/cec2005CompetitionResources/supportData/high_cond_elliptic_rot_data.txt";
-const std::string F03ShiftedRotatedHighCondElliptic::DEFAULT_FILE_MX_PREFIX = "../../data/cec2005CompetitionResources/supportData/Elliptic_M_D";
+const std::string F03ShiftedRotatedHighCondElliptic::DEFAULT_FILE_MX_PREFIX = "../../data/cec2005CompetitionResources/supportData/elliptic_M_D";
 const std::string F03ShiftedRotatedHighCondElliptic::DEFAULT_FILE_MX_SUFFIX = ".txt";
 
 
@@ -49,13 +49,7 @@ F03ShiftedRotatedHighCondElliptic::F03ShiftedRotatedHighCondElliptic(int dimensi
 
     // Note: dimension starts from 0
     m_o = snew double[m_dimension];
-    m_matrix = snew double*[m_dimension];
-    for (int i=0; i<m_dimension; i++)
-    {
-        m_matrix[i] = snew double[m_dimension];
-    }
-    m_z = snew double[m_dimension];
-    m_zM = snew double[m_dimension];
+    m_matrix = Benchmark::allocateMatrix(m_dimension, m_dimension);
 
     // Load the shifted global optimum
     Benchmark::loadRowVectorFromFile(file_data, m_dimension, m_o);
@@ -73,13 +67,7 @@ F03ShiftedRotatedHighCondElliptic::F03ShiftedRotatedHighCondElliptic(int dimensi
 F03ShiftedRotatedHighCondElliptic::~F03ShiftedRotatedHighCondElliptic()
 {
     delete [] m_o;
-    for (int i=0; i<m_dimension; i++)
-    {
-        delete [] m_matrix[i];
-    }
-    delete [] m_matrix;
-    delete [] m_z;
-    delete [] m_zM;
+    Benchmark::deleteMatrix(m_matrix);
 } // ~F03ShiftedRotatedHighCondElliptic
 
 
@@ -90,19 +78,34 @@ double F03ShiftedRotatedHighCondElliptic::f(double * x)
 {
     double result = 0.0;
 
-    Benchmark::shift(m_z, x, m_o, m_dimension);
-    Benchmark::rotate(m_zM, m_z, m_matrix, m_dimension);
+    fBatch(x, &result, 1);
 
-    double sum = 0.0;
+    return result;
+}
 
-    for (int i = 0 ; i < m_dimension ; i ++)
-    {
-        sum += pow(constant, i) * m_zM[i] * m_zM[i];
-    }
 
-    result = sum + m_bias;
+/**
+ * Function body, batch version: the count points of x are shifted and
+ * rotated together
+ */
+void F03ShiftedRotatedHighCondElliptic::fBatch(const double * x, double * results, int count)
+{
+    double * z = Benchmark::workspace(Benchmark::WORKSPACE_Z, count * m_dimension);
+    double * zM = Benchmark::workspace(Benchmark::WORKSPACE_ZM, count * m_dimension);
 
-    return result;
+    Benchmark::shift(z, x, m_o, count, m_dimension);
+    Benchmark::rotate(zM, z, m_matrix[0], count, m_dimension);
+
+    for (int r = 0; r < count; r++)
+    {
+        double * zMr = zM + r * m_dimension;
+        double sum = 0.0;
+        for (int i = 0 ; i < m_dimension ; i ++)
+        {
+            sum += pow(constant, i) * zMr[i] * zMr[i];
+        }
+        results[r] = sum + m_bias;
+    }
 }
 
 
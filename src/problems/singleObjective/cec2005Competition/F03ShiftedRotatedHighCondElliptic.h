@@ -40,11 +40,6 @@ private:
     double * m_o;
     double ** m_matrix;
 
-    // In order to avoid excessive memory allocation,
-    // a fixed memory buffer is allocated for each function object.
-    double * m_z;
-    double * m_zM;
-
     double constant;
 
     std::string getFileMxName(std::string prefix, int dimension, std::string suffix);
@@ -56,6 +51,7 @@ public:
     ~F03ShiftedRotatedHighCondElliptic();
 
     double f (double * x);
+    void fBatch(const double * x, double * results, int count);
 
 }; // F03ShiftedRotatedHighCondElliptic
 
@@ -46,7 +46,6 @@ F04ShiftedSchwefelNoise::F04ShiftedSchwefelNoise(int dimension, double bias, std
 
     // Note: dimension starts from 0
     m_o = snew double[m_dimension];
-    m_z = snew double[m_dimension];
 
     // Load the shifted global optimum
     Benchmark::loadRowVectorFromFile(file_data, m_dimension, m_o);
@@ -60,7 +59,6 @@ F04ShiftedSchwefelNoise::F04ShiftedSchwefelNoise(int dimension, double bias, std
 F04ShiftedSchwefelNoise::~F04ShiftedSchwefelNoise()
 {
     delete [] m_o;
-    delete [] m_z;
 } // ~F04ShiftedSchwefelNoise
 
 
@@ -71,9 +69,10 @@ double F04ShiftedSchwefelNoise::f(double * x)
 {
     double result = 0.0;
 
-    Benchmark::shift(m_z, x, m_o, m_dimension);
+    double * z = Benchmark::workspace(Benchmark::WORKSPACE_Z, m_dimension);
+    Benchmark::shift(z, x, m_o, m_dimension);
 
-    result = Benchmark::schwefel_102(m_z, m_dimension);
+    result = Benchmark::schwefel_102(z, m_dimension);
 
     // NOISE
     // Comment the next line to remove the noise
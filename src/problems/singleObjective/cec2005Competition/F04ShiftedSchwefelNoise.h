@@ -37,10 +37,6 @@ private:
     // Shifted global optimum
     double * m_o;
 
-    // In order to avoid excessive memory allocation,
-    // a fixed memory buffer is allocated for each function object.
-    double * m_z;
-
 public:
 
     F04ShiftedSchwefelNoise(int dimension, double bias);
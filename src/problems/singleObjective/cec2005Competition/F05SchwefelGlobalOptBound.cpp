@@ -53,7 +53,6 @@ F05SchwefelGlobalOptBound::F05SchwefelGlobalOptBound(int dimension, double bias,
         m_A[i] = snew double[m_dimension];
     }
     m_B = snew double[m_dimension];
-    m_z = snew double[m_dimension];
 
     double ** m_data = snew double*[m_dimension+1];
     for (int i=0; i<m_dimension+1; i++)
@@ -108,7 +107,6 @@ F05SchwefelGlobalOptBound::~F05SchwefelGlobalOptBound()
     }
     delete [] m_A;
     delete [] m_B;
-    delete [] m_z;
 } // ~F05SchwefelGlobalOptBound
 
 
@@ -119,11 +117,12 @@ double F05SchwefelGlobalOptBound::f(double * x)
 {
     double max = -numeric_limits<double>::max();
 
-    Benchmark::Ax(m_z, m_A, x, m_dimension);
+    double * z = Benchmark::workspace(Benchmark::WORKSPACE_Z, m_dimension);
+    Benchmark::Ax(z, m_A, x, m_dimension);
 
     for (int i = 0 ; i < m_dimension ; i ++)
     {
-        double temp = fabs(m_z[i] - m_B[i]);
+        double temp = fabs(z[i] - m_B[i]);
         if (max < temp)
         {
             max = temp;
@@ -38,10 +38,8 @@ private:
     double * m_o;
     double ** m_A;
 
-    // In order to avoid excessive memory allocation,
-    // a fixed memory buffer is allocated for each function object.
+    // A * o, computed once
     double * m_B;
-    double * m_z;
 
 public:
 
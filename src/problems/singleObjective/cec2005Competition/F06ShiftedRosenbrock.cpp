@@ -46,7 +46,6 @@ F06ShiftedRosenbrock::F06ShiftedRosenbrock(int dimension, double bias, std::stri
 
     // Note: dimension starts from 0
     m_o = snew double[m_dimension];
-    m_z = snew double[m_dimension];
 
     // Load the shifted global optimum
     Benchmark::loadRowVectorFromFile(file_data, m_dimension, m_o);
@@ -67,7 +66,6 @@ F06ShiftedRosenbrock::F06ShiftedRosenbrock(int dimension, double bias, std::stri
 F06ShiftedRosenbrock::~F06ShiftedRosenbrock()
 {
     delete [] m_o;
-    delete [] m_z;
 } // ~F06ShiftedRosenbrock
 
 
@@ -78,9 +76,10 @@ double F06ShiftedRosenbrock::f(double * x)
 {
     double result = 0.0;
 
-    Benchmark::shift(m_z, x, m_o, m_dimension);
+    double * z = Benchmark::workspace(Benchmark::WORKSPACE_Z, m_dimension);
+    Benchmark::shift(z, x, m_o, m_dimension);
 
-    result = Benchmark::rosenbrock(m_z, m_dimension);
+    result = Benchmark::rosenbrock(z, m_dimension);
 
     result += m_bias;
 
@@ -37,10 +37,6 @@ private:
     // Shifted global optimum
     double * m_o;
 
-    // In order to avoid excessive memory allocation,
-    // a fixed memory buffer is allocated for each function object.
-    double * m_z;
-
 public:
 
     F06ShiftedRosenbrock(int dimension, double bias);
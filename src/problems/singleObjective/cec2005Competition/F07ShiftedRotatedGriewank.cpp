@@ -49,13 +49,7 @@ F07ShiftedRotatedGriewank::F07ShiftedRotatedGriewank(int dimension, double bias,
 
     // Note: dimension starts from 0
     m_o = snew double[m_dimension];
-    m_matrix = snew double*[m_dimension];
-    for (int i=0; i<m_dimension; i++)
-    {
-        m_matrix[i] = snew double[m_dimension];
-    }
-    m_z = snew double[m_dimension];
-    m_zM = snew double[m_dimension];
+    m_matrix = Benchmark::allocateMatrix(m_dimension, m_dimension);
 
     // Load the shifted global optimum
     Benchmark::loadRowVectorFromFile(file_data, m_dimension, m_o);
@@ -71,13 +65,7 @@ F07ShiftedRotatedGriewank::F07ShiftedRotatedGriewank(int dimension, double bias,
 F07ShiftedRotatedGriewank::~F07ShiftedRotatedGriewank()
 {
     delete [] m_o;
-    for (int i=0; i<m_dimension; i++)
-    {
-        delete [] m_matrix[i];
-    }
-    delete [] m_matrix;
-    delete [] m_z;
-    delete [] m_zM;
+    Benchmark::deleteMatrix(m_matrix);
 } // ~F07ShiftedRotatedGriewank
 
 
@@ -88,14 +76,29 @@ double F07ShiftedRotatedGriewank::f(double * x)
 {
     double result = 0.0;
 
-    Benchmark::shift(m_z, x, m_o, m_dimension);
-    Benchmark::rotate(m_zM, m_z, m_matrix, m_dimension);
+    fBatch(x, &result, 1);
 
-    result = Benchmark::griewank(m_zM, m_dimension);
+    return result;
+}
 
-    result += m_bias;
 
-    return result;
+/**
+ * Function body, batch version: the count points of x are shifted and
+ * rotated together
+ */
+void F07ShiftedRotatedGriewank::fBatch(const double * x, double * results, int count)
+{
+    double * z = Benchmark::workspace(Benchmark::WORKSPACE_Z, count * m_dimension);
+    double * zM = Benchmark::workspace(Benchmark::WORKSPACE_ZM, count * m_dimension);
+
+    Benchmark::shift(z, x, m_o, count, m_dimension);
+    Benchmark::rotate(zM, z, m_matrix[0], count, m_dimension);
+
+    for (int r = 0; r < count; r++)
+    {
+        results[r] = Benchmark::griewank(zM + r * m_dimension, m_dimension);
+        results[r] += m_bias;
+    }
 }
 
 
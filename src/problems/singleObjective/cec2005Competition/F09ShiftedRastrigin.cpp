@@ -46,7 +46,6 @@ F09ShiftedRastrigin::F09ShiftedRastrigin(int dimension, double bias, std::string
 
     // Note: dimension starts from 0
     m_o = snew double[m_dimension];
-    m_z = snew double[m_dimension];
 
     // Load the shifted global optimum
     Benchmark::loadRowVectorFromFile(file_data, m_dimension, m_o);
@@ -60,7 +59,6 @@ F09ShiftedRastrigin::F09ShiftedRastrigin(int dimension, double bias, std::string
 F09ShiftedRastrigin::~F09ShiftedRastrigin()
 {
     delete [] m_o;
-    delete [] m_z;
 } // ~F09ShiftedRastrigin
 
 
@@ -71,9 +69,10 @@ double F09ShiftedRastrigin::f(double * x)
 {
     double result = 0.0;
 
-    Benchmark::shift(m_z, x, m_o, m_dimension);
+    double * z = Benchmark::workspace(Benchmark::WORKSPACE_Z, m_dimension);
+    Benchmark::shift(z, x, m_o, m_dimension);
 
-    result = Benchmark::rastrigin(m_z, m_dimension);
+    result = Benchmark::rastrigin(z, m_dimension);
 
     result += m_bias;
 
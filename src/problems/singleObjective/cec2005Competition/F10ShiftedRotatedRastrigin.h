@@ -40,11 +40,6 @@ private:
     double * m_o;
     double ** m_matrix;
 
-    // In order to avoid excessive memory allocation,
-    // a fixed memory buffer is allocated for each function object.
-    double * m_z;
-    double * m_zM;
-
     std::string getFileMxName(std::string prefix, int dimension, std::string suffix);
 
 public:
@@ -54,6 +49,7 @@ public:
     ~F10ShiftedRotatedRastrigin();
 
     double f (double * x);
+    void fBatch(const double * x, double * results, int count);
 
 }; // F10ShiftedRotatedRastrigin
 
@@ -53,13 +53,10 @@ F11ShiftedRotatedWeierstrass::F11ShiftedRotatedWeierstrass(int dimension, double
 
     // Note: dimension starts from 0
     m_o = snew double[m_dimension];
-    m_matrix = snew double*[m_dimension];
-    for (int i=0; i<m_dimension; i++)
-    {
-        m_matrix[i] = snew double[m_dimension];
-    }
-    m_z = snew double[m_dimension];
-    m_zM = snew double[m_dimension];
+    m_matrix = Benchmark::allocateMatrix(m_dimension, m_dimension);
+    m_aPow = snew double[Kmax + 1];
+    m_bPow = snew double[Kmax + 1];
+    m_offset = Benchmark::weierstrassTerms(a, b, Kmax, m_aPow, m_bPow);
 
     // Load the shifted global optimum
     Benchmark::loadRowVectorFromFile(file_data, m_dimension, m_o);
@@ -75,13 +72,9 @@ F11ShiftedRotatedWeierstrass::F11ShiftedRotatedWeierstrass(int dimension, double
 F11ShiftedRotatedWeierstrass::~F11ShiftedRotatedWeierstrass()
 {
     delete [] m_o;
-    for (int i=0; i<m_dimension; i++)
-    {
-        delete [] m_matrix[i];
-    }
-    delete [] m_matrix;
-    delete [] m_z;
-    delete [] m_zM;
+    Benchmark::deleteMatrix(m_matrix);
+    delete [] m_aPow;
+    delete [] m_bPow;
 } // ~F11ShiftedRotatedWeierstrass
 
 
@@ -92,14 +85,30 @@ double F11ShiftedRotatedWeierstrass::f(double * x)
 {
     double result = 0.0;
 
-    Benchmark::shift(m_z, x, m_o, m_dimension);
-    Benchmark::xA(m_zM, m_z, m_matrix, m_dimension);
+    fBatch(x, &result, 1);
 
-    result = Benchmark::weierstrass(m_zM, m_dimension, a, b, Kmax);
+    return result;
+}
 
-    result += m_bias;
 
-    return result;
+/**
+ * Function body, batch version: the count points of x are shifted and
+ * rotated together
+ */
+void F11ShiftedRotatedWeierstrass::fBatch(const double * x, double * results, int count)
+{
+    double * z = Benchmark::workspace(Benchmark::WORKSPACE_Z, count * m_dimension);
+    double * zM = Benchmark::workspace(Benchmark::WORKSPACE_ZM, count * m_dimension);
+
+    Benchmark::shift(z, x, m_o, count, m_dimension);
+    Benchmark::rotate(zM, z, m_matrix[0], count, m_dimension);
+
+    for (int r = 0; r < count; r++)
+    {
+        results[r] = Benchmark::weierstrass(zM + r * m_dimension, m_dimension,
+                                            m_aPow, m_bPow, Kmax, m_offset);
+        results[r] += m_bias;
+    }
 }
 
 
@@ -44,10 +44,10 @@ private:
     double * m_o;
     double ** m_matrix;
 
-    // In order to avoid excessive memory allocation,
-    // a fixed memory buffer is allocated for each function object.
-    double * m_z;
-    double * m_zM;
+    // Precomputed terms of the Weierstrass function
+    double * m_aPow;
+    double * m_bPow;
+    double m_offset;
 
     std::string getFileMxName(std::string prefix, int dimension, std::string suffix);
 
@@ -58,6 +58,7 @@ public:
     ~F11ShiftedRotatedWeierstrass();
 
     double f (double * x);
+    void fBatch(const double * x, double * results, int count);
 
 }; // F11ShiftedRotatedWeierstrass
 
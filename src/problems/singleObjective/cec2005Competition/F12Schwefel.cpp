@@ -59,7 +59,6 @@ F12Schwefel::F12Schwefel(int dimension, double bias, std::string file_data)
     }
 
     m_A = snew double[m_dimension];
-    m_B = snew double[m_dimension];
 
     // Data:
     //  1. a    100x100
@@ -118,7 +117,6 @@ F12Schwefel::~F12Schwefel()
     }
     delete [] m_b;
     delete [] m_A;
-    delete [] m_B;
 } // ~F12Schwefel
 
 
@@ -131,13 +129,13 @@ double F12Schwefel::f(double * x)
 
     for (int i = 0 ; i < m_dimension; i++)
     {
-        m_B[i] = 0.0;
+        double b = 0.0;
         for (int j = 0; j < m_dimension; j++)
         {
-            m_B[i] += (m_a[i][j] * sin(x[j]) + m_b[i][j] * cos(x[j]));
+            b += (m_a[i][j] * sin(x[j]) + m_b[i][j] * cos(x[j]));
         }
 
-        double temp = m_A[i] - m_B[i];
+        double temp = m_A[i] - b;
         sum += (temp * temp);
     }
 
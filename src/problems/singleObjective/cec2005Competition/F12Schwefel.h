@@ -39,10 +39,8 @@ private:
     double ** m_a;
     double ** m_b;
 
-    // In order to avoid excessive memory allocation,
-    // a fixed memory buffer is allocated for each function object.
+    // a * sin(o) + b * cos(o), computed once
     double * m_A;
-    double * m_B;
 
 public:
 
@@ -46,7 +46,6 @@ F13ShiftedExpandedGriewankRosenbrock::F13ShiftedExpandedGriewankRosenbrock(int d
 
     // Note: dimension starts from 0
     m_o = snew double[m_dimension];
-    m_z = snew double[m_dimension];
 
     // Load the shifted global optimum
     Benchmark::loadRowVectorFromFile(file_data, m_dimension, m_o);
@@ -67,7 +66,6 @@ F13ShiftedExpandedGriewankRosenbrock::F13ShiftedExpandedGriewankRosenbrock(int d
 F13ShiftedExpandedGriewankRosenbrock::~F13ShiftedExpandedGriewankRosenbrock()
 {
     delete [] m_o;
-    delete [] m_z;
 } // ~F13ShiftedExpandedGriewankRosenbrock
 
 
@@ -78,9 +76,10 @@ double F13ShiftedExpandedGriewankRosenbrock::f(double * x)
 {
     double result = 0.0;
 
-    Benchmark::shift(m_z, x, m_o, m_dimension);
+    double * z = Benchmark::workspace(Benchmark::WORKSPACE_Z, m_dimension);
+    Benchmark::shift(z, x, m_o, m_dimension);
 
-    result = Benchmark::F8F2(m_z, m_dimension);
+    result = Benchmark::F8F2(z, m_dimension);
 
     result += m_bias;
 
@@ -73,15 +73,9 @@ F15HybridComposition1::F15HybridComposition1(int dimension, double bias, std::st
     m_testPointM = snew double[m_dimension];
     m_fmax = snew double[NUM_FUNC];
 
-    m_w  = snew double[NUM_FUNC];
-    m_z  = snew double*[NUM_FUNC];
-    m_zM = snew double*[NUM_FUNC];
-
     for (int i=0; i<NUM_FUNC; i++)
     {
         m_o[i]  = snew double[m_dimension];
-        m_z[i]  = snew double[m_dimension];
-        m_zM[i] = snew double[m_dimension];
     }
 
     // Load the shifted global optimum
@@ -89,10 +83,9 @@ F15HybridComposition1::F15HybridComposition1(int dimension, double bias, std::st
     // Generate identity matrices
     for (int i = 0 ; i < NUM_FUNC ; i ++)
     {
-        m_M[i] = snew double*[m_dimension];
+        m_M[i] = Benchmark::allocateMatrix(m_dimension, m_dimension);
         for (int j = 0 ; j < m_dimension ; j ++)
         {
-            m_M[i][j] = snew double[m_dimension];
             for (int k = 0 ; k < m_dimension ; k ++)
             {
                 m_M[i][j][k] = 0.0;
@@ -117,9 +110,6 @@ F15HybridComposition1::F15HybridComposition1(int dimension, double bias, std::st
     }
     theJob->o = m_o;
     theJob->M = m_M;
-    theJob->w = m_w;
-    theJob->z = m_z;
-    theJob->zM = m_zM;
     // Calculate/estimate the fmax for all the functions involved
     for (int i=0; i<NUM_FUNC; i++)
     {
@@ -144,16 +134,10 @@ F15HybridComposition1::~F15HybridComposition1()
     for (int i=0; i<NUM_FUNC; i++)
     {
         delete [] m_o[i];
-        delete [] m_z[i];
-        delete [] m_zM[i];
     }
     for (int i=0; i<NUM_FUNC; i++)
     {
-        for (int j=0; j<m_dimension; j++)
-        {
-            delete [] m_M[i][j];
-        }
-        delete [] m_M[i];
+        Benchmark::deleteMatrix(m_M[i]);
     }
 
     delete [] m_o;
@@ -163,10 +147,6 @@ F15HybridComposition1::~F15HybridComposition1()
     delete [] m_testPointM;
     delete [] m_fmax;
 
-    delete [] m_w;
-    delete [] m_z;
-    delete [] m_zM;
-
     delete theJob;
 
 } // ~F15HybridComposition1
@@ -214,9 +194,21 @@ double F15HybridComposition1::f(double * x)
 {
     double result = 0.0;
 
-    result = Benchmark::hybrid_composition(x, theJob, m_dimension);
-
-    result += m_bias;
+    fBatch(x, &result, 1);
 
     return result;
 }
+
+
+/**
+ * Function body, batch version
+ */
+void F15HybridComposition1::fBatch(const double * x, double * results, int count)
+{
+    Benchmark::hybrid_composition(x, theJob, m_dimension, results, count);
+
+    for (int r = 0; r < count; r++)
+    {
+        results[r] += m_bias;
+    }
+}
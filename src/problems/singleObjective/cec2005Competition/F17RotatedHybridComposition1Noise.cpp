@@ -74,20 +74,10 @@ F17RotatedHybridComposition1Noise::F17RotatedHybridComposition1Noise(int dimensi
     m_testPointM = snew double[m_dimension];
     m_fmax = snew double[NUM_FUNC];
 
-    m_w  = snew double[NUM_FUNC];
-    m_z  = snew double*[NUM_FUNC];
-    m_zM = snew double*[NUM_FUNC];
-
     for (int i=0; i<NUM_FUNC; i++)
     {
         m_o[i]  = snew double[m_dimension];
-        m_z[i]  = snew double[m_dimension];
-        m_zM[i] = snew double[m_dimension];
-        m_M[i] = snew double*[m_dimension];
-        for (int j=0; j<m_dimension; j++)
-        {
-            m_M[i][j] = snew double[m_dimension];
-        }
+        m_M[i] = Benchmark::allocateMatrix(m_dimension, m_dimension);
     }
 
     // Load the shifted global optimum
@@ -108,9 +98,6 @@ F17RotatedHybridComposition1Noise::F17RotatedHybridComposition1Noise(int dimensi
     }
     theJob->o = m_o;
     theJob->M = m_M;
-    theJob->w = m_w;
-    theJob->z = m_z;
-    theJob->zM = m_zM;
     // Calculate/estimate the fmax for all the functions involved
     for (int i=0; i<NUM_FUNC; i++)
     {
@@ -135,16 +122,10 @@ F17RotatedHybridComposition1Noise::~F17RotatedHybridComposition1Noise()
     for (int i=0; i<NUM_FUNC; i++)
     {
         delete [] m_o[i];
-        delete [] m_z[i];
-        delete [] m_zM[i];
     }
     for (int i=0; i<NUM_FUNC; i++)
     {
-        for (int j=0; j<m_dimension; j++)
-        {
-            delete [] m_M[i][j];
-        }
-        delete [] m_M[i];
+        Benchmark::deleteMatrix(m_M[i]);
     }
 
     delete [] m_o;
@@ -154,10 +135,6 @@ F17RotatedHybridComposition1Noise::~F17RotatedHybridComposition1Noise()
     delete [] m_testPointM;
     delete [] m_fmax;
 
-    delete [] m_w;
-    delete [] m_z;
-    delete [] m_zM;
-
     delete theJob;
 
 } // ~F17RotatedHybridComposition1Noise
@@ -205,15 +182,27 @@ double F17RotatedHybridComposition1Noise::f(double * x)
 {
     double result = 0.0;
 
-    result = Benchmark::hybrid_composition(x, theJob, m_dimension);
+    fBatch(x, &result, 1);
+
+    return result;
+}
 
-    result += m_bias;
 
-    // NOISE
-    // Comment the next line to remove the noise
-    result *= (1.0 + 0.2 * fabs(Benchmark::dist(Benchmark::e2)));
+/**
+ * Function body, batch version
+ */
+void F17RotatedHybridComposition1Noise::fBatch(const double * x, double * results, int count)
+{
+    Benchmark::hybrid_composition(x, theJob, m_dimension, results, count);
 
-    return result;
+    for (int r = 0; r < count; r++)
+    {
+        results[r] += m_bias;
+
+        // NOISE
+        // Comment the next line to remove the noise
+        results[r] *= (1.0 + 0.2 * fabs(Benchmark::dist(Benchmark::e2)));
+    }
 }
 
 
@@ -73,20 +73,10 @@ F19RotatedHybridComposition2NarrowBasinGlobalOpt::F19RotatedHybridComposition2Na
     m_testPointM = snew double[m_dimension];
     m_fmax = snew double[NUM_FUNC];
 
-    m_w  = snew double[NUM_FUNC];
-    m_z  = snew double*[NUM_FUNC];
-    m_zM = snew double*[NUM_FUNC];
-
     for (int i=0; i<NUM_FUNC; i++)
     {
         m_o[i]  = snew double[m_dimension];
-        m_z[i]  = snew double[m_dimension];
-        m_zM[i] = snew double[m_dimension];
-        m_M[i] = snew double*[m_dimension];
-        for (int j=0; j<m_dimension; j++)
-        {
-            m_M[i][j] = snew double[m_dimension];
-        }
+        m_M[i] = Benchmark::allocateMatrix(m_dimension, m_dimension);
     }
 
     // Load the shifted global optimum
@@ -111,9 +101,6 @@ F19RotatedHybridComposition2NarrowBasinGlobalOpt::F19RotatedHybridComposition2Na
     }
     theJob->o = m_o;
     theJob->M = m_M;
-    theJob->w = m_w;
-    theJob->z = m_z;
-    theJob->zM = m_zM;
     // Calculate/estimate the fmax for all the functions involved
     for (int i=0; i<NUM_FUNC; i++)
     {
@@ -138,16 +125,10 @@ F19RotatedHybridComposition2NarrowBasinGlobalOpt::~F19RotatedHybridComposition2N
     for (int i=0; i<NUM_FUNC; i++)
     {
         delete [] m_o[i];
-        delete [] m_z[i];
-        delete [] m_zM[i];
     }
     for (int i=0; i<NUM_FUNC; i++)
     {
-        for (int j=0; j<m_dimension; j++)
-        {
-            delete [] m_M[i][j];
-        }
-        delete [] m_M[i];
+        Benchmark::deleteMatrix(m_M[i]);
     }
 
     delete [] m_o;
@@ -157,10 +138,6 @@ F19RotatedHybridComposition2NarrowBasinGlobalOpt::~F19RotatedHybridComposition2N
     delete [] m_testPointM;
     delete [] m_fmax;
 
-    delete [] m_w;
-    delete [] m_z;
-    delete [] m_zM;
-
     delete theJob;
 
 } // ~F19RotatedHybridComposition2NarrowBasinGlobalOpt
@@ -208,14 +185,26 @@ double F19RotatedHybridComposition2NarrowBasinGlobalOpt::f(double * x)
 {
     double result = 0.0;
 
-    result = Benchmark::hybrid_composition(x, theJob, m_dimension);
-
-    result += m_bias;
+    fBatch(x, &result, 1);
 
     return result;
 }
 
 
+/**
+ * Function body, batch version
+ */
+void F19RotatedHybridComposition2NarrowBasinGlobalOpt::fBatch(const double * x, double * results, int count)
+{
+    Benchmark::hybrid_composition(x, theJob, m_dimension, results, count);
+
+    for (int r = 0; r < count; r++)
+    {
+        results[r] += m_bias;
+    }
+}
+
+
 std::string F19RotatedHybridComposition2NarrowBasinGlobalOpt::getFileMxName(std::string prefix, int dimension, std::string suffix)
 {
     std::stringstream sstm;
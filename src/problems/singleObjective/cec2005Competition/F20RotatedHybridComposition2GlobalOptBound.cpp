@@ -73,20 +73,10 @@ F20RotatedHybridComposition2GlobalOptBound::F20RotatedHybridComposition2GlobalOp
     m_testPointM = snew double[m_dimension];
     m_fmax = snew double[NUM_FUNC];
 
-    m_w  = snew double[NUM_FUNC];
-    m_z  = snew double*[NUM_FUNC];
-    m_zM = snew double*[NUM_FUNC];
-
     for (int i=0; i<NUM_FUNC; i++)
     {
         m_o[i]  = snew double[m_dimension];
-        m_z[i]  = snew double[m_dimension];
-        m_zM[i] = snew double[m_dimension];
-        m_M[i] = snew double*[m_dimension];
-        for (int j=0; j<m_dimension; j++)
-        {
-            m_M[i][j] = snew double[m_dimension];
-        }
+        m_M[i] = Benchmark::allocateMatrix(m_dimension, m_dimension);
     }
 
     // Load the shifted global optimum
@@ -115,9 +105,6 @@ F20RotatedHybridComposition2GlobalOptBound::F20RotatedHybridComposition2GlobalOp
     }
     theJob->o = m_o;
     theJob->M = m_M;
-    theJob->w = m_w;
-    theJob->z = m_z;
-    theJob->zM = m_zM;
     // Calculate/estimate the fmax for all the functions involved
     for (int i=0; i<NUM_FUNC; i++)
     {
@@ -142,16 +129,10 @@ F20RotatedHybridComposition2GlobalOptBound::~F20RotatedHybridComposition2GlobalO
     for (int i=0; i<NUM_FUNC; i++)
     {
         delete [] m_o[i];
-        delete [] m_z[i];
-        delete [] m_zM[i];
     }
     for (int i=0; i<NUM_FUNC; i++)
     {
-        for (int j=0; j<m_dimension; j++)
-        {
-            delete [] m_M[i][j];
-        }
-        delete [] m_M[i];
+        Benchmark::deleteMatrix(m_M[i]);
     }
 
     delete [] m_o;
@@ -161,10 +142,6 @@ F20RotatedHybridComposition2GlobalOptBound::~F20RotatedHybridComposition2GlobalO
     delete [] m_testPointM;
     delete [] m_fmax;
 
-    delete [] m_w;
-    delete [] m_z;
-    delete [] m_zM;
-
     delete theJob;
 
 } // ~F20RotatedHybridComposition2GlobalOptBound
@@ -212,14 +189,26 @@ double F20RotatedHybridComposition2GlobalOptBound::f(double * x)
 {
     double result = 0.0;
 
-    result = Benchmark::hybrid_composition(x, theJob, m_dimension);
-
-    result += m_bias;
+    fBatch(x, &result, 1);
 
     return result;
 }
 
 
+/**
+ * Function body, batch version
+ */
+void F20RotatedHybridComposition2GlobalOptBound::fBatch(const double * x, double * results, int count)
+{
+    Benchmark::hybrid_composition(x, theJob, m_dimension, results, count);
+
+    for (int r = 0; r < count; r++)
+    {
+        results[r] += m_bias;
+    }
+}
+
+
 std::string F20RotatedHybridComposition2GlobalOptBound::getFileMxName(std::string prefix, int dimension, std::string suffix)
 {
     std::stringstream sstm;
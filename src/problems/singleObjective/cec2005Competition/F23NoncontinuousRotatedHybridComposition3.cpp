@@ -73,20 +73,10 @@ F23NoncontinuousRotatedHybridComposition3::F23NoncontinuousRotatedHybridComposit
     m_testPointM = snew double[m_dimension];
     m_fmax = snew double[NUM_FUNC];
 
-    m_w  = snew double[NUM_FUNC];
-    m_z  = snew double*[NUM_FUNC];
-    m_zM = snew double*[NUM_FUNC];
-
     for (int i=0; i<NUM_FUNC; i++)
     {
         m_o[i]  = snew double[m_dimension];
-        m_z[i]  = snew double[m_dimension];
-        m_zM[i] = snew double[m_dimension];
-        m_M[i] = snew double*[m_dimension];
-        for (int j=0; j<m_dimension; j++)
-        {
-            m_M[i][j] = snew double[m_dimension];
-        }
+        m_M[i] = Benchmark::allocateMatrix(m_dimension, m_dimension);
     }
 
     // Load the shifted global optimum
@@ -107,9 +97,6 @@ F23NoncontinuousRotatedHybridComposition3::F23NoncontinuousRotatedHybridComposit
     }
     theJob->o = m_o;
     theJob->M = m_M;
-    theJob->w = m_w;
-    theJob->z = m_z;
-    theJob->zM = m_zM;
     // Calculate/estimate the fmax for all the functions involved
     for (int i=0; i<NUM_FUNC; i++)
     {
@@ -134,16 +121,10 @@ F23NoncontinuousRotatedHybridComposition3::~F23NoncontinuousRotatedHybridComposi
     for (int i=0; i<NUM_FUNC; i++)
     {
         delete [] m_o[i];
-        delete [] m_z[i];
-        delete [] m_zM[i];
     }
     for (int i=0; i<NUM_FUNC; i++)
     {
-        for (int j=0; j<m_dimension; j++)
-        {
-            delete [] m_M[i][j];
-        }
-        delete [] m_M[i];
+        Benchmark::deleteMatrix(m_M[i]);
     }
 
     delete [] m_o;
@@ -153,10 +134,6 @@ F23NoncontinuousRotatedHybridComposition3::~F23NoncontinuousRotatedHybridComposi
     delete [] m_testPointM;
     delete [] m_fmax;
 
-    delete [] m_w;
-    delete [] m_z;
-    delete [] m_zM;
-
     delete theJob;
 
 } // ~F23NoncontinuousRotatedHybridComposition3
@@ -204,16 +181,32 @@ double F23NoncontinuousRotatedHybridComposition3::f(double * x)
 {
     double result = 0.0;
 
-    for (int i = 0 ; i < m_dimension ; i ++)
+    fBatch(x, &result, 1);
+
+    return result;
+}
+
+
+/**
+ * Function body, batch version
+ */
+void F23NoncontinuousRotatedHybridComposition3::fBatch(const double * x, double * results, int count)
+{
+    double * rounded = Benchmark::workspace(Benchmark::WORKSPACE_INPUT, count * m_dimension);
+    for (int r = 0; r < count; r++)
     {
-        x[i] = Benchmark::myXRound(x[i], m_o[0][i]);
+        for (int i = 0 ; i < m_dimension ; i ++)
+        {
+            rounded[r * m_dimension + i] = Benchmark::myXRound(x[r * m_dimension + i], m_o[0][i]);
+        }
     }
 
-    result = Benchmark::hybrid_composition(x, theJob, m_dimension);
-
-    result += m_bias;
+    Benchmark::hybrid_composition(rounded, theJob, m_dimension, results, count);
 
-    return result;
+    for (int r = 0; r < count; r++)
+    {
+        results[r] += m_bias;
+    }
 }
 
 
@@ -50,12 +50,6 @@ private:
     double * m_testPointM;
     double * m_fmax;
 
-    // In order to avoid excessive memory allocation,
-    // a fixed memory buffer is allocated for each function object.
-    double * m_w;
-    double ** m_z;
-    double ** m_zM;
-
     class MyHCJob : public HCJob
     {
     public:
@@ -74,6 +68,7 @@ public:
     ~F23NoncontinuousRotatedHybridComposition3();
 
     double f (double * x);
+    void fBatch(const double * x, double * results, int count);
 
 }; // F23NoncontinuousRotatedHybridComposition3
 
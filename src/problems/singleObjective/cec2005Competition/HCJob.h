@@ -44,13 +44,10 @@ public:
     double* fmax;
     // Shift global optimum for each basic function
     double** o;
-    // Linear transformation matrix for each basic function
+    // Linear transformation matrix for each basic function, with its rows
+    // stored contiguously (see Benchmark::allocateMatrix)
     double*** M;
 
-    // Working areas to avoid memory allocation operations
-    double* w;
-    double** z;
-    double** zM;
     HCJob(int numFunc);
     virtual ~HCJob();
     virtual double basic_func(int func_no, double* x, int length) = 0;
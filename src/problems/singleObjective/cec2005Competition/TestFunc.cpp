@@ -21,6 +21,7 @@
 
 
 #include <TestFunc.h>
+#include <Benchmark.h>
 
 /**
  * Constructor.
@@ -46,6 +47,21 @@ TestFunc::~TestFunc()
 {
 } // ~TestFunc
 
+/**
+ * Evaluates count points stored one after another in x. This default version
+ * calls f on a per-thread copy of each point; the rotated functions override
+ * it to shift and rotate all the points together.
+ */
+void TestFunc::fBatch(const double * x, double * results, int count)
+{
+    double * point = Benchmark::workspace(Benchmark::WORKSPACE_INPUT, m_dimension);
+    for (int r = 0; r < count; r++)
+    {
+        std::copy(x + r * m_dimension, x + (r + 1) * m_dimension, point);
+        results[r] = f(point);
+    }
+} // fBatch
+
 int TestFunc::dimension()
 {
     return (m_dimension);
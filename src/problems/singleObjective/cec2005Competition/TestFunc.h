@@ -39,6 +39,7 @@ public:
     TestFunc(int dimension, double bias, string func_name);
     virtual ~TestFunc();
     virtual double f(double * x) = 0;
+    virtual void fBatch(const double * x, double * results, int count);
     int dimension();
     double bias();
     string name();
@@ -18,8 +18,105 @@
 //  You should have received a copy of the GNU Lesser General Public License
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
-
 #include <Epsilon.h>
+#include <algorithm>
+#include <atomic>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define JMETAL_EPSILON_AVX2
+#include <immintrin.h>
+#endif
+
+
+namespace
+{
+
+/**
+ * Minimum number of |A| x |B| x M operations for which the reference points
+ * are distributed among the threads
+ */
+const long PARALLEL_THRESHOLD = 1L << 18;
+
+
+#ifdef JMETAL_EPSILON_AVX2
+
+/**
+ * AVX2 additive epsilon of one reference point: four solution points per
+ * instruction, reading the solution front column by column. Stops as soon as
+ * the minimum is not greater than bound.
+ */
+__attribute__((target("avx2")))
+double additivePointAVX2(const double * columns, int size, int dim,
+                         const double * a, double bound)
+{
+    __m256d minimum = _mm256_set1_pd(std::numeric_limits<double>::max());
+    int j = 0;
+    for (; j + 4 <= size; j += 4)
+    {
+        __m256d m = _mm256_sub_pd(_mm256_loadu_pd(columns + j),
+                                  _mm256_set1_pd(a[0]));
+        for (int k = 1; k < dim; k++)
+        {
+            m = _mm256_max_pd(m, _mm256_sub_pd(_mm256_loadu_pd(columns + k * size + j),
+                                               _mm256_set1_pd(a[k])));
+        }
+        minimum = _mm256_min_pd(minimum, m);
+
+        if ((j & 15) == 12)
+        {
+            __m128d low = _mm_min_pd(_mm256_castpd256_pd128(minimum),
+                                     _mm256_extractf128_pd(minimum, 1));
+            low = _mm_min_sd(low, _mm_unpackhi_pd(low, low));
+            if (_mm_cvtsd_f64(low) <= bound)
+            {
+                return _mm_cvtsd_f64(low);
+            }
+        }
+    }
+
+    __m128d low = _mm_min_pd(_mm256_castpd256_pd128(minimum),
+                             _mm256_extractf128_pd(minimum, 1));
+    low = _mm_min_sd(low, _mm_unpackhi_pd(low, low));
+    double result = _mm_cvtsd_f64(low);
+
+    for (; j < size; j++)
+    {
+        double m = columns[j] - a[0];
+        for (int k = 1; k < dim; k++)
+        {
+            double t = columns[k * size + j] - a[k];
+            if (t > m)
+                m = t;
+        }
+        if (m < result)
+            result = m;
+    }
+    return result;
+} // additivePointAVX2
+
+
+bool hasAVX2()
+{
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2;
+} // hasAVX2
+
+#endif
+
+
+/**
+ * Atomically raises value to candidate if candidate is greater
+ */
+void atomicMax(std::atomic<double> & value, double candidate)
+{
+    double current = value.load(std::memory_order_relaxed);
+    while ((candidate > current) &&
+            !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+    {
+    }
+} // atomicMax
+
+} // namespace
 
 
 /**
@@ -29,6 +126,8 @@
 Epsilon::Epsilon()
 {
     utils_ = snew MetricsUtil();
+    method_ = 0;
+    pool_ = nullptr;
 } // Epsilon
 
 
@@ -38,68 +137,190 @@ Epsilon::Epsilon()
 Epsilon::~Epsilon()
 {
     delete utils_;
+    delete pool_;
 } // ~Epsilon
 
 
+/**
+ * Sets the number of threads used on large fronts
+ * @param numberOfThreads The number of threads (1 = sequential)
+ */
+void Epsilon::setNumberOfThreads(int numberOfThreads)
+{
+    delete pool_;
+    pool_ = nullptr;
+    if (numberOfThreads > 1)
+    {
+        pool_ = snew ThreadPool(numberOfThreads);
+    }
+} // setNumberOfThreads
+
+
 /**
  * Returns the epsilon indicator.
  * @param b. True Pareto front
  * @param a. Solution front
+ * @param dim. Unused, kept for compatibility: the number of objectives is
+ * inferred from the fronts
  * @return the value of the epsilon indicator
  */
-double Epsilon::epsilon(MatrixOfDouble b, MatrixOfDouble a,
-                        int dim)
+double Epsilon::epsilon(const MatrixOfDouble & b, const MatrixOfDouble & a,
+                        int /* dim */)
 {
+    FrontBuffer frontB(b);
+    FrontBuffer frontA(a);
+    return epsilon(frontB, frontA);
+} // epsilon
 
-    int  i, j, k;
-    double  eps, eps_j = 0.0, eps_k=0.0, eps_temp;
-
-    dim_ = dim;
-    set_params() ;
 
+/**
+ * Returns the epsilon indicator of two contiguous fronts.
+ * @param b. True Pareto front
+ * @param a. Solution front
+ * @return the value of the epsilon indicator
+ */
+double Epsilon::epsilon(const FrontBuffer & b, const FrontBuffer & a)
+{
     if (method_ == 0)
-        eps = -std::numeric_limits<double>::max();
+        return additive(b, a);
     else
-        eps= 0;
+        return multiplicative(b, a);
+} // epsilon
+
 
-    for (i = 0; i < a.size(); i++)
+/**
+ * Additive epsilon of one reference point, i.e. the minimum over the points
+ * of b of their maximum difference with a. The search stops once the minimum
+ * is not greater than bound, as it can no longer change the indicator.
+ */
+double Epsilon::additivePoint(const FrontBuffer & b, const double * a,
+                              double bound)
+{
+    int size = b.size();
+    int dim  = b.getNumberOfObjectives();
+
+#ifdef JMETAL_EPSILON_AVX2
+    if ((size >= 8) && hasAVX2())
+    {
+        return additivePointAVX2(columns_.data(), size, dim, a, bound);
+    }
+#endif
+
+    double eps_j = std::numeric_limits<double>::max();
+    for (int j = 0; j < size; j++)
+    {
+        const double * point = b.row(j);
+        double eps_k = point[0] - a[0];
+        for (int k = 1; (k < dim) && (eps_k < eps_j); k++)
+        {
+            double eps_temp = point[k] - a[k];
+            if (eps_k < eps_temp)
+                eps_k = eps_temp;
+        }
+        if (eps_j > eps_k)
+        {
+            eps_j = eps_k;
+            if (eps_j <= bound)
+                break;
+        }
+    }
+    return eps_j;
+} // additivePoint
+
+
+double Epsilon::additive(const FrontBuffer & b, const FrontBuffer & a)
+{
+    int dim = b.getNumberOfObjectives();
+
+    if (a.size() == 0)
+        return -std::numeric_limits<double>::max();
+    if (b.size() == 0)
+        return 0.0;
+
+    // Column-major copy of b for the vectorized kernel
+    columns_.resize(b.size() * dim);
+    for (int j = 0; j < b.size(); j++)
+    {
+        for (int k = 0; k < dim; k++)
+        {
+            columns_[k * b.size() + j] = b.row(j)[k];
+        }
+    }
+
+    long work = (long) a.size() * b.size() * dim;
+    if ((pool_ == nullptr) || (work < PARALLEL_THRESHOLD))
     {
-        for (j = 0; j < b.size(); j++)
+        double eps = -std::numeric_limits<double>::max();
+        for (int i = 0; i < a.size(); i++)
         {
-            for (k = 0; k < dim_; k++)
+            double eps_j = additivePoint(b, a.row(i), eps);
+            if (eps < eps_j)
+                eps = eps_j;
+        }
+        return eps;
+    }
+
+    // The reference points are split in chunks; the threads share the
+    // current value, so that every one of them prunes with the best bound
+    std::atomic<double> eps(-std::numeric_limits<double>::max());
+    int chunks = pool_->getNumberOfThreads() * 4;
+    int chunkSize = (a.size() + chunks - 1) / chunks;
+    pool_->parallelFor(chunks, [this, &a, &b, &eps, chunkSize](int chunk)
+    {
+        int end = std::min((int) a.size(), (chunk + 1) * chunkSize);
+        for (int i = chunk * chunkSize; i < end; i++)
+        {
+            double bound = eps.load(std::memory_order_relaxed);
+            double eps_j = additivePoint(b, a.row(i), bound);
+            if (eps_j > bound)
+                atomicMax(eps, eps_j);
+        }
+    });
+    return eps.load();
+} // additive
+
+
+double Epsilon::multiplicative(const FrontBuffer & b, const FrontBuffer & a)
+{
+    int dim = b.getNumberOfObjectives();
+    double eps = 0, eps_j = 0.0, eps_k = 0.0, eps_temp;
+
+    // Every pair of values of an objective must have the same strict sign
+    for (int k = 0; (k < dim) && (a.size() > 0) && (b.size() > 0); k++)
+    {
+        bool zero = false;
+        bool positiveA = false, negativeA = false;
+        bool positiveB = false, negativeB = false;
+        for (int i = 0; i < a.size(); i++)
+        {
+            zero      |= (a.row(i)[k] == 0);
+            positiveA |= (a.row(i)[k] > 0);
+            negativeA |= (a.row(i)[k] < 0);
+        }
+        for (int j = 0; j < b.size(); j++)
+        {
+            zero      |= (b.row(j)[k] == 0);
+            positiveB |= (b.row(j)[k] > 0);
+            negativeB |= (b.row(j)[k] < 0);
+        }
+        if (zero || (negativeA && positiveB) || (positiveA && negativeB))
+        {
+            std::cout << "error in data file" << std::endl;
+            exit(-1);
+        }
+    }
+
+    for (int i = 0; i < a.size(); i++)
+    {
+        const double * pointA = a.row(i);
+        for (int j = 0; j < b.size(); j++)
+        {
+            const double * pointB = b.row(j);
+            eps_k = pointB[0] / pointA[0];
+            for (int k = 1; k < dim; k++)
             {
-                switch (method_)
-                {
-                case 0:
-                    if (obj_[k] == 0)
-                        eps_temp = b[j][k] - a[i][k];
-                    //eps_temp = b[j * dim_ + k] - a[i * dim_ + k];
-                    else
-                        eps_temp = a[i][k] - b[j][k];
-                    //eps_temp = a[i * dim_ + k] - b[j * dim_ + k];
-                    break;
-                default:
-                    if ( (a[i][k] < 0 && b[j][k] > 0) ||
-                            (a[i][k] > 0 && b[j][k] < 0) ||
-                            (a[i][k] == 0 || b[j][k] == 0))
-                    {
-                        //if ( (a[i * dim_ + k] < 0 && b[j * dim_ + k] > 0) ||
-                        //     (a[i * dim_ + k] > 0 && b[j * dim_ + k] < 0) ||
-                        //     (a[i * dim_ + k] == 0 || b[j * dim_ + k] == 0)) {
-                        std::cout << "error in data file" << std::endl;
-                        exit(-1);
-                    }
-                    if (obj_[k] == 0)
-                        eps_temp = b[j][k] / a[i][k];
-                    //eps_temp = b[j * dim_ + k] / a[i * dim_ + k];
-                    else
-                        eps_temp = a[i][k] / b[j][k];
-                    //eps_temp = a[i * dim_ + k] / b[j * dim_ + k];
-                    break;
-                }
-                if (k == 0)
-                    eps_k = eps_temp;
-                else if (eps_k < eps_temp)
+                eps_temp = pointB[k] / pointA[k];
+                if (eps_k < eps_temp)
                     eps_k = eps_temp;
             }
             if (j == 0)
@@ -112,30 +333,5 @@ double Epsilon::epsilon(MatrixOfDouble b, MatrixOfDouble a,
         else if (eps < eps_j)
             eps = eps_j;
     }
-    free_params();
     return eps;
-} // epsilon
-
-
-/**
- * Established the params by default
- */
-void Epsilon::set_params()
-{
-    int  i;
-    obj_ = snew int[dim_];
-    for (i = 0; i < dim_; i++)
-    {
-        obj_[i] = 0;
-    }
-    method_ = 0;
-} // set_params
-
-
-/**
- * Free the reserved memory for the params
- */
-void Epsilon::free_params()
-{
-    delete [] obj_;
-} // set_params
+} // multiplicative
@@ -22,6 +22,8 @@
 #define __EPSILON__
 
 #include <MetricsUtil.h>
+#include <FrontBuffer.h>
+#include <ThreadPool.h>
 #include <vector>
 
 
@@ -37,19 +39,26 @@
 
 using namespace JMetal;
 
+/**
+ * The indicator works on contiguous FrontBuffer objects; the MatrixOfDouble
+ * interface copies its arguments into such buffers. All the objectives are
+ * minimized. The additive version skips a reference point as soon as it
+ * cannot increase the current value, and a solution point as soon as it
+ * cannot decrease the minimum of the current reference point.
+ */
 class Epsilon
 {
 
 private:
 
-    int dim_; // stores the number of objectives
-    int * obj_; // obj_[i]=0 means objective i is to be minimized. This code always supposes
-    //the minimization of all the objectives
     int method_; // method_ = 0 means apply additive epsilon and method_ = 1 means multiplicative
     // epsilon. This code always apply additive epsilon
+    ThreadPool * pool_;
+    std::vector<double> columns_; // the solution front stored column by column
 
-    void set_params();
-    void free_params();
+    double additive(const FrontBuffer & b, const FrontBuffer & a);
+    double multiplicative(const FrontBuffer & b, const FrontBuffer & a);
+    double additivePoint(const FrontBuffer & b, const double * a, double bound);
 
 public:
 
@@ -57,7 +66,9 @@ public:
 
     Epsilon();
     ~Epsilon();
-    double epsilon(MatrixOfDouble b, MatrixOfDouble a, int dim);
+    void setNumberOfThreads(int numberOfThreads);
+    double epsilon(const MatrixOfDouble & b, const MatrixOfDouble & a, int dim);
+    double epsilon(const FrontBuffer & b, const FrontBuffer & a);
 
 }; // Epsilon
 
@@ -18,6 +18,7 @@
 //  You should have received a copy of the GNU Lesser General Public License
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
+
 #include <Hypervolume.h>
 
 
@@ -25,7 +26,7 @@
  * Constructor
  * Creates a new instance of Hypervolume
  */
-Hypervolume::Hypervolume()
+Hypervolume::Hypervolume() : monteCarlo_(0)
 {
     utils_ = snew MetricsUtil();
 } // Hypervolume
@@ -40,297 +41,115 @@ Hypervolume::~Hypervolume()
 } // ~Hypervolume
 
 
-/*
- * returns true if 'point1' dominates 'points2' with respect to the
- * to the first 'noObjectives' objectives
+/**
+ * Sets the number of threads used with large fronts of four or more
+ * objectives
+ * @param numberOfThreads The number of threads (1 = sequential)
  */
-bool Hypervolume::dominates(double* point1, double* point2, int noObjectives)
-{
-
-    int i;
-    bool betterInAnyObjective = false;
-
-    for (i = 0; i < noObjectives && point1[i] >= point2[i]; i++)
-    {
-        if (point1[i] > point2[i])
-        {
-            betterInAnyObjective = true;
-        } // if
-    } // for
-
-    return ((i >= noObjectives) && betterInAnyObjective);
-
-} // dominates
-
-
-void Hypervolume::swap(double** front, int i, int j)
+void Hypervolume::setNumberOfThreads(int numberOfThreads)
 {
-
-    double* temp = front[i];
-    front[i] = front[j];
-    front[j] = temp;
-
-} // swap
+    engine_.setNumberOfThreads(numberOfThreads);
+} // setNumberOfThreads
 
 
-/*
- * all nondominated points regarding the first 'noObjectives' dimensions
- * are collected; the points referenced by 'front[0..noPoints-1]' are
- * considered; 'front' is resorted, such that 'front[0..n-1]' contains
- * the nondominated points; n is returned
+/**
+ * Selects between the exact value and a Monte Carlo estimation
+ * @param numberOfSamples The number of samples of the estimation (0 = exact)
  */
-int Hypervolume::filterNondominatedSet(double** front, int noPoints,
-                                       int noObjectives)
+void Hypervolume::setNumberOfSamples(int numberOfSamples)
 {
+    monteCarlo_.setNumberOfSamples(numberOfSamples);
+} // setNumberOfSamples
 
-    int i, j;
-    int n;
-
-    n = noPoints;
-    i = 0;
-
-    while (i < n)
-    {
-        j = i + 1;
-        while (j < n)
-        {
-            if (dominates(front[i], front[j], noObjectives))
-            {
-                /* remove point 'j' */
-                n--;
-                swap(front, j, n);
-            }
-            else if (dominates(front[j], front[i], noObjectives))
-            {
-                /* remove point 'i'; ensure that the point copied to index 'i'
-                   is considered in the next outer loop (thus, decrement i) */
-                n--;
-                swap(front, i, n);
-                i--;
-                break;
-            }
-            else
-            {
-                j++;
-            }
-        } // while
-        i++;
-    } // while
-
-    return n;
-
-} // filterNondominatedSet
 
-
-/*
- * calculate next value regarding dimension 'objective'; consider
- * points referenced in 'front[0..noPoints-1]'
+/**
+ * Returns the half-width of the 95% confidence interval of the last value
+ * (0 if it was computed exactly)
  */
-double Hypervolume::surfaceUnchangedTo(double** front, int noPoints,
-                                       int objective)
+double Hypervolume::getError() const
 {
-
-    int i;
-    double minValue, value;
-
-    if (noPoints < 1)
-    {
-        std::cout << "run-time error" << std::endl;
-        exit(-1);
-    }
-
-    minValue = front[0][objective];
-    for (i = 1; i < noPoints; i++)
-    {
-        value = front[i][objective];
-        if (value < minValue)
-        {
-            minValue = value;
-        }
-    }
-
-    return minValue;
-
-} // surfaceUnchangedTo
+    return (monteCarlo_.getNumberOfSamples() > 0) ? monteCarlo_.getError() : 0.0;
+} // getError
 
 
-/*
- * remove all points which have a value <= 'threshold' regarding the
- * dimension 'objective'; the points referenced by
- * 'front[0..noPoints-1]' are considered; 'front' is resorted, such that
- * 'front[0..n-1]' contains the remaining points; 'n' is returned
+/**
+ * Returns the hypervolume of a front of 'noPoints' points for maximization,
+ * using the origin as reference point (the interface of the original
+ * implementation by Zitzler). The value is always exact. The front is not
+ * modified
  */
-int Hypervolume::reduceNondominatedSet(double** front, int noPoints,
-                                       int objective, double threshold)
-{
-
-    int n;
-    int i;
-
-    n = noPoints;
-    for (i = 0; i < n; i++)
-    {
-        if (front[i][objective] <= threshold)
-        {
-            n--;
-            swap(front, i, n);
-        } // if
-    } // for
-
-    return n;
-
-} // ReduceNondominatedSet
-
-
 double Hypervolume::calculateHypervolume(double** front, int noPoints,
         int noObjectives)
 {
-
-    int n;
-    double volume, distance;
-
-    volume = 0;
-    distance = 0;
-    n = noPoints;
-    while (n > 0)
+    points_.resize(static_cast<size_t>(noPoints) * noObjectives);
+    for (int i = 0; i < noPoints; i++)
     {
-
-        int noNondominatedPoints;
-        double tempVolume, tempDistance;
-
-        noNondominatedPoints = filterNondominatedSet(front, n, noObjectives - 1);
-        tempVolume = 0;
-        if (noObjectives < 3)
+        for (int j = 0; j < noObjectives; j++)
         {
-            if (noNondominatedPoints < 1)
-            {
-                std::cout << "run-time error" << std::endl;
-                exit(-1);
-            } // if
-            tempVolume = front[0][0];
+            points_[i * noObjectives + j] = -front[i][j];
         }
-        else
-        {
-            tempVolume = calculateHypervolume(front,
-                                              noNondominatedPoints,
-                                              noObjectives - 1);
-        } // if
-
-        tempDistance = surfaceUnchangedTo(front, n, noObjectives - 1);
-        volume += tempVolume * (tempDistance - distance);
-        distance = tempDistance;
-        n = reduceNondominatedSet(front, n, noObjectives - 1, distance);
-    } // while
-
-    return volume;
+    }
+    referencePoint_.assign(noObjectives, 0.0);
 
+    return engine_.compute(points_.data(), noPoints, noObjectives,
+                           referencePoint_.data());
 } // calculateHypervolume
 
 
-/*
- * merge two fronts
+/**
+ * Returns the hypervolume value of the paretoFront
+ * @param paretoFront The pareto front
+ * @param paretoTrueFront The true pareto front
+ * @param numberOfObjectives Number of objectives of the pareto front
  */
-double**  Hypervolume::mergeFronts(double** front1, int sizeFront1,
-                                   double** front2, int sizeFront2, int noObjectives)
+double Hypervolume::hypervolume(const MatrixOfDouble & paretoFront,
+                                const MatrixOfDouble & paretoTrueFront, int numberOfObjectives)
 {
-
-    int i, j;
-    int noPoints = sizeFront1 + sizeFront2;
-    double** frontPtr =0;
-
-    /* allocate memory */
-    frontPtr =snew double*[noPoints];
-    for (int y=0; y< noPoints; ++y)
-    {
-        frontPtr[y] = snew double[noObjectives];
-    }
-
-    /* copy points */
-    noPoints = 0;
-    for (i = 0; i < sizeFront1; i++)
+    if (paretoFront.empty())
     {
-        for (j = 0; j < noObjectives; j++)
-        {
-            frontPtr[noPoints][j] = front1[i][j];
-        }
-        noPoints++;
-    }
-    for (i = 0; i < sizeFront2; i++)
-    {
-        for (j = 0; j < noObjectives; j++)
-        {
-            frontPtr[noPoints][j] = front2[i][j];
-        }
-        noPoints++;
+        return 0.0;
     }
-
-    return frontPtr;
-
-} // mergeFronts
+    return hypervolume(FrontBuffer(paretoFront), FrontBuffer(paretoTrueFront));
+} // hypervolume
 
 
 /**
- * Returns the hypervolume value of the paretoFront. This method call to the
- * calculate hipervolume one
+ * Returns the hypervolume value of the paretoFront
  * @param paretoFront The pareto front
  * @param paretoTrueFront The true pareto front
- * @param numberOfObjectives Number of objectives of the pareto front
  */
-double Hypervolume::hypervolume(MatrixOfDouble paretoFront,
-                                MatrixOfDouble paretoTrueFront, int numberOfObjectives)
+double Hypervolume::hypervolume(const FrontBuffer & paretoFront,
+                                const FrontBuffer & paretoTrueFront)
 {
-
-    /**
-     * Stores the maximum values of true pareto front.
-     */
-    VectorOfDouble maximumValues;
-
-    /**
-     * Stores the minimum values of the true pareto front.
-     */
-    VectorOfDouble minimumValues;
-
-    /**
-     * Stores the normalized front.
-     */
-    MatrixOfDouble normalizedFront;
-
-    /**
-     * Stores the inverted front. Needed for minimization problems
-     */
-    MatrixOfDouble invertedFront;
-
-    // STEP 1. Obtain the maximum and minimum values of the Pareto front
-    maximumValues = utils_->getMaximumValues(paretoTrueFront, numberOfObjectives);
-    minimumValues = utils_->getMinimumValues(paretoTrueFront, numberOfObjectives);
-
-    // STEP 2. Get the normalized front
-    normalizedFront = utils_->getNormalizedFront(paretoFront, maximumValues, minimumValues);
-
-    // STEP 3. Inverse the pareto front. This is needed because of the original
-    //metric by Zitzler is for maximization problems
-    invertedFront = utils_->invertedFront(normalizedFront);
-
-    /*Makes a copy of invertedFront in pointer of pointer format*/
-    double ** invertedFront2 = snew double*[invertedFront.size()];
-    for (int i = 0; i < invertedFront.size(); i++)
+    int numberOfObjectives = paretoFront.getNumberOfObjectives();
+    int size = paretoFront.size();
+
+    // STEP 1. Obtain the maximum and minimum values of the true Pareto front
+    std::vector<double> maximumValues(numberOfObjectives);
+    std::vector<double> minimumValues(numberOfObjectives);
+    paretoTrueFront.getMaximumValues(maximumValues.data());
+    paretoTrueFront.getMinimumValues(minimumValues.data());
+
+    // STEP 2. Normalize the front, clipping the values below the lower bound
+    points_.resize(static_cast<size_t>(size) * numberOfObjectives);
+    for (int i = 0; i < size; i++)
     {
-        invertedFront2[i] = snew double[invertedFront[i].size()];
-        for (int j = 0; j < invertedFront[i].size(); j++)
+        const double * point = paretoFront.row(i);
+        for (int j = 0; j < numberOfObjectives; j++)
         {
-            invertedFront2[i][j] = invertedFront[i][j];
+            double value = (point[j] - minimumValues[j]) /
+                           (maximumValues[j] - minimumValues[j]);
+            points_[i * numberOfObjectives + j] = (value < 0.0) ? 0.0 : value;
         }
     }
 
-    // STEP4. The hypervolume (control is passed to java version of Zitzler code)
-    double hv=this->calculateHypervolume(invertedFront2,invertedFront.size(),numberOfObjectives);
-
-    for( int y = 0 ; y < invertedFront.size() ; y++ )
+    // STEP 3. The hypervolume with respect to (1, ..., 1)
+    referencePoint_.assign(numberOfObjectives, 1.0);
+    if (monteCarlo_.getNumberOfSamples() > 0)
     {
-        delete [] invertedFront2[y] ;
+        return monteCarlo_.estimate(points_.data(), size, numberOfObjectives,
+                                    referencePoint_.data());
     }
-    delete [] invertedFront2;
-
-    return hv;
-
-}// hypervolume
+    return engine_.compute(points_.data(), size, numberOfObjectives,
+                           referencePoint_.data());
+} // hypervolume
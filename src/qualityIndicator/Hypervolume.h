@@ -22,6 +22,9 @@
 #define __HYPERVOLUME__
 
 #include <MetricsUtil.h>
+#include <FrontBuffer.h>
+#include <HypervolumeEngine.h>
+#include <MonteCarloHypervolume.h>
 #include <iostream>
 #include <cstdlib>
 #include <vector>
@@ -29,8 +32,17 @@
 
 
 /**
- * This class implements the hypervolume indicator. The code is a C++ version
- * of the original metric implementation by Eckart Zitzler.
+ * This class implements the hypervolume indicator. The front is normalized
+ * with the bounds of the true Pareto front and its hypervolume is computed,
+ * for minimization, with respect to the reference point (1, ..., 1). Values
+ * below the lower bound are clipped to it, and points reaching the reference
+ * point in any objective do not contribute.
+ * The values are computed exactly by a HypervolumeEngine (O(n log n) for two
+ * and three objectives, WFG for more). They are the same as those of the
+ * original metric implementation by Eckart Zitzler.
+ * With setNumberOfSamples the value is instead estimated by Monte Carlo
+ * sampling, which is the only option with many objectives; getError() then
+ * returns the half-width of its 95% confidence interval.
  * Reference: E. Zitzler and L. Thiele
  *           Multiobjective Evolutionary Algorithms: A Comparative Case Study
  *           and the Strength Pareto Approach,
@@ -43,14 +55,10 @@ class Hypervolume
 
 private:
 
-    bool dominates(double * point1, double * point2, int noObjectives);
-    void swap(double** front, int i, int j);
-    int filterNondominatedSet(double** front, int noPoints, int noObjectives);
-    double surfaceUnchangedTo(double ** front, int noPoints, int objective);
-    int reduceNondominatedSet(double** front, int noPoints, int objective,
-                              double threshold);
-    double** mergeFronts(double** front1, int sizeFront1, double** front2,
-                         int sizeFront2, int noObjectives);
+    HypervolumeEngine engine_;
+    MonteCarloHypervolume monteCarlo_;
+    std::vector<double> points_;
+    std::vector<double> referencePoint_;
 
 public:
 
@@ -59,9 +67,14 @@ public:
     Hypervolume();
     ~Hypervolume();
 
+    void setNumberOfThreads(int numberOfThreads);
+    void setNumberOfSamples(int numberOfSamples);
+    double getError() const;
     double calculateHypervolume(double** front, int noPoints, int noObjectives);
-    double hypervolume(MatrixOfDouble paretoFront,
-                       MatrixOfDouble paretoTrueFront, int numberOfObjectives);
+    double hypervolume(const MatrixOfDouble & paretoFront,
+                       const MatrixOfDouble & paretoTrueFront, int numberOfObjectives);
+    double hypervolume(const FrontBuffer & paretoFront,
+                       const FrontBuffer & paretoTrueFront);
 
 };
 
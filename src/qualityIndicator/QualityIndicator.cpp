@@ -33,9 +33,10 @@ QualityIndicator::QualityIndicator(Problem * problem,
     dim_ = problem_->getNumberOfObjectives();
     utilities_ = new MetricsUtil();
     trueParetoFront_ = utilities_->readNonDominatedSolutionSet(paretoFrontFile);
+    trueParetoFrontBuffer_.assign(trueParetoFront_);
     Hypervolume * hv = new Hypervolume();
-    trueParetoFrontHypervolume_ = hv->hypervolume(trueParetoFront_->writeObjectivesToMatrix(),
-                                  trueParetoFront_->writeObjectivesToMatrix(), problem_->getNumberOfObjectives());
+    trueParetoFrontHypervolume_ = hv->hypervolume(trueParetoFrontBuffer_,
+                                  trueParetoFrontBuffer_);
     delete hv;
 } // Constructor
 
@@ -57,13 +58,30 @@ QualityIndicator::~QualityIndicator()
 double QualityIndicator::getHypervolume(SolutionSet * solutionSet)
 {
     Hypervolume * hv = new Hypervolume();
-    double res =  hv->hypervolume(solutionSet->writeObjectivesToMatrix(),
-                                  trueParetoFront_->writeObjectivesToMatrix(),
-                                  dim_);
+    double res =  hv->hypervolume(FrontBuffer(solutionSet),
+                                  trueParetoFrontBuffer_);
     delete hv;
     return res;
 } // getHypervolume
 
+/**
+ * Returns a Monte Carlo estimation of the hypervolume of solution set, for
+ * numbers of objectives where the exact value is too expensive
+ * @param solutionSet
+ * @param numberOfSamples The number of samples
+ * @return The estimated value of the hypervolume indicator
+ */
+double QualityIndicator::getApproximateHypervolume(SolutionSet * solutionSet,
+        int numberOfSamples)
+{
+    Hypervolume * hv = new Hypervolume();
+    hv->setNumberOfSamples(numberOfSamples);
+    double res =  hv->hypervolume(FrontBuffer(solutionSet),
+                                  trueParetoFrontBuffer_);
+    delete hv;
+    return res;
+} // getApproximateHypervolume
+
 
 /**
  * Returns the hypervolume of the true Pareto front
@@ -116,9 +134,7 @@ double QualityIndicator::getGD(SolutionSet * solutionSet)
 double QualityIndicator::getSpread(SolutionSet * solutionSet)
 {
     Spread * s = new Spread();
-    double res = s->spread(solutionSet->writeObjectivesToMatrix(),
-                           trueParetoFront_->writeObjectivesToMatrix(),
-                           dim_);
+    double res = s->spread(FrontBuffer(solutionSet), trueParetoFrontBuffer_);
     delete s;
     return res;
 } // getSpread
@@ -132,9 +148,7 @@ double QualityIndicator::getSpread(SolutionSet * solutionSet)
 double QualityIndicator::getEpsilon(SolutionSet * solutionSet)
 {
     Epsilon * e = new Epsilon();
-    double res = e->epsilon(solutionSet->writeObjectivesToMatrix(),
-                            trueParetoFront_->writeObjectivesToMatrix(),
-                            dim_);
+    double res = e->epsilon(FrontBuffer(solutionSet), trueParetoFrontBuffer_);
     delete e;
     return res;
 } // getEpsilon
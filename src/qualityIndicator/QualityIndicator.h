@@ -28,6 +28,7 @@
 #include <Hypervolume.h>
 #include <Spread.h>
 #include <Epsilon.h>
+#include <FrontBuffer.h>
 #include <GenerationalDistance.h>
 #include <InvertedGenerationalDistance.h>
 
@@ -36,6 +37,7 @@ class QualityIndicator
 
 private:
     SolutionSet * trueParetoFront_;
+    FrontBuffer trueParetoFrontBuffer_;
     double trueParetoFrontHypervolume_;
     Problem * problem_;
     int dim_;
@@ -45,6 +47,7 @@ public:
     QualityIndicator(Problem * problem, std::string paretoFrontFile);
     ~QualityIndicator();
     double getHypervolume(SolutionSet * solutionSet);
+    double getApproximateHypervolume(SolutionSet * solutionSet, int numberOfSamples);
     double getTrueParetoFrontHypervolume();
     double getIGD(SolutionSet * solutionSet);
     double getGD(SolutionSet * solutionSet);
@@ -41,24 +41,37 @@ Spread::~Spread()
 } // ~Spread
 
 
-bool Spread::compareFront(VectorOfDouble pointOne, VectorOfDouble pointTwo)
+namespace
 {
 
-    int value;
-    bool result = false;
+/**
+ * Lexicographical order of two points, as LexicoGraphicalComparator
+ */
+inline bool lexicographicLess(const double * one, const double * two, int m)
+{
+    for (int k = 0; k < m; k++)
+    {
+        if (one[k] != two[k])
+        {
+            return one[k] < two[k];
+        }
+    }
+    return false;
+} // lexicographicLess
 
-    LexicoGraphicalComparator * c = new LexicoGraphicalComparator();
-    value = c->compare(&pointOne, &pointTwo);
-    delete c;
 
-    if (value == -1)
+inline double distance(const double * one, const double * two, int m)
+{
+    double distance = 0.0;
+    for (int k = 0; k < m; k++)
     {
-        result = true;
+        double d = one[k] - two[k];
+        distance += d * d;
     }
+    return sqrt(distance);
+} // distance
 
-    return result;
-
-} // compareFront
+} // namespace
 
 
 /** Calculates the Spread metric. Given the front, the true pareto front as
@@ -66,65 +79,85 @@ bool Spread::compareFront(VectorOfDouble pointOne, VectorOfDouble pointTwo)
  * the method returns the value of the metric.
  *  @param front The front.
  *  @param trueParetoFront The true pareto front.
- *  @param numberOfObjectives The number of objectives.
+ *  @param numberOfObjectives Unused, kept for compatibility: the number of
+ *  objectives is inferred from the fronts.
  */
-double Spread::spread(std::vector <VectorOfDouble > front,
-                      std::vector <VectorOfDouble > trueParetoFront, int numberOfObjectives)
+double Spread::spread(const std::vector <VectorOfDouble > & front,
+                      const std::vector <VectorOfDouble > & trueParetoFront, int /* numberOfObjectives */)
 {
+    FrontBuffer solutionFront(front);
+    FrontBuffer paretoFront(trueParetoFront);
+    return spread(solutionFront, paretoFront);
+} // spread
 
-    /**
-     * Stores the maximum values of true pareto front.
-     */
-    VectorOfDouble maximumValue ;
-
-    /**
-     * Stores the minimum values of the true pareto front.
-     */
-    VectorOfDouble minimumValue ;
-
-    /**
-     * Stores the normalized front.
-     */
-    std::vector <VectorOfDouble > normalizedFront ;
 
-    /**
-     * Stores the normalized true Pareto front.
-     */
-    std::vector <VectorOfDouble > normalizedParetoFront ;
+/** Calculates the Spread metric of two contiguous fronts.
+ *  @param front The front.
+ *  @param trueParetoFront The true pareto front.
+ */
+double Spread::spread(const FrontBuffer & front,
+                      const FrontBuffer & trueParetoFront)
+{
+    int m = trueParetoFront.getNumberOfObjectives();
 
     // STEP 1. Obtain the maximum and minimum values of the Pareto front
-    maximumValue = utils_->getMaximumValues(trueParetoFront, numberOfObjectives);
-    minimumValue = utils_->getMinimumValues(trueParetoFront, numberOfObjectives);
-
-    // STEP 2. Get the normalized front and true Pareto fronts
-    normalizedFront = utils_->getNormalizedFront(front,
-                      maximumValue,
-                      minimumValue);
-    normalizedParetoFront = utils_->getNormalizedFront(trueParetoFront,
-                            maximumValue,
-                            minimumValue);
-
-    // STEP 3. Sort normalizedFront and normalizedParetoFront;
-    sort(normalizedFront.begin(), normalizedFront.end(), Spread::compareFront);
-    sort(normalizedParetoFront.begin(), normalizedParetoFront.end(), Spread::compareFront);
+    VectorOfDouble maximumValue(m);
+    VectorOfDouble minimumValue(m);
+    trueParetoFront.getMaximumValues(maximumValue.data());
+    trueParetoFront.getMinimumValues(minimumValue.data());
+
+    // STEP 2. Get the normalized front. Of the true Pareto front only its
+    // first and last points in lexicographical order are needed
+    normalizedFront_ = front;
+    normalizedFront_.normalize(minimumValue.data(), maximumValue.data());
+
+    VectorOfDouble point(m);
+    VectorOfDouble firstParetoPoint(m);
+    VectorOfDouble lastParetoPoint(m);
+    for (int i = 0; i < trueParetoFront.size(); i++)
+    {
+        const double * row = trueParetoFront.row(i);
+        for (int k = 0; k < m; k++)
+        {
+            point[k] = (row[k] - minimumValue[k]) / (maximumValue[k] - minimumValue[k]);
+        }
+        if ((i == 0) || lexicographicLess(point.data(), firstParetoPoint.data(), m))
+        {
+            firstParetoPoint = point;
+        }
+        if ((i == 0) || lexicographicLess(lastParetoPoint.data(), point.data(), m))
+        {
+            lastParetoPoint = point;
+        }
+    }
 
-    int numberOfPoints = normalizedFront.size();
-    // int numberOfTruePoints = normalizedParetoFront.length;
+    // STEP 3. Sort normalizedFront (through an index array)
+    int numberOfPoints = normalizedFront_.size();
+    order_.resize(numberOfPoints);
+    for (int i = 0; i < numberOfPoints; i++)
+    {
+        order_[i] = i;
+    }
+    const FrontBuffer & normalized = normalizedFront_;
+    std::sort(order_.begin(), order_.end(), [&normalized, m](int i, int j)
+    {
+        return lexicographicLess(normalized.row(i), normalized.row(j), m);
+    });
 
     // STEP 4. Compute df and dl (See specifications in Deb's description of
     // the metric)
-    double df = utils_->distance(normalizedFront[0],normalizedParetoFront[0]);
-    double dl = utils_->distance(normalizedFront[normalizedFront.size()-1],
-                                 normalizedParetoFront[normalizedParetoFront.size()-1]);
+    double df = distance(normalized.row(order_[0]), firstParetoPoint.data(), m);
+    double dl = distance(normalized.row(order_[numberOfPoints - 1]),
+                         lastParetoPoint.data(), m);
 
     double mean = 0.0;
     double diversitySum = df + dl;
 
     // STEP 5. Calculate the mean of distances between points i and (i - 1).
     // (the poins are in lexicografical order)
-    for (int i = 0; i < (normalizedFront.size()-1); i++)
+    for (int i = 0; i < (numberOfPoints - 1); i++)
     {
-        mean += utils_->distance(normalizedFront[i],normalizedFront[i+1]);
+        mean += distance(normalized.row(order_[i]), normalized.row(order_[i+1]), m);
     } // for
 
     mean = mean / (double)(numberOfPoints - 1);
@@ -136,8 +169,8 @@ double Spread::spread(std::vector <VectorOfDouble > front,
     {
         for (int i = 0; i < (numberOfPoints -1); i++)
         {
-            diversitySum += fabs(utils_->distance(normalizedFront[i],
-                                                  normalizedFront[i+1]) - mean);
+            diversitySum += fabs(distance(normalized.row(order_[i]),
+                                          normalized.row(order_[i+1]), m) - mean);
         } // for
         return diversitySum / (df + dl + (numberOfPoints-1)*mean);
     }
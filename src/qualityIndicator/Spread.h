@@ -22,7 +22,7 @@
 #define __SPREAD__
 
 #include <MetricsUtil.h>
-#include <LexicoGraphicalComparator.h>
+#include <FrontBuffer.h>
 #include <vector>
 #include <algorithm>
 
@@ -42,7 +42,8 @@ class Spread
 {
 
 private:
-    static bool compareFront(vector<double> pointOne, vector<double> pointTwo);
+    FrontBuffer normalizedFront_;
+    std::vector<int> order_;
 
 public:
 
@@ -50,8 +51,9 @@ public:
 
     Spread();
     ~Spread();
-    double spread (vector< vector<double> > front,
-                   vector< vector<double> > trueParetoFront, int numberOfObjectives);
+    double spread (const vector< vector<double> > & front,
+                   const vector< vector<double> > & trueParetoFront, int numberOfObjectives);
+    double spread (const FrontBuffer & front, const FrontBuffer & trueParetoFront);
 
 }; // Spread
 
@@ -19,6 +19,10 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <FastHypervolume.h>
+#include <SolutionOrder.h>
+#include <Instrumentation.h>
+#include <HypervolumeEngine.h>
+#include <MonteCarloHypervolume.h>
 
 
 /**
@@ -49,6 +53,17 @@ FastHypervolume::~FastHypervolume()
 {
 } // ~FastHypervolume
 
+
+/**
+ * Selects how the contributions are computed with more than two objectives
+ * @param numberOfSamples The number of samples of a Monte Carlo estimation
+ * (0 = exact)
+ */
+void FastHypervolume::setNumberOfSamples(int numberOfSamples)
+{
+    numberOfSamples_ = numberOfSamples;
+} // setNumberOfSamples
+
 double FastHypervolume::computeHypervolume(SolutionSet* solutionSet)
 {
     double hv = 0.0;
@@ -61,20 +76,17 @@ double FastHypervolume::computeHypervolume(SolutionSet* solutionSet)
         updateReferencePoint(solutionSet);
         if (numberOfObjectives_ == 2)
         {
-            Comparator * comparator =
-                snew ObjectiveComparator(numberOfObjectives_ - 1, true);
-            solutionSet->sort(comparator);
-            delete comparator;
+            solutionSet->sortBy(ObjectiveOrder(numberOfObjectives_ - 1, true));
             hv = get2DHV(solutionSet);
         }
         else
         {
-            /*
-            updateReferencePoint(solutionSet);
-            Front front = new Front(solutionSet.size(), numberOfObjectives_, solutionSet);
-            hv = new WFGHV(numberOfObjectives_, solutionSet.size(), referencePoint_).getHV(front);
-            */
-            cerr << "Fast Hypervolume only works with two objectives for now." << std::endl;
+            std::vector<double> points;
+            std::vector<double> referencePoint;
+            writePoints(solutionSet, points, referencePoint);
+            HypervolumeEngine engine;
+            hv = engine.compute(points.data(), solutionSet->size(),
+                                numberOfObjectives_, referencePoint.data());
         }
     }
 
@@ -139,36 +151,29 @@ double FastHypervolume::get2DHV(SolutionSet * solutionSet)
 
 void FastHypervolume::computeHVContributions(SolutionSet * solutionSet)
 {
+    JMETAL_TIME_PHASE(DENSITY);
+
     double * contributions = snew double[solutionSet->size()];
     double solutionSetHV = 0;
 
     numberOfObjectives_ = solutionSet->get(0)->getNumberOfObjectives();
     referencePoint_ = snew Solution(numberOfObjectives_);
 
-    solutionSetHV = computeHypervolume(solutionSet);
-
-    for (int i = 0; i < solutionSet->size(); i++)
+    if (numberOfObjectives_ == 2)
     {
-        Solution * currentPoint = solutionSet->get(i);
-        solutionSet->remove(i);
-
-        if (numberOfObjectives_ == 2)
+        solutionSetHV = computeHypervolume(solutionSet);
+        for (int i = 0; i < solutionSet->size(); i++)
         {
-            //updateReferencePoint(solutionSet);
-            //solutionSet.sort(new ObjectiveComparator(numberOfObjectives_-1, true));
+            Solution * currentPoint = solutionSet->get(i);
+            solutionSet->remove(i);
             contributions[i] = solutionSetHV - get2DHV(solutionSet);
+            solutionSet->add(i, currentPoint);
         }
-        else
-        {
-            /*
-            Front front = new Front(solutionSet.size(), numberOfObjectives_, solutionSet);
-            double hv =
-              new WFGHV(numberOfObjectives_, solutionSet.size(), referencePoint_).getHV(front);
-            contributions[i] = solutionSetHV - hv;
-            */
-            cerr << "Fast Hypervolume only works with two objectives for now." << std::endl;
-        }
-        solutionSet->add(i, currentPoint);
+    }
+    else
+    {
+        updateReferencePoint(solutionSet);
+        computeContributions(solutionSet, contributions);
     }
 
     for (int i = 0; i < solutionSet->size(); i++)
@@ -179,3 +184,63 @@ void FastHypervolume::computeHVContributions(SolutionSet * solutionSet)
     delete [] contributions;
     delete referencePoint_;
 } // computeHVContributions
+
+
+/**
+ * Copies the objective values of a solution set and the reference point to
+ * contiguous buffers
+ */
+void FastHypervolume::writePoints(SolutionSet * solutionSet,
+                                  std::vector<double> & points,
+                                  std::vector<double> & referencePoint)
+{
+    points.resize(solutionSet->size() * numberOfObjectives_);
+    for (int i = 0; i < solutionSet->size(); i++)
+    {
+        const double * objectives = solutionSet->get(i)->getObjectives();
+        std::copy(objectives, objectives + numberOfObjectives_,
+                  points.begin() + i * numberOfObjectives_);
+    }
+    referencePoint.resize(numberOfObjectives_);
+    for (int j = 0; j < numberOfObjectives_; j++)
+    {
+        referencePoint[j] = referencePoint_->getObjective(j);
+    }
+} // writePoints
+
+
+/**
+ * Computes the contributions with more than two objectives: exactly, by
+ * removing each point in turn, or by Monte Carlo estimation
+ */
+void FastHypervolume::computeContributions(SolutionSet * solutionSet,
+        double * contributions)
+{
+    int size = solutionSet->size();
+    std::vector<double> points;
+    std::vector<double> referencePoint;
+    writePoints(solutionSet, points, referencePoint);
+
+    if (numberOfSamples_ > 0)
+    {
+        MonteCarloHypervolume monteCarlo(numberOfSamples_);
+        monteCarlo.contributions(points.data(), size, numberOfObjectives_,
+                                 referencePoint.data(), contributions);
+        return;
+    }
+
+    HypervolumeEngine engine;
+    double solutionSetHV = engine.compute(points.data(), size,
+                                          numberOfObjectives_, referencePoint.data());
+    std::vector<double> subset((size - 1) * numberOfObjectives_);
+    for (int i = 0; i < size; i++)
+    {
+        std::copy(points.begin(), points.begin() + i * numberOfObjectives_,
+                  subset.begin());
+        std::copy(points.begin() + (i + 1) * numberOfObjectives_, points.end(),
+                  subset.begin() + i * numberOfObjectives_);
+        contributions[i] = solutionSetHV -
+                           engine.compute(subset.data(), size - 1,
+                                          numberOfObjectives_, referencePoint.data());
+    }
+} // computeContributions
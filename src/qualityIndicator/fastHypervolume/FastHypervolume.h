@@ -26,6 +26,7 @@
 //#include <iostream>
 //#include <cstdlib>
 #include <math.h>
+#include <vector>
 
 
 
@@ -37,10 +38,14 @@ private:
     Solution * referencePoint_;
     int numberOfObjectives_;
     double offset_ = 20.0;
+    int numberOfSamples_ = 0;
 
     void updateReferencePoint(SolutionSet * solutionSet);
     double get2DHV(SolutionSet * solutionSet);
     double computeHypervolume(SolutionSet * solutionSet);
+    void writePoints(SolutionSet * solutionSet, std::vector<double> & points,
+                     std::vector<double> & referencePoint);
+    void computeContributions(SolutionSet * solutionSet, double * contributions);
 
     // double computeSolutionHVContribution(SolutionSet * solutionSet,
     //     int solutionIndex, double solutionSetHV);
@@ -51,6 +56,7 @@ public:
     FastHypervolume(double offset);
     ~FastHypervolume();
 
+    void setNumberOfSamples(int numberOfSamples);
 
     void computeHVContributions(SolutionSet * solutionSet);
 
@@ -20,6 +20,7 @@
 
 
 #include <FastHypervolumeArchive.h>
+#include <Hash.h>
 
 
 /**
@@ -45,6 +46,7 @@ FastHypervolumeArchive::FastHypervolumeArchive(int maxSize, int numberOfObjectiv
         referencePoint->setObjective(i, std::numeric_limits<double>::max());
     }
     crowdingDistance_ = snew CrowdingComparator();
+    numberOfSamples_ = 0;
 } // FastHypervolumeArchive
 
 
@@ -78,6 +80,11 @@ bool FastHypervolumeArchive::add(Solution *solution)
     int i = 0;
     Solution *aux; //Store an solution temporally
 
+    // Only a member with the same objective hash can be equal to the new
+    // solution
+    unsigned long long hash = Hash::objectives(solution);
+    bool mayBeEqual = containsHash(hash);
+
     while (i < solutionsList_.size())
     {
         aux = solutionsList_[i];
@@ -90,12 +97,13 @@ bool FastHypervolumeArchive::add(Solution *solution)
         else if (flag == -1)           // A solution in the archive is dominated
         {
             // Remove it from the population
+            eraseHash(aux);
             delete aux;
             solutionsList_.erase(solutionsList_.begin() + i);
         }
         else
         {
-            if (equals->compare(aux,solution)==0)
+            if (mayBeEqual && (equals->compare(aux,solution)==0))
             {
                 // There is an equal solution in the population
                 return false; // Discard the new solution
@@ -106,10 +114,12 @@ bool FastHypervolumeArchive::add(Solution *solution)
     // Insert the solution into the archive
     bool res = true;
     solutionsList_.push_back(solution);
+    objectiveHashes_.insert(hash);
     if (size() > maxSize)   // The archive is full
     {
         computeHVContribution();
         int indexWorst_ = indexWorst(crowdingDistance_);
+        eraseHash(solutionsList_[indexWorst_]);
         if (solution == solutionsList_[indexWorst_])
         {
             res = false;
@@ -132,7 +142,17 @@ void FastHypervolumeArchive::computeHVContribution()
     if (size() > 2)   // The contribution can be updated
     {
         FastHypervolume *fastHV = snew FastHypervolume();
+        fastHV->setNumberOfSamples(numberOfSamples_);
         fastHV->computeHVContributions(this);
         delete fastHV;
     }
 } // computeHVContribution
+
+
+/**
+ * Selects how the contributions are computed with more than two objectives
+ */
+void FastHypervolumeArchive::setNumberOfSamples(int numberOfSamples)
+{
+    numberOfSamples_ = numberOfSamples;
+} // setNumberOfSamples
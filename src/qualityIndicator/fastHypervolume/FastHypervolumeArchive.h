@@ -62,6 +62,12 @@ private:
 
     Solution *referencePoint;
 
+    /**
+     * Stores the number of samples of the Monte Carlo estimation of the
+     * contributions (0 = exact).
+     */
+    int numberOfSamples_;
+
 public:
 
     /**
@@ -94,6 +100,14 @@ public:
      */
     void computeHVContribution();
 
+    /**
+     * Selects how the contributions are computed with more than two
+     * objectives.
+     * @param numberOfSamples The number of samples of a Monte Carlo
+     * estimation (0 = exact).
+     */
+    void setNumberOfSamples(int numberOfSamples);
+
 };
 
 #endif /* __FAST_HYPERVOLUME_ARCHIVE__ */
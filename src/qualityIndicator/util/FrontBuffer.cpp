@@ -0,0 +1,205 @@
+//  FrontBuffer.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <FrontBuffer.h>
+#include <limits>
+
+
+/**
+ * Constructor. Creates an empty front
+ */
+FrontBuffer::FrontBuffer()
+{
+    size_ = 0;
+    numberOfObjectives_ = 0;
+} // FrontBuffer
+
+
+/**
+ * Constructor. Copies a front read with MetricsUtil::readFront
+ * @param front The front
+ */
+FrontBuffer::FrontBuffer(const MatrixOfDouble & front)
+{
+    assign(front);
+} // FrontBuffer
+
+
+/**
+ * Constructor. Copies the objective values of a solution set
+ * @param solutionSet The solution set
+ */
+FrontBuffer::FrontBuffer(SolutionSet * solutionSet)
+{
+    assign(solutionSet);
+} // FrontBuffer
+
+
+/**
+ * Replaces the content of the buffer with a front
+ * @param front The front
+ */
+void FrontBuffer::assign(const MatrixOfDouble & front)
+{
+    size_ = front.size();
+    numberOfObjectives_ = (size_ > 0) ? front[0].size() : 0;
+    data_.resize(size_ * numberOfObjectives_);
+    for (int i = 0; i < size_; i++)
+    {
+        for (int j = 0; j < numberOfObjectives_; j++)
+        {
+            data_[i * numberOfObjectives_ + j] = front[i][j];
+        }
+    }
+} // assign
+
+
+/**
+ * Replaces the content of the buffer with the objective values of a
+ * solution set
+ * @param solutionSet The solution set
+ */
+void FrontBuffer::assign(SolutionSet * solutionSet)
+{
+    size_ = solutionSet->size();
+    numberOfObjectives_ = (size_ > 0) ?
+                          solutionSet->get(0)->getNumberOfObjectives() : 0;
+    data_.resize(size_ * numberOfObjectives_);
+    for (int i = 0; i < size_; i++)
+    {
+        Solution * solution = solutionSet->get(i);
+        for (int j = 0; j < numberOfObjectives_; j++)
+        {
+            data_[i * numberOfObjectives_ + j] = solution->getObjective(j);
+        }
+    }
+} // assign
+
+
+/**
+ * Returns the number of points of the front
+ */
+int FrontBuffer::size() const
+{
+    return size_;
+} // size
+
+
+/**
+ * Returns the number of objectives of the points
+ */
+int FrontBuffer::getNumberOfObjectives() const
+{
+    return numberOfObjectives_;
+} // getNumberOfObjectives
+
+
+/**
+ * Returns the row-major matrix of objective values
+ */
+const double * FrontBuffer::data() const
+{
+    return data_.data();
+} // data
+
+
+/**
+ * Returns the objective values of a point
+ * @param i The index of the point
+ */
+const double * FrontBuffer::row(int i) const
+{
+    return data_.data() + i * numberOfObjectives_;
+} // row
+
+
+double * FrontBuffer::row(int i)
+{
+    return data_.data() + i * numberOfObjectives_;
+} // row
+
+
+/**
+ * Gets the minimum value of every objective
+ * @param minimumValue Array receiving the numberOfObjectives values
+ */
+void FrontBuffer::getMinimumValues(double * minimumValue) const
+{
+    for (int j = 0; j < numberOfObjectives_; j++)
+    {
+        minimumValue[j] = std::numeric_limits<double>::max();
+    }
+    for (int i = 0; i < size_; i++)
+    {
+        const double * point = row(i);
+        for (int j = 0; j < numberOfObjectives_; j++)
+        {
+            if (point[j] < minimumValue[j])
+            {
+                minimumValue[j] = point[j];
+            }
+        }
+    }
+} // getMinimumValues
+
+
+/**
+ * Gets the maximum value of every objective
+ * @param maximumValue Array receiving the numberOfObjectives values
+ */
+void FrontBuffer::getMaximumValues(double * maximumValue) const
+{
+    for (int j = 0; j < numberOfObjectives_; j++)
+    {
+        maximumValue[j] = -std::numeric_limits<double>::max();
+    }
+    for (int i = 0; i < size_; i++)
+    {
+        const double * point = row(i);
+        for (int j = 0; j < numberOfObjectives_; j++)
+        {
+            if (point[j] > maximumValue[j])
+            {
+                maximumValue[j] = point[j];
+            }
+        }
+    }
+} // getMaximumValues
+
+
+/**
+ * Normalizes the front in place to [0,1] using the given bounds, as
+ * MetricsUtil::getNormalizedFront does
+ * @param minimumValue The minimum value of every objective
+ * @param maximumValue The maximum value of every objective
+ */
+void FrontBuffer::normalize(const double * minimumValue,
+                            const double * maximumValue)
+{
+    for (int i = 0; i < size_; i++)
+    {
+        double * point = row(i);
+        for (int j = 0; j < numberOfObjectives_; j++)
+        {
+            point[j] = (point[j] - minimumValue[j]) /
+                       (maximumValue[j] - minimumValue[j]);
+        }
+    }
+} // normalize
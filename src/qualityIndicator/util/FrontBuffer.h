@@ -0,0 +1,64 @@
+//  FrontBuffer.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __FRONT_BUFFER__
+#define __FRONT_BUFFER__
+
+#include "JMetalHeader.h"
+#include <SolutionSet.h>
+#include <vector>
+
+using namespace JMetal;
+
+/**
+ * This class stores a front as a contiguous row-major matrix of objective
+ * values, which is the layout used by the indicator kernels. A front that is
+ * used many times (e.g. the true Pareto front) can be loaded and normalized
+ * once and then reused.
+ */
+class FrontBuffer
+{
+
+private:
+    int size_;
+    int numberOfObjectives_;
+    std::vector<double> data_;
+
+public:
+    FrontBuffer();
+    FrontBuffer(const MatrixOfDouble & front);
+    FrontBuffer(SolutionSet * solutionSet);
+
+    void assign(const MatrixOfDouble & front);
+    void assign(SolutionSet * solutionSet);
+
+    int size() const;
+    int getNumberOfObjectives() const;
+    const double * data() const;
+    const double * row(int i) const;
+    double * row(int i);
+
+    void getMinimumValues(double * minimumValue) const;
+    void getMaximumValues(double * maximumValue) const;
+    void normalize(const double * minimumValue, const double * maximumValue);
+
+}; // FrontBuffer
+
+#endif /* __FRONT_BUFFER__ */
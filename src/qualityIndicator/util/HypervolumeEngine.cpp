@@ -0,0 +1,548 @@
+//  HypervolumeEngine.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <HypervolumeEngine.h>
+#include <algorithm>
+#include <map>
+
+namespace
+{
+
+/**
+ * Returns true if 'point1' is not worse than 'point2' in any of the first
+ * 'numberOfObjectives' objectives
+ */
+inline bool weaklyDominates(const double * point1, const double * point2,
+                            int numberOfObjectives)
+{
+    for (int i = 0; i < numberOfObjectives; i++)
+    {
+        if (point1[i] > point2[i])
+        {
+            return false;
+        }
+    }
+    return true;
+} // weaklyDominates
+
+
+/**
+ * Removes from a contiguous front the points weakly dominated by another one,
+ * keeping a single copy of repeated points. Returns the new size
+ */
+int filterNondominated(double * points, int n, int m)
+{
+    int size = 0;
+    for (int i = 0; i < n; i++)
+    {
+        const double * candidate = points + i * m;
+        bool dominated = false;
+        int kept = 0;
+        for (int j = 0; j < size; j++)
+        {
+            double * point = points + j * m;
+            if (weaklyDominates(point, candidate, m))
+            {
+                dominated = true;
+                break;
+            }
+            if (!weaklyDominates(candidate, point, m))
+            {
+                if (kept != j)
+                {
+                    std::copy(point, point + m, points + kept * m);
+                }
+                kept++;
+            }
+        }
+        if (dominated)
+        {
+            continue;
+        }
+        if (kept != i)
+        {
+            std::copy(candidate, candidate + m, points + kept * m);
+        }
+        size = kept + 1;
+    }
+    return size;
+} // filterNondominated
+
+} // namespace
+
+
+/**
+ * Constructor
+ * Creates a new instance of HypervolumeEngine
+ */
+HypervolumeEngine::HypervolumeEngine()
+{
+    pool_ = nullptr;
+} // HypervolumeEngine
+
+
+/**
+ * Destructor
+ */
+HypervolumeEngine::~HypervolumeEngine()
+{
+    delete pool_;
+} // ~HypervolumeEngine
+
+
+/**
+ * Sets the number of threads used to compute the slices of large fronts with
+ * four or more objectives
+ * @param numberOfThreads The number of threads (1 = sequential)
+ */
+void HypervolumeEngine::setNumberOfThreads(int numberOfThreads)
+{
+    delete pool_;
+    pool_ = nullptr;
+    if (numberOfThreads > 1)
+    {
+        pool_ = snew ThreadPool(numberOfThreads);
+    }
+} // setNumberOfThreads
+
+
+/**
+ * Returns the hypervolume of a front (minimization)
+ * @param points The front, as a contiguous row-major n x m matrix
+ * @param n Number of points
+ * @param m Number of objectives
+ * @param referencePoint The reference point
+ */
+double HypervolumeEngine::compute(const double * points, int n, int m,
+                                  const double * referencePoint)
+{
+    prepare(m, referencePoint);
+
+    // Only the points strictly dominating the reference point contribute
+    std::vector<double> & front = limit_[0];
+    front.resize(static_cast<size_t>(n) * m);
+    int size = 0;
+    for (int i = 0; i < n; i++)
+    {
+        const double * point = points + static_cast<size_t>(i) * m;
+        int j = 0;
+        while ((j < m) && (point[j] < referencePoint[j]))
+        {
+            j++;
+        }
+        if (j == m)
+        {
+            std::copy(point, point + m, front.data() + static_cast<size_t>(size) * m);
+            size++;
+        }
+    }
+
+    if ((m < 4) || (pool_ == nullptr) || (size < 64))
+    {
+        return hv(front.data(), size, m);
+    }
+
+    // Parallel slicing: the slices are dealt round robin (later slices are
+    // more expensive) and the partial sums are added in a fixed order
+    sortByObjective(front.data(), size, m, m - 1, sorted_[m]);
+    const double * sorted = sorted_[m].data();
+    int chunks = pool_->getNumberOfThreads() * 4;
+    std::vector<double> partial(chunks, 0.0);
+    pool_->parallelFor(chunks, [this, &partial, sorted, size, m, chunks](int chunk)
+    {
+        HypervolumeEngine engine;
+        engine.referencePoint_ = referencePoint_;
+        engine.sorted_.resize(m + 1);
+        engine.limit_.resize(m + 1);
+        double sum = 0.0;
+        for (int i = chunk; i < size; i += chunks)
+        {
+            sum += engine.slice(sorted, i, m);
+        }
+        partial[chunk] = sum;
+    });
+
+    double volume = 0.0;
+    for (int chunk = 0; chunk < chunks; chunk++)
+    {
+        volume += partial[chunk];
+    }
+    return volume;
+} // compute
+
+
+/**
+ * Returns the exclusive contribution of a point with respect to a front
+ * @param point The point
+ * @param others The front, as a contiguous row-major count x m matrix
+ * @param count Number of points of the front
+ * @param m Number of objectives
+ * @param referencePoint The reference point
+ * @param skip Index of a point of the front to ignore (-1 = none), so that
+ * the contribution of a member of the front is obtained without copying it
+ */
+double HypervolumeEngine::exclusive(const double * point, const double * others,
+                                    int count, int m,
+                                    const double * referencePoint, int skip)
+{
+    prepare(m, referencePoint);
+    return exclusive(point, others, count, m, skip);
+} // exclusive
+
+
+/**
+ * Computes the exclusive contribution of every point of a front
+ * @param points The front, as a contiguous row-major n x m matrix
+ * @param n Number of points
+ * @param m Number of objectives
+ * @param referencePoint The reference point
+ * @param contribution Output array of n values
+ */
+void HypervolumeEngine::contributions(const double * points, int n, int m,
+                                      const double * referencePoint,
+                                      double * contribution)
+{
+    prepare(m, referencePoint);
+    if ((m == 2) && contributions2D(points, n, contribution))
+    {
+        return;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        contribution[i] = exclusive(points + static_cast<size_t>(i) * m, points,
+                                    n, m, i);
+    }
+} // contributions
+
+
+void HypervolumeEngine::prepare(int m, const double * referencePoint)
+{
+    if (static_cast<int>(sorted_.size()) <= m)
+    {
+        sorted_.resize(m + 1);
+        limit_.resize(m + 1);
+    }
+    referencePoint_.assign(referencePoint, referencePoint + m);
+} // prepare
+
+
+double HypervolumeEngine::exclusive(const double * point, const double * others,
+                                    int count, int m, int skip)
+{
+    double inclusive = 1.0;
+    for (int k = 0; k < m; k++)
+    {
+        if (point[k] >= referencePoint_[k])
+        {
+            return 0.0;
+        }
+        inclusive *= referencePoint_[k] - point[k];
+    }
+
+    bounded_.resize(static_cast<size_t>(count) * m);
+    int size = 0;
+    for (int j = 0; j < count; j++)
+    {
+        if (j == skip)
+        {
+            continue;
+        }
+        const double * other = others + static_cast<size_t>(j) * m;
+        double * bounded = bounded_.data() + static_cast<size_t>(size) * m;
+        bool equal = true;
+        bool inside = true;
+        for (int k = 0; k < m; k++)
+        {
+            bounded[k] = std::max(point[k], other[k]);
+            equal = equal && (bounded[k] == point[k]);
+            inside = inside && (bounded[k] < referencePoint_[k]);
+        }
+        if (equal)
+        {
+            // The other point covers the whole box of this one
+            return 0.0;
+        }
+        if (inside)
+        {
+            size++;
+        }
+    }
+
+    size = filterNondominated(bounded_.data(), size, m);
+    return inclusive - hv(bounded_.data(), size, m);
+} // exclusive
+
+
+/**
+ * Computes the contributions of a mutually nondominated 2D front: every point
+ * of the staircase owns the rectangle up to its neighbours. Returns false,
+ * without a result, if some point is weakly dominated by another one
+ */
+bool HypervolumeEngine::contributions2D(const double * points, int n,
+                                        double * contribution)
+{
+    order_.clear();
+    for (int i = 0; i < n; i++)
+    {
+        contribution[i] = 0.0;
+        if ((points[2 * i] < referencePoint_[0]) &&
+                (points[2 * i + 1] < referencePoint_[1]))
+        {
+            order_.push_back(i);
+        }
+    }
+    std::sort(order_.begin(), order_.end(), [points](int a, int b)
+    {
+        return (points[2 * a] < points[2 * b]) ||
+               ((points[2 * a] == points[2 * b]) && (points[2 * a + 1] < points[2 * b + 1]));
+    });
+
+    int size = order_.size();
+    for (int i = 1; i < size; i++)
+    {
+        if (points[2 * order_[i] + 1] >= points[2 * order_[i - 1] + 1])
+        {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < size; i++)
+    {
+        const double * point = points + 2 * order_[i];
+        double right = (i + 1 < size) ? points[2 * order_[i + 1]] : referencePoint_[0];
+        double top = (i > 0) ? points[2 * order_[i - 1] + 1] : referencePoint_[1];
+        contribution[order_[i]] = (right - point[0]) * (top - point[1]);
+    }
+    return true;
+} // contributions2D
+
+
+/**
+ * Dispatches to the algorithm suited to the number of objectives. The points
+ * must strictly dominate the first m components of the reference point
+ */
+double HypervolumeEngine::hv(double * points, int n, int m)
+{
+    if (n == 0)
+    {
+        return 0.0;
+    }
+    switch (m)
+    {
+    case 1:
+        return hv1D(points, n);
+    case 2:
+        return hv2D(points, n, 2);
+    case 3:
+        return hv3D(points, n);
+    default:
+        return wfg(points, n, m);
+    }
+} // hv
+
+
+double HypervolumeEngine::hv1D(const double * points, int n)
+{
+    double minimum = points[0];
+    for (int i = 1; i < n; i++)
+    {
+        minimum = std::min(minimum, points[i]);
+    }
+    return referencePoint_[0] - minimum;
+} // hv1D
+
+
+/**
+ * Sweeps the points in ascending order of the first objective keeping the
+ * lowest second objective seen so far
+ */
+double HypervolumeEngine::hv2D(const double * points, int n, int stride)
+{
+    order_.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        order_[i] = i;
+    }
+    std::sort(order_.begin(), order_.end(), [points, stride](int a, int b)
+    {
+        return points[a * stride] < points[b * stride];
+    });
+
+    double volume = 0.0;
+    double height = referencePoint_[1];
+    for (int i = 0; i < n; i++)
+    {
+        const double * point = points + order_[i] * stride;
+        if (point[1] < height)
+        {
+            volume += (referencePoint_[0] - point[0]) * (height - point[1]);
+            height = point[1];
+        }
+    }
+    return volume;
+} // hv2D
+
+
+/**
+ * Sweeps the points in ascending order of the third objective. The 2D
+ * staircase of the points seen so far is kept in a tree ordered by the first
+ * objective, and its area is updated incrementally as points are inserted
+ */
+double HypervolumeEngine::hv3D(const double * points, int n)
+{
+    order_.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        order_[i] = i;
+    }
+    std::sort(order_.begin(), order_.end(), [points](int a, int b)
+    {
+        return points[a * 3 + 2] < points[b * 3 + 2];
+    });
+
+    std::map<double, double> front;
+    double volume = 0.0;
+    double area = 0.0;
+    double depth = points[order_[0] * 3 + 2];
+    for (int i = 0; i < n; i++)
+    {
+        const double * point = points + order_[i] * 3;
+        volume += area * (point[2] - depth);
+        depth = point[2];
+
+        double x = point[0];
+        double y = point[1];
+        std::map<double, double>::iterator it = front.lower_bound(x);
+        if ((it != front.end()) && (it->first == x) && (it->second <= y))
+        {
+            continue;
+        }
+        double height = referencePoint_[1];
+        if (it != front.begin())
+        {
+            height = std::prev(it)->second;
+            if (height <= y)
+            {
+                continue;
+            }
+        }
+
+        // Remove the points dominated by the new one, adding the area of
+        // the strips between them
+        double left = x;
+        while ((it != front.end()) && (it->second >= y))
+        {
+            area += (it->first - left) * (height - y);
+            left = it->first;
+            height = it->second;
+            it = front.erase(it);
+        }
+        double right = (it != front.end()) ? it->first : referencePoint_[0];
+        area += (right - left) * (height - y);
+        front.emplace_hint(it, x, y);
+    }
+    volume += area * (referencePoint_[2] - depth);
+
+    return volume;
+} // hv3D
+
+
+/**
+ * WFG algorithm. The points are sorted in ascending order of the last
+ * objective, and each one contributes the slice between its value and the
+ * reference point times its exclusive hypervolume, in the remaining
+ * objectives, with respect to the points preceding it
+ */
+double HypervolumeEngine::wfg(double * points, int n, int m)
+{
+    sortByObjective(points, n, m, m - 1, sorted_[m]);
+    const double * sorted = sorted_[m].data();
+
+    double volume = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        volume += slice(sorted, i, m);
+    }
+    return volume;
+} // wfg
+
+
+/**
+ * Returns the volume contributed by the i-th point of a front sorted by the
+ * last objective
+ */
+double HypervolumeEngine::slice(const double * sorted, int i, int m)
+{
+    int d = m - 1;
+    const double * point = sorted + static_cast<size_t>(i) * m;
+
+    std::vector<double> & limit = limit_[m];
+    limit.resize(static_cast<size_t>(i) * d);
+    for (int j = 0; j < i; j++)
+    {
+        const double * other = sorted + static_cast<size_t>(j) * m;
+        double * bounded = limit.data() + static_cast<size_t>(j) * d;
+        bool equal = true;
+        for (int k = 0; k < d; k++)
+        {
+            bounded[k] = std::max(point[k], other[k]);
+            equal = equal && (bounded[k] == point[k]);
+        }
+        if (equal)
+        {
+            // A preceding point covers this one in the first d objectives
+            return 0.0;
+        }
+    }
+
+    double inclusive = 1.0;
+    for (int k = 0; k < d; k++)
+    {
+        inclusive *= referencePoint_[k] - point[k];
+    }
+    int size = filterNondominated(limit.data(), i, d);
+    double exclusive = inclusive - hv(limit.data(), size, d);
+
+    return exclusive * (referencePoint_[d] - point[d]);
+} // slice
+
+
+/**
+ * Copies the points to 'sorted' in ascending order of one objective
+ */
+void HypervolumeEngine::sortByObjective(const double * points, int n, int m,
+                                        int objective, std::vector<double> & sorted)
+{
+    sorted.resize(static_cast<size_t>(n) * m);
+    order_.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        order_[i] = i;
+    }
+    std::sort(order_.begin(), order_.end(), [points, m, objective](int a, int b)
+    {
+        return points[a * m + objective] < points[b * m + objective];
+    });
+    for (int i = 0; i < n; i++)
+    {
+        const double * point = points + static_cast<size_t>(order_[i]) * m;
+        std::copy(point, point + m, sorted.data() + static_cast<size_t>(i) * m);
+    }
+} // sortByObjective
@@ -0,0 +1,89 @@
+//  HypervolumeEngine.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __HYPERVOLUME_ENGINE__
+#define __HYPERVOLUME_ENGINE__
+
+#include "JMetalHeader.h"
+#include <ThreadPool.h>
+#include <vector>
+
+/**
+ * This class computes the exact hypervolume dominated by a set of points
+ * (minimization) and bounded by a reference point. The algorithm depends on
+ * the number of objectives:
+ *  - 2 objectives: sort and sweep, O(n log n).
+ *  - 3 objectives: sweep along the third objective keeping the 2D staircase
+ *    in a balanced tree, O(n log n) (Beume et al., 2009).
+ *  - 4 or more objectives: WFG (While, Bradstreet and Barone, 2012), slicing
+ *    along the last objective and using the 3D sweep as base case.
+ * Points that do not strictly dominate the reference point do not contribute
+ * and are discarded first. With more than one thread the slices of the top
+ * level of WFG are computed concurrently.
+ *
+ * The exclusive contribution of a point (the volume lost when it is removed)
+ * is its own box minus the hypervolume of the limit set of the other points
+ * bounded by it, so it is computed without recomputing the whole front. For
+ * two objectives all the contributions come from a single sweep.
+ */
+class HypervolumeEngine
+{
+
+private:
+    std::vector<double> referencePoint_;
+    ThreadPool * pool_;
+
+    /**
+     * Scratch buffers of every WFG recursion level, indexed by number of
+     * objectives: the sorted points and the limit set
+     */
+    std::vector< std::vector<double> > sorted_;
+    std::vector< std::vector<double> > limit_;
+    std::vector<int> order_;
+    std::vector<double> bounded_; // the limit set of an exclusive contribution
+
+    void prepare(int m, const double * referencePoint);
+    double hv(double * points, int n, int m);
+    bool contributions2D(const double * points, int n, double * contribution);
+    double exclusive(const double * point, const double * others, int count,
+                     int m, int skip);
+    double hv1D(const double * points, int n);
+    double hv2D(const double * points, int n, int stride);
+    double hv3D(const double * points, int n);
+    double wfg(double * points, int n, int m);
+    double slice(const double * sorted, int i, int m);
+    void sortByObjective(const double * points, int n, int m, int objective,
+                         std::vector<double> & sorted);
+
+public:
+    HypervolumeEngine();
+    ~HypervolumeEngine();
+
+    void setNumberOfThreads(int numberOfThreads);
+    double compute(const double * points, int n, int m,
+                   const double * referencePoint);
+    double exclusive(const double * point, const double * others, int count,
+                     int m, const double * referencePoint, int skip);
+    void contributions(const double * points, int n, int m,
+                       const double * referencePoint, double * contribution);
+
+}; // HypervolumeEngine
+
+#endif /* __HYPERVOLUME_ENGINE__ */
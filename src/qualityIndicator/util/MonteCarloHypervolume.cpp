@@ -0,0 +1,241 @@
+//  MonteCarloHypervolume.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <MonteCarloHypervolume.h>
+#include <PseudoRandom.h>
+#include <algorithm>
+#include <cmath>
+
+
+/**
+ * Quantile of the standard normal distribution for 95% confidence
+ */
+static const double CONFIDENCE_QUANTILE = 1.96;
+
+
+/**
+ * Constructor
+ * @param numberOfSamples The number of samples of every estimation
+ */
+MonteCarloHypervolume::MonteCarloHypervolume(int numberOfSamples)
+{
+    numberOfSamples_ = numberOfSamples;
+    error_ = 0.0;
+} // MonteCarloHypervolume
+
+
+void MonteCarloHypervolume::setNumberOfSamples(int numberOfSamples)
+{
+    numberOfSamples_ = numberOfSamples;
+} // setNumberOfSamples
+
+
+int MonteCarloHypervolume::getNumberOfSamples() const
+{
+    return numberOfSamples_;
+} // getNumberOfSamples
+
+
+/**
+ * Returns the half-width of the 95% confidence interval of the last
+ * estimation
+ */
+double MonteCarloHypervolume::getError() const
+{
+    return error_;
+} // getError
+
+
+/**
+ * Stores the points by objective and computes the sampling box. Returns the
+ * volume of the box, or 0 if no point strictly dominates the reference point
+ */
+double MonteCarloHypervolume::prepare(const double * points, int n, int m,
+                                      const double * referencePoint)
+{
+    columns_.resize(static_cast<size_t>(n) * m);
+    lowerBound_.assign(referencePoint, referencePoint + m);
+    sample_.resize(m);
+    dominated_.resize(n);
+
+    bool contributes = false;
+    for (int i = 0; i < n; i++)
+    {
+        const double * point = points + static_cast<size_t>(i) * m;
+        bool inside = true;
+        for (int j = 0; j < m; j++)
+        {
+            columns_[static_cast<size_t>(j) * n + i] = point[j];
+            inside = inside && (point[j] < referencePoint[j]);
+        }
+        if (inside)
+        {
+            contributes = true;
+            for (int j = 0; j < m; j++)
+            {
+                lowerBound_[j] = std::min(lowerBound_[j], point[j]);
+            }
+        }
+    }
+
+    if (!contributes)
+    {
+        return 0.0;
+    }
+    double volume = 1.0;
+    for (int j = 0; j < m; j++)
+    {
+        volume *= referencePoint[j] - lowerBound_[j];
+    }
+    return volume;
+} // prepare
+
+
+/**
+ * Draws a sample and marks in dominated_ the points dominating it. Returns
+ * the number of such points
+ */
+int MonteCarloHypervolume::sampleDominators(int n, int m,
+        const double * referencePoint)
+{
+    for (int j = 0; j < m; j++)
+    {
+        sample_[j] = PseudoRandom::randDouble(lowerBound_[j], referencePoint[j]);
+    }
+
+    unsigned char * dominated = dominated_.data();
+    std::fill(dominated, dominated + n, 1);
+    for (int j = 0; j < m; j++)
+    {
+        const double * column = columns_.data() + static_cast<size_t>(j) * n;
+        double value = sample_[j];
+        for (int i = 0; i < n; i++)
+        {
+            dominated[i] &= (column[i] <= value);
+        }
+    }
+
+    int count = 0;
+    for (int i = 0; i < n; i++)
+    {
+        count += dominated[i];
+    }
+    return count;
+} // sampleDominators
+
+
+/**
+ * Returns an estimation of the hypervolume of a front
+ * @param points The front, as a contiguous row-major n x m matrix
+ * @param n Number of points
+ * @param m Number of objectives
+ * @param referencePoint The reference point
+ */
+double MonteCarloHypervolume::estimate(const double * points, int n, int m,
+                                       const double * referencePoint)
+{
+    error_ = 0.0;
+    double volume = prepare(points, n, m, referencePoint);
+    if ((volume == 0.0) || (numberOfSamples_ <= 0))
+    {
+        return 0.0;
+    }
+
+    int hits = 0;
+    for (int s = 0; s < numberOfSamples_; s++)
+    {
+        if (sampleDominators(n, m, referencePoint) > 0)
+        {
+            hits++;
+        }
+    }
+
+    double ratio = static_cast<double>(hits) / numberOfSamples_;
+    error_ = CONFIDENCE_QUANTILE * volume *
+             std::sqrt(ratio * (1.0 - ratio) / numberOfSamples_);
+    return volume * ratio;
+} // estimate
+
+
+/**
+ * Estimates the exclusive hypervolume contribution of every point
+ * @param contribution Output array of n values
+ */
+void MonteCarloHypervolume::contributions(const double * points, int n, int m,
+        const double * referencePoint, double * contribution)
+{
+    hypeFitness(points, n, m, referencePoint, 1, contribution);
+} // contributions
+
+
+/**
+ * Estimates the HypE fitness of every point. A sample dominated by i <= k
+ * points credits each of them with alpha_i / i, where
+ * alpha_i = prod_{l = 1}^{i - 1} (k - l) / (n - l)
+ * @param k The number of points to be removed
+ * @param fitness Output array of n values
+ */
+void MonteCarloHypervolume::hypeFitness(const double * points, int n, int m,
+                                        const double * referencePoint, int k,
+                                        double * fitness)
+{
+    std::fill(fitness, fitness + n, 0.0);
+    error_ = 0.0;
+    double volume = prepare(points, n, m, referencePoint);
+    if ((volume == 0.0) || (numberOfSamples_ <= 0))
+    {
+        return;
+    }
+
+    k = std::min(k, n);
+    std::vector<double> weight(k + 1, 0.0);
+    double alpha = 1.0;
+    for (int i = 1; i <= k; i++)
+    {
+        weight[i] = alpha / i;
+        alpha *= static_cast<double>(k - i) / (n - i);
+    }
+
+    for (int s = 0; s < numberOfSamples_; s++)
+    {
+        int count = sampleDominators(n, m, referencePoint);
+        if ((count == 0) || (count > k))
+        {
+            continue;
+        }
+        for (int i = 0; i < n; i++)
+        {
+            if (dominated_[i])
+            {
+                fitness[i] += weight[count];
+            }
+        }
+    }
+
+    double largestVariance = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        double ratio = fitness[i] / numberOfSamples_;
+        largestVariance = std::max(largestVariance, ratio * (1.0 - ratio));
+        fitness[i] = volume * ratio;
+    }
+    error_ = CONFIDENCE_QUANTILE * volume *
+             std::sqrt(largestVariance / numberOfSamples_);
+} // hypeFitness
@@ -0,0 +1,74 @@
+//  MonteCarloHypervolume.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __MONTE_CARLO_HYPERVOLUME__
+#define __MONTE_CARLO_HYPERVOLUME__
+
+#include "JMetalHeader.h"
+#include <vector>
+
+/**
+ * This class estimates the hypervolume of a front (minimization) by Monte
+ * Carlo sampling, for numbers of objectives where the exact computation is
+ * too expensive. The samples are drawn uniformly (with PseudoRandom) from
+ * the box bounded by the ideal point of the front and the reference point.
+ * The points are stored by objective, so that a sample is tested against
+ * all of them with branch-free loops the compiler vectorizes.
+ *
+ * Besides the hypervolume, the class estimates the HypE fitness of every
+ * point (Bader and Zitzler, 2011): the expected hypervolume lost when k
+ * random points are removed, credited to each point. With k = 1 the fitness
+ * is the exclusive hypervolume contribution used by SMS-EMOA.
+ *
+ * After each estimation getError() returns the half-width of a 95%
+ * confidence interval (for the fitness, the largest one of all the points).
+ */
+class MonteCarloHypervolume
+{
+
+private:
+    int numberOfSamples_;
+    double error_;
+    std::vector<double> columns_;
+    std::vector<double> lowerBound_;
+    std::vector<double> sample_;
+    std::vector<unsigned char> dominated_;
+
+    double prepare(const double * points, int n, int m,
+                   const double * referencePoint);
+    int sampleDominators(int n, int m, const double * referencePoint);
+
+public:
+    MonteCarloHypervolume(int numberOfSamples);
+
+    void setNumberOfSamples(int numberOfSamples);
+    int getNumberOfSamples() const;
+    double getError() const;
+
+    double estimate(const double * points, int n, int m,
+                    const double * referencePoint);
+    void contributions(const double * points, int n, int m,
+                       const double * referencePoint, double * contribution);
+    void hypeFitness(const double * points, int n, int m,
+                     const double * referencePoint, int k, double * fitness);
+
+}; // MonteCarloHypervolume
+
+#endif /* __MONTE_CARLO_HYPERVOLUME__ */
@@ -35,71 +35,119 @@ AdaptiveRandomNeighborhood::AdaptiveRandomNeighborhood(SolutionSet * solutionSet
 {
     solutionSet_ = solutionSet;
     numberOfRandomNeighbours_ = numberOfRandomNeighbours;
-    //problem_ = solutionSet_->get(0)->getProblem() ;
 
-    //list_ = snew int * [solutionSet_->size()];
+    build();
 
+    std::cout << "L:" << std::endl;
     for (int i = 0; i < solutionSet_->size(); i++)
     {
-        //list_[i] = snew int []
-        VectorOfInteger list_i;
-        list_i.push_back(i);
-        list_.push_back(list_i);
-    }
-
-//  if(std::find(v.begin(), v.end(), x) != v.end()) {
-//      /* v contains x */
-//  } else {
-//      /* v does not contain x */
-//  }
-
-    //std::cout << "list: " << list_ << std::endl;
-    for (int i = 0; i < solutionSet_->size(); i++)
-    {
-        //list_.at(i).push_back(i);
-        for (int j = 0; j < numberOfRandomNeighbours_; j++)
+        std::cout << "\t[";
+        for (int j = offsets_[i]; j < offsets_[i + 1]; j++)
         {
-            int random = PseudoRandom::randInt(0, solutionSet_->size() - 1);
-            //std::cout << "i: " << i >> " random: " << random << " listb: " << list_at(random) << std::endl;
-            //if (!list_.at(random).contains((Integer) i))
-            if (find(list_.at(random).begin(), list_.at(random).end(), i) == list_.at(random).end())
+            std::cout << neighbors_[j];
+            if (j < offsets_[i + 1] - 1)
             {
-                list_.at(random).push_back(i);
+                std::cout << ",";
+            }
+            else
+            {
+                std::cout << "]" << std::endl;
             }
         }
     }
-    //std::cout <<  "L: " << list_ << std::endl;
-    std::cout << "L:" << std::endl;
-    for (int i = 0; i < list_.size(); i++)
+}
+
+
+/**
+ * Draws a new random topology. Every particle informs itself and
+ * numberOfRandomNeighbours_ random particles; the list of particle i holds i
+ * first and then the particles informing it, in increasing order and without
+ * repetitions.
+ */
+void AdaptiveRandomNeighborhood::build()
+{
+    int size = solutionSet_->size();
+
+    targets_.resize(size * numberOfRandomNeighbours_);
+    offsets_.assign(size + 1, 0);
+    cursor_.assign(size, -1);
+
+    // The random draws keep the order of the original list-based algorithm.
+    // cursor_ holds the last particle added to each list, so a repeated
+    // (random, i) pair is detected without searching the list
+    for (int i = 0; i < size; i++)
     {
-        std::cout << "\t[";
-        for (int j = 0; j < list_.at(i).size(); j++)
+        offsets_[i + 1]++;
+        for (int j = 0; j < numberOfRandomNeighbours_; j++)
         {
-            std::cout << list_.at(i).at(j);
-            if (j < list_.at(i).size()-1)
+            int random = PseudoRandom::randInt(0, size - 1);
+            if ((random != i) && (cursor_[random] != i))
             {
-                std::cout << ",";
+                cursor_[random] = i;
+                offsets_[random + 1]++;
+                targets_[i * numberOfRandomNeighbours_ + j] = random;
             }
             else
             {
-                std::cout << "]" << std::endl;
+                targets_[i * numberOfRandomNeighbours_ + j] = -1;
             }
         }
     }
-}
+
+    for (int i = 0; i < size; i++)
+    {
+        offsets_[i + 1] += offsets_[i];
+    }
+
+    neighbors_.resize(offsets_[size]);
+    for (int i = 0; i < size; i++)
+    {
+        cursor_[i] = offsets_[i];
+        neighbors_[cursor_[i]++] = i;
+    }
+    for (int k = 0; k < targets_.size(); k++)
+    {
+        if (targets_[k] >= 0)
+        {
+            neighbors_[cursor_[targets_[k]]++] = k / numberOfRandomNeighbours_;
+        }
+    }
+} // build
 
 
 VectorOfInteger AdaptiveRandomNeighborhood::getNeighbors(int i)
 {
-    if (i > list_.size())
+    return VectorOfInteger(getNeighborIndices(i),
+                           getNeighborIndices(i) + getNumberOfNeighbors(i));
+}
+
+
+/**
+ * Returns the neighbours of a particle without copying them
+ * @param i The particle
+ * @return A pointer to the getNumberOfNeighbors(i) indices
+ */
+const int * AdaptiveRandomNeighborhood::getNeighborIndices(int i)
+{
+    if ((i < 0) || (i >= solutionSet_->size()))
     {
         cerr << "Error in AdaptiveRandomNeighborhood.getNeighbors"
-             << "the parameter " << i << " is less than " << list_.size()
+             << "the parameter " << i << " is less than " << solutionSet_->size()
              << std::endl;
         exit(-1);
     }
-    return list_.at(i);
-}
+    return neighbors_.data() + offsets_[i];
+} // getNeighborIndices
+
+
+/**
+ * Returns the number of neighbours of a particle, itself included
+ * @param i The particle
+ */
+int AdaptiveRandomNeighborhood::getNumberOfNeighbors(int i)
+{
+    return offsets_[i + 1] - offsets_[i];
+} // getNumberOfNeighbors
 
 
 int AdaptiveRandomNeighborhood::getNumberOfRandomNeighbours()
@@ -111,14 +159,14 @@ int AdaptiveRandomNeighborhood::getNumberOfRandomNeighbours()
 SolutionSet * AdaptiveRandomNeighborhood::getBestFitnessSolutionInNeighborhood(Comparator * comparator)
 {
     SolutionSet * result = snew SolutionSet();
-    for (int i = 0; i < list_.size(); i++)
+    for (int i = 0; i < solutionSet_->size(); i++)
     {
-        Solution * bestSolution = solutionSet_->get(list_.at(i).at(0));
-        for (int j = 1; j < list_.at(i).size(); j++)
+        Solution * bestSolution = solutionSet_->get(neighbors_[offsets_[i]]);
+        for (int j = offsets_[i] + 1; j < offsets_[i + 1]; j++)
         {
-            if (comparator->compare(bestSolution, solutionSet_->get(list_.at(i).at(j))) > 0)
+            if (comparator->compare(bestSolution, solutionSet_->get(neighbors_[j])) > 0)
             {
-                bestSolution = solutionSet_->get(list_.at(i).at(j));
+                bestSolution = solutionSet_->get(neighbors_[j]);
             }
         }
         result->add(bestSolution);
@@ -130,35 +178,18 @@ SolutionSet * AdaptiveRandomNeighborhood::getBestFitnessSolutionInNeighborhood(C
 
 MatrixOfInteger AdaptiveRandomNeighborhood::getNeighborhood()
 {
-    return list_;
-}
-
-
-void AdaptiveRandomNeighborhood::recompute()
-{
-    list_.clear();
-
+    MatrixOfInteger list;
     for (int i = 0; i < solutionSet_->size(); i++)
     {
-        //list_[i] = snew int []
-        VectorOfInteger list_i;
-        list_i.push_back(i);
-        list_.push_back(list_i);
+        list.push_back(getNeighbors(i));
     }
+    return list;
+}
 
-    for (int i = 0; i < solutionSet_->size(); i++)
-    {
-        for (int j = 0; j < numberOfRandomNeighbours_; j++)
-        {
-            int random = PseudoRandom::randInt(0, solutionSet_->size() - 1);
-            //if (!list_.at(random).contains((Integer) i))
-            if (find(list_.at(random).begin(), list_.at(random).end(), i) == list_.at(random).end())
-            {
-                list_.at(random).push_back(i);
-            }
-        }
-    }
 
+void AdaptiveRandomNeighborhood::recompute()
+{
+    build();
 }
 
 
@@ -26,19 +26,31 @@
 #include <SolutionSet.h>
 #include <PseudoRandom.h>
 #include <algorithm>
+#include <vector>
 
 /**
  * Class representing an adaptive random neighborhood
+ *
+ * The neighbour lists are stored in compressed sparse row form: the
+ * neighbours of particle i are neighbors_[offsets_[i]] to
+ * neighbors_[offsets_[i+1]-1]. The buffers are reused when the topology is
+ * recomputed.
  */
 class AdaptiveRandomNeighborhood
 {
 protected:
     SolutionSet * solutionSet_ = nullptr;
-	MatrixOfInteger list_;
+    std::vector<int> offsets_;
+    std::vector<int> neighbors_;
+    std::vector<int> targets_;
+    std::vector<int> cursor_;
     int numberOfRandomNeighbours_;
+    void build();
 public:
     AdaptiveRandomNeighborhood(SolutionSet * solutionSet, int numberOfRandomNeighbours);
     VectorOfInteger getNeighbors(int i);
+    const int * getNeighborIndices(int i);
+    int getNumberOfNeighbors(int i);
     int getNumberOfRandomNeighbours();
     SolutionSet * getBestFitnessSolutionInNeighborhood(Comparator * comparator);
     MatrixOfInteger getNeighborhood();
@@ -0,0 +1,445 @@
+//  Checkpoint.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Checkpoint.h>
+#include <ArrayReal.h>
+#include <Binary.h>
+#include <BinaryReal.h>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+
+/**
+ * Kinds of decision variables stored in a snapshot
+ */
+enum { VALUE = 0, ARRAY = 1, BITS = 2, BITS_AND_VALUE = 3 };
+
+
+/**
+ * Constructor
+ * Creates an empty snapshot
+ */
+Checkpoint::Checkpoint()
+{
+    position_ = 0;
+} // Checkpoint
+
+
+/**
+ * Removes the contents of the snapshot
+ */
+void Checkpoint::clear()
+{
+    data_.clear();
+    position_ = 0;
+} // clear
+
+
+/**
+ * Returns the number of bytes of the snapshot
+ */
+size_t Checkpoint::size()
+{
+    return data_.size();
+} // size
+
+
+/**
+ * Exchanges the contents of two snapshots
+ */
+void Checkpoint::swap(Checkpoint & another)
+{
+    data_.swap(another.data_);
+    std::swap(position_, another.position_);
+} // swap
+
+
+/**
+ * Writes the snapshot to a file. It is first written to a temporary file,
+ * which then replaces the file, so a crash never leaves a partial snapshot
+ * @param path The file
+ * @return false if the file could not be written
+ */
+bool Checkpoint::save(std::string path)
+{
+    std::string temporary = path + ".tmp";
+    FILE * file = fopen(temporary.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool written = (fwrite(data_.data(), 1, data_.size(), file) == data_.size());
+    written = (fflush(file) == 0) && written;
+    written = (fsync(fileno(file)) == 0) && written;
+    written = (fclose(file) == 0) && written;
+    return written && (rename(temporary.c_str(), path.c_str()) == 0);
+} // save
+
+
+/**
+ * Reads a snapshot from a file
+ * @param path The file
+ * @return false if the file could not be read
+ */
+bool Checkpoint::load(std::string path)
+{
+    clear();
+    FILE * file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    char buffer[65536];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        data_.insert(data_.end(), buffer, buffer + size);
+    }
+    bool read = (ferror(file) == 0);
+    fclose(file);
+    return read;
+} // load
+
+
+void Checkpoint::writeInt(int value)
+{
+    write(&value, sizeof(value));
+} // writeInt
+
+
+void Checkpoint::writeLong(long long value)
+{
+    write(&value, sizeof(value));
+} // writeLong
+
+
+void Checkpoint::writeDouble(double value)
+{
+    write(&value, sizeof(value));
+} // writeDouble
+
+
+void Checkpoint::writeDoubles(const double * values, int size)
+{
+    write(values, size * sizeof(double));
+} // writeDoubles
+
+
+void Checkpoint::writeInts(const int * values, int size)
+{
+    write(values, size * sizeof(int));
+} // writeInts
+
+
+void Checkpoint::writeString(std::string value)
+{
+    writeInt(value.size());
+    write(value.data(), value.size());
+} // writeString
+
+
+/**
+ * Writes a solution
+ */
+void Checkpoint::writeSolution(Solution * solution)
+{
+    int numberOfVariables = solution->getNumberOfVariables();
+    writeInt(numberOfVariables);
+    for (int i = 0; i < numberOfVariables; i++)
+    {
+        writeVariable(solution->getDecisionVariables()[i]);
+    }
+    writeInt(solution->getNumberOfObjectives());
+    writeDoubles(solution->getObjectives(), solution->getNumberOfObjectives());
+    writeDouble(solution->getOverallConstraintViolation());
+    writeInt(solution->getNumberOfViolatedConstraints());
+    writeInt(solution->getRank());
+    writeDouble(solution->getCrowdingDistance());
+    writeDouble(solution->getFitness());
+} // writeSolution
+
+
+/**
+ * Writes the solutions of a set
+ */
+void Checkpoint::writeSolutionSet(SolutionSet * solutionSet)
+{
+    writeInt(solutionSet->size());
+    for (int i = 0; i < solutionSet->size(); i++)
+    {
+        writeSolution(solutionSet->get(i));
+    }
+} // writeSolutionSet
+
+
+/**
+ * Writes the state of a random generator
+ */
+void Checkpoint::writeRandomGenerator(RandomGenerator * generator)
+{
+    writeDouble(generator->seed_);
+    writeDoubles(generator->oldrand_, 55);
+    writeInt(generator->jrand_);
+} // writeRandomGenerator
+
+
+int Checkpoint::readInt()
+{
+    int value;
+    read(&value, sizeof(value));
+    return value;
+} // readInt
+
+
+long long Checkpoint::readLong()
+{
+    long long value;
+    read(&value, sizeof(value));
+    return value;
+} // readLong
+
+
+double Checkpoint::readDouble()
+{
+    double value;
+    read(&value, sizeof(value));
+    return value;
+} // readDouble
+
+
+void Checkpoint::readDoubles(double * values, int size)
+{
+    read(values, size * sizeof(double));
+} // readDoubles
+
+
+void Checkpoint::readInts(int * values, int size)
+{
+    read(values, size * sizeof(int));
+} // readInts
+
+
+std::string Checkpoint::readString()
+{
+    int size = readInt();
+    std::string value(size, ' ');
+    read(&value[0], size);
+    return value;
+} // readString
+
+
+/**
+ * Reads a solution
+ * @param problem The problem the solution belongs to
+ * @return A new solution
+ */
+Solution * Checkpoint::readSolution(Problem * problem)
+{
+    Solution * solution = snew Solution(problem);
+    int numberOfVariables = readInt();
+    if (numberOfVariables != solution->getNumberOfVariables())
+    {
+        std::cout << "Checkpoint: a solution of " << problem->getName()
+                  << " has " << numberOfVariables << " variables" << std::endl;
+        exit(-1);
+    }
+    for (int i = 0; i < numberOfVariables; i++)
+    {
+        readVariable(solution->getDecisionVariables()[i]);
+    }
+    int numberOfObjectives = readInt();
+    if (numberOfObjectives != solution->getNumberOfObjectives())
+    {
+        std::cout << "Checkpoint: a solution of " << problem->getName()
+                  << " has " << numberOfObjectives << " objectives" << std::endl;
+        exit(-1);
+    }
+    for (int i = 0; i < numberOfObjectives; i++)
+    {
+        solution->setObjective(i, readDouble());
+    }
+    solution->setOverallConstraintViolation(readDouble());
+    solution->setNumberOfViolatedConstraints(readInt());
+    solution->setRank(readInt());
+    solution->setCrowdingDistance(readDouble());
+    solution->setFitness(readDouble());
+    return solution;
+} // readSolution
+
+
+/**
+ * Reads solutions and adds them to a set
+ * @param solutionSet The set
+ * @param problem The problem the solutions belong to
+ */
+void Checkpoint::readSolutionSet(SolutionSet * solutionSet, Problem * problem)
+{
+    int size = readInt();
+    for (int i = 0; i < size; i++)
+    {
+        solutionSet->add(readSolution(problem));
+    }
+} // readSolutionSet
+
+
+/**
+ * Restores the state of a random generator
+ */
+void Checkpoint::readRandomGenerator(RandomGenerator * generator)
+{
+    generator->seed_ = readDouble();
+    readDoubles(generator->oldrand_, 55);
+    generator->jrand_ = readInt();
+} // readRandomGenerator
+
+
+/**
+ * Appends bytes to the snapshot
+ */
+void Checkpoint::write(const void * values, size_t size)
+{
+    const char * bytes = (const char *) values;
+    data_.insert(data_.end(), bytes, bytes + size);
+} // write
+
+
+/**
+ * Reads the next bytes of the snapshot
+ */
+void Checkpoint::read(void * values, size_t size)
+{
+    if (position_ + size > data_.size())
+    {
+        std::cout << "Checkpoint: the snapshot is truncated" << std::endl;
+        exit(-1);
+    }
+    memcpy(values, data_.data() + position_, size);
+    position_ += size;
+} // read
+
+
+/**
+ * Writes a decision variable
+ */
+void Checkpoint::writeVariable(Variable * variable)
+{
+    ArrayReal * array = dynamic_cast<ArrayReal *>(variable);
+    Binary * binary = dynamic_cast<Binary *>(variable);
+    if (array != nullptr)
+    {
+        writeInt(ARRAY);
+        writeInt(array->getLength());
+        for (int i = 0; i < array->getLength(); i++)
+        {
+            writeDouble(array->getValue(i));
+        }
+    }
+    else if (binary != nullptr)
+    {
+        bool real = (dynamic_cast<BinaryReal *>(variable) != nullptr);
+        writeInt(real ? BITS_AND_VALUE : BITS);
+        int numberOfBits = binary->getNumberOfBits();
+        std::vector<unsigned char> bytes((numberOfBits + 7) / 8, 0);
+        for (int i = 0; i < numberOfBits; i++)
+        {
+            bytes[i / 8] |= binary->getIth(i) << (i % 8);
+        }
+        writeInt(numberOfBits);
+        write(bytes.data(), bytes.size());
+        if (real)
+        {
+            writeDouble(variable->getValue());
+        }
+    }
+    else
+    {
+        writeInt(VALUE);
+        writeDouble(variable->getValue());
+    }
+} // writeVariable
+
+
+/**
+ * Reads a decision variable. The stored variable must be of the same kind
+ * and size as <code>variable</code>
+ */
+void Checkpoint::readVariable(Variable * variable)
+{
+    ArrayReal * array = dynamic_cast<ArrayReal *>(variable);
+    Binary * binary = dynamic_cast<Binary *>(variable);
+    int expected = VALUE;
+    if (array != nullptr)
+    {
+        expected = ARRAY;
+    }
+    else if (binary != nullptr)
+    {
+        bool real = (dynamic_cast<BinaryReal *>(variable) != nullptr);
+        expected = (real ? BITS_AND_VALUE : BITS);
+    }
+
+    int kind = readInt();
+    if (kind != expected)
+    {
+        std::cout << "Checkpoint: a decision variable is of kind " << kind
+                  << " instead of " << expected << std::endl;
+        exit(-1);
+    }
+
+    if (kind == ARRAY)
+    {
+        int length = readInt();
+        if (length != array->getLength())
+        {
+            std::cout << "Checkpoint: an array of " << array->getLength()
+                      << " reals has " << length << " values" << std::endl;
+            exit(-1);
+        }
+        for (int i = 0; i < length; i++)
+        {
+            array->setValue(i, readDouble());
+        }
+    }
+    else if ((kind == BITS) || (kind == BITS_AND_VALUE))
+    {
+        int numberOfBits = readInt();
+        if (numberOfBits != binary->getNumberOfBits())
+        {
+            std::cout << "Checkpoint: a variable of " << binary->getNumberOfBits()
+                      << " bits has " << numberOfBits << " bits" << std::endl;
+            exit(-1);
+        }
+        std::vector<unsigned char> bytes((numberOfBits + 7) / 8);
+        read(bytes.data(), bytes.size());
+        for (int i = 0; i < numberOfBits; i++)
+        {
+            binary->setIth(i, (bytes[i / 8] >> (i % 8)) & 1);
+        }
+        if (kind == BITS_AND_VALUE)
+        {
+            variable->setValue(readDouble());
+        }
+    }
+    else
+    {
+        variable->setValue(readDouble());
+    }
+} // readVariable
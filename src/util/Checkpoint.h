@@ -0,0 +1,87 @@
+//  Checkpoint.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __CHECKPOINT__
+#define __CHECKPOINT__
+
+#include <Problem.h>
+#include <Solution.h>
+#include <SolutionSet.h>
+#include <RandomGenerator.h>
+#include <string>
+#include <vector>
+
+/**
+ * This class implements a snapshot of the state of an algorithm in a
+ * compact binary format. Values are appended with the write methods and
+ * read back, in the same order, with the read methods. Numbers are stored
+ * in the native byte order, so a snapshot can only be read on the kind of
+ * machine that wrote it.
+ *
+ * Solutions keep their decision variables (real, array of reals and binary
+ * variables), objectives, constraint violation, rank, crowding distance and
+ * fitness.
+ *
+ * Snapshots are written by <code>Algorithm</code> through a
+ * <code>CheckpointWriter</code>; see <code>Algorithm::endCheckpoint</code>.
+ */
+class Checkpoint
+{
+
+private:
+    std::vector<char> data_;
+    size_t position_;
+
+    void write(const void * values, size_t size);
+    void read(void * values, size_t size);
+    void writeVariable(Variable * variable);
+    void readVariable(Variable * variable);
+
+public:
+    Checkpoint();
+    void clear();
+    size_t size();
+    void swap(Checkpoint & another);
+    bool save(std::string path);
+    bool load(std::string path);
+
+    void writeInt(int value);
+    void writeLong(long long value);
+    void writeDouble(double value);
+    void writeDoubles(const double * values, int size);
+    void writeInts(const int * values, int size);
+    void writeString(std::string value);
+    void writeSolution(Solution * solution);
+    void writeSolutionSet(SolutionSet * solutionSet);
+    void writeRandomGenerator(RandomGenerator * generator);
+
+    int readInt();
+    long long readLong();
+    double readDouble();
+    void readDoubles(double * values, int size);
+    void readInts(int * values, int size);
+    std::string readString();
+    Solution * readSolution(Problem * problem);
+    void readSolutionSet(SolutionSet * solutionSet, Problem * problem);
+    void readRandomGenerator(RandomGenerator * generator);
+
+}; // Checkpoint
+
+#endif
@@ -0,0 +1,110 @@
+//  CheckpointWriter.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <CheckpointWriter.h>
+
+
+/**
+ * Constructor
+ * Starts the writing thread
+ * @param path The file the snapshots are written to
+ */
+CheckpointWriter::CheckpointWriter(std::string path)
+{
+    path_ = path;
+    hasPending_ = false;
+    stop_ = false;
+    written_ = 0;
+    thread_ = std::thread(&CheckpointWriter::work, this);
+} // CheckpointWriter
+
+
+/**
+ * Destructor. Writes the last snapshot submitted and stops the thread
+ */
+CheckpointWriter::~CheckpointWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    ready_.notify_one();
+    thread_.join();
+} // ~CheckpointWriter
+
+
+/**
+ * Hands a snapshot to the writing thread. The contents of the snapshot are
+ * taken without copying them, and it is left empty
+ * @param snapshot The snapshot
+ */
+void CheckpointWriter::submit(Checkpoint & snapshot)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.swap(snapshot);
+        hasPending_ = true;
+    }
+    snapshot.clear();
+    ready_.notify_one();
+} // submit
+
+
+/**
+ * Returns the number of snapshots written so far
+ */
+int CheckpointWriter::getWritten()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return written_;
+} // getWritten
+
+
+/**
+ * Main loop of the writing thread
+ */
+void CheckpointWriter::work()
+{
+    Checkpoint snapshot;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        ready_.wait(lock, [this] { return hasPending_ || stop_; });
+        if (!hasPending_)
+        {
+            return;
+        }
+        snapshot.swap(pending_);
+        hasPending_ = false;
+
+        lock.unlock();
+        bool saved = snapshot.save(path_);
+        lock.lock();
+
+        if (saved)
+        {
+            written_++;
+        }
+        else
+        {
+            std::cout << "CheckpointWriter: unable to write " << path_ << std::endl;
+        }
+    }
+} // work
@@ -0,0 +1,59 @@
+//  CheckpointWriter.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __CHECKPOINT_WRITER__
+#define __CHECKPOINT_WRITER__
+
+#include <Checkpoint.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * This class writes snapshots to a file on a background thread, so that an
+ * algorithm only pays for building them in memory. If a new snapshot is
+ * submitted while the previous one is still being written, only the newest
+ * one is kept. The destructor waits until the last snapshot is written.
+ */
+class CheckpointWriter
+{
+
+private:
+    std::string path_;
+    Checkpoint pending_;
+    bool hasPending_;
+    bool stop_;
+    int written_;
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::thread thread_;
+
+    void work();
+
+public:
+    CheckpointWriter(std::string path);
+    ~CheckpointWriter();
+    void submit(Checkpoint & snapshot);
+    int getWritten();
+
+}; // CheckpointWriter
+
+#endif
@@ -0,0 +1,368 @@
+//  CrowdingTruncation.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#include <CrowdingTruncation.h>
+#include <Instrumentation.h>
+#include <iterator>
+#include <limits>
+#include <unordered_set>
+
+
+/**
+ * Constructor
+ * @param numberOfObjectives The number of objectives of the solutions
+ */
+CrowdingTruncation::CrowdingTruncation(int numberOfObjectives)
+{
+    numberOfObjectives_ = numberOfObjectives;
+    sorted_.resize(numberOfObjectives);
+    nextOrder_ = 0;
+    undefined_ = 0;
+} // CrowdingTruncation
+
+
+/**
+ * Returns the number of solutions in the set
+ */
+int CrowdingTruncation::size()
+{
+    return ids_.size();
+} // size
+
+
+/**
+ * Removes all the solutions from the set. They are not deleted.
+ */
+void CrowdingTruncation::clear()
+{
+    members_.clear();
+    free_.clear();
+    ids_.clear();
+    for (int i = 0; i < numberOfObjectives_; i++)
+    {
+        sorted_[i].clear();
+    }
+    queue_.clear();
+    order_.clear();
+    nextOrder_ = 0;
+    undefined_ = 0;
+} // clear
+
+
+/**
+ * Adds a solution to the set, updating the crowding distances it changes
+ * @param solution The solution
+ */
+void CrowdingTruncation::insert(Solution * solution)
+{
+    int id = place(solution);
+
+    bool bounds = false;
+    for (int i = 0; i < numberOfObjectives_; i++)
+    {
+        Position position = members_[id].position[i];
+        bounds = bounds || (position == sorted_[i].begin()) ||
+                 (std::next(position) == sorted_[i].end());
+    }
+
+    if (bounds)
+    {
+        updateAll();
+        return;
+    }
+
+    update(id);
+    for (int i = 0; i < numberOfObjectives_; i++)
+    {
+        Position position = members_[id].position[i];
+        update(std::prev(position)->second);
+        update(std::next(position)->second);
+    }
+} // insert
+
+
+/**
+ * Removes a solution from the set, updating the crowding distances of its
+ * neighbours. The solution is not deleted.
+ * @param solution The solution
+ */
+void CrowdingTruncation::erase(Solution * solution)
+{
+    std::unordered_map<Solution *, int>::iterator found = ids_.find(solution);
+    if (found == ids_.end())
+    {
+        std::cout << "CrowdingTruncation::erase: the solution is not in the set"
+                  << std::endl;
+        exit(-1);
+    }
+    int id = found->second;
+    Member & member = members_[id];
+
+    if (member.queued)
+    {
+        queue_.erase(Key(member.crowding, member.order));
+    }
+    else
+    {
+        undefined_--;
+    }
+    order_.erase(member.order);
+    ids_.erase(found);
+
+    bool bounds = false;
+    std::vector<int> neighbours;
+    for (int i = 0; i < numberOfObjectives_; i++)
+    {
+        std::map<Key, int> & sorted = sorted_[i];
+        Position position = member.position[i];
+        if ((position == sorted.begin()) || (std::next(position) == sorted.end()))
+        {
+            bounds = true;
+        }
+        else
+        {
+            neighbours.push_back(std::prev(position)->second);
+            neighbours.push_back(std::next(position)->second);
+        }
+        sorted.erase(position);
+    }
+    member.solution = nullptr;
+    free_.push_back(id);
+
+    if (bounds)
+    {
+        updateAll();
+        return;
+    }
+
+    for (int i = 0; i < neighbours.size(); i++)
+    {
+        update(neighbours[i]);
+    }
+} // erase
+
+
+/**
+ * Returns the solution having the lowest crowding distance; among equal
+ * distances, the first one inserted.
+ * @return The solution, or nullptr if the set is empty
+ */
+Solution * CrowdingTruncation::worst()
+{
+    if (ids_.empty())
+    {
+        return nullptr;
+    }
+
+    if (undefined_ == 0)
+    {
+        return members_[queue_.begin()->second].solution;
+    }
+
+    // Some distances are NaN (an objective with a single value), so the
+    // members are scanned in insertion order as SolutionSet::indexWorst does
+    std::map<long, int>::iterator it = order_.begin();
+    int worst = it->second;
+    for (++it; it != order_.end(); ++it)
+    {
+        if (members_[worst].crowding > members_[it->second].crowding)
+        {
+            worst = it->second;
+        }
+    }
+    return members_[worst].solution;
+} // worst
+
+
+/**
+ * Sets the crowding distance of every solution in the set
+ */
+void CrowdingTruncation::assignCrowdingDistances()
+{
+    for (std::unordered_map<Solution *, int>::iterator it = ids_.begin();
+            it != ids_.end(); ++it)
+    {
+        it->first->setCrowdingDistance(members_[it->second].crowding);
+    }
+} // assignCrowdingDistances
+
+
+/**
+ * Reduces a solution set to the given size by removing, one at a time, the
+ * solution with the lowest crowding distance. The removed solutions are
+ * deleted, and the crowding distances of the remaining ones are assigned.
+ * The set is cleared before returning.
+ * @param solutionSet The solution set
+ * @param size The size to reduce it to
+ */
+void CrowdingTruncation::truncate(SolutionSet * solutionSet, int size)
+{
+    JMETAL_TIME_PHASE(DENSITY);
+
+    clear();
+    for (int i = 0; i < solutionSet->size(); i++)
+    {
+        place(solutionSet->get(i));
+    }
+    updateAll();
+
+    std::unordered_set<Solution *> removed;
+    while (this->size() > size)
+    {
+        Solution * solution = worst();
+        erase(solution);
+        removed.insert(solution);
+    }
+    assignCrowdingDistances();
+
+    std::vector<Solution *> kept;
+    kept.reserve(size);
+    for (int i = 0; i < solutionSet->size(); i++)
+    {
+        Solution * solution = solutionSet->get(i);
+        if (removed.count(solution) > 0)
+        {
+            delete solution;
+        }
+        else
+        {
+            kept.push_back(solution);
+        }
+    }
+    solutionSet->clear();
+    for (int i = 0; i < kept.size(); i++)
+    {
+        solutionSet->add(kept[i]);
+    }
+    clear();
+} // truncate
+
+
+/**
+ * Adds a solution to the sorted lists without computing any crowding
+ * distance
+ * @param solution The solution
+ * @return The member holding it
+ */
+int CrowdingTruncation::place(Solution * solution)
+{
+    int id;
+    if (free_.empty())
+    {
+        id = members_.size();
+        members_.push_back(Member());
+    }
+    else
+    {
+        id = free_.back();
+        free_.pop_back();
+    }
+
+    Member & member = members_[id];
+    member.solution = solution;
+    member.order = nextOrder_++;
+    member.crowding = 0.0;
+    member.queued = false;
+    member.position.resize(numberOfObjectives_);
+    ids_[solution] = id;
+    order_[member.order] = id;
+
+    for (int i = 0; i < numberOfObjectives_; i++)
+    {
+        member.position[i] = sorted_[i].insert(std::make_pair(
+                Key(solution->getObjective(i), member.order), id)).first;
+    }
+    return id;
+} // place
+
+
+/**
+ * Computes the crowding distance of a member in the same order of
+ * operations as Distance::crowdingDistanceAssignment
+ * @param id The member
+ * @return The crowding distance
+ */
+double CrowdingTruncation::crowding(int id)
+{
+    double crowding = 0.0;
+    for (int i = 0; i < numberOfObjectives_; i++)
+    {
+        std::map<Key, int> & sorted = sorted_[i];
+        Position position = members_[id].position[i];
+        if ((position == sorted.begin()) || (std::next(position) == sorted.end()))
+        {
+            crowding = std::numeric_limits<double>::max();
+        }
+        else
+        {
+            double distance = std::next(position)->first.first -
+                              std::prev(position)->first.first;
+            distance = distance / (sorted.rbegin()->first.first -
+                                   sorted.begin()->first.first);
+            crowding += distance;
+        }
+    }
+    return crowding;
+} // crowding
+
+
+/**
+ * Recomputes the crowding distance of a member and moves it in the queue
+ * @param id The member
+ */
+void CrowdingTruncation::update(int id)
+{
+    Member & member = members_[id];
+    if (member.queued)
+    {
+        queue_.erase(Key(member.crowding, member.order));
+    }
+    else if (member.crowding != member.crowding)
+    {
+        undefined_--;
+    }
+
+    member.crowding = crowding(id);
+    member.queued = (member.crowding == member.crowding);
+    if (member.queued)
+    {
+        queue_[Key(member.crowding, member.order)] = id;
+    }
+    else
+    {
+        undefined_++;
+    }
+} // update
+
+
+/**
+ * Recomputes the crowding distances of all the members, as needed when the
+ * bounds of an objective change
+ */
+void CrowdingTruncation::updateAll()
+{
+    for (std::unordered_map<Solution *, int>::iterator it = ids_.begin();
+            it != ids_.end(); ++it)
+    {
+        update(it->second);
+    }
+} // updateAll
@@ -0,0 +1,87 @@
+//  CrowdingTruncation.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef __CROWDING_TRUNCATION__
+#define __CROWDING_TRUNCATION__
+
+#include <SolutionSet.h>
+#include <Solution.h>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * This class maintains the crowding distances (as defined in NSGA-II) of a
+ * changing set of solutions. The members are kept sorted by every objective
+ * and in a queue ordered by crowding distance, so inserting or removing a
+ * solution only recomputes the distances of its neighbours, unless it moves
+ * the bounds of an objective.
+ *
+ * The distances are exactly those computed by
+ * <code>Distance::crowdingDistanceAssignment</code>, and ties are broken by
+ * insertion order as <code>SolutionSet::indexWorst</code> breaks them by
+ * position. The objective values of the members must not change while they
+ * are in the set.
+ */
+class CrowdingTruncation
+{
+
+private:
+    typedef std::pair<double, long> Key;
+    typedef std::map<Key, int>::iterator Position;
+
+    struct Member
+    {
+        Solution * solution;
+        long order;
+        double crowding;
+        bool queued;
+        std::vector<Position> position;
+    };
+
+    int numberOfObjectives_;
+    long nextOrder_;
+    std::vector<Member> members_;
+    std::vector<int> free_;
+    std::unordered_map<Solution *, int> ids_;
+    std::vector<std::map<Key, int> > sorted_;
+    std::map<Key, int> queue_;
+    std::map<long, int> order_;
+    int undefined_;
+
+    int place(Solution * solution);
+    double crowding(int id);
+    void update(int id);
+    void updateAll();
+
+public:
+    CrowdingTruncation(int numberOfObjectives);
+    int size();
+    void clear();
+    void insert(Solution * solution);
+    void erase(Solution * solution);
+    Solution * worst();
+    void assignCrowdingDistances();
+    void truncate(SolutionSet * solutionSet, int size);
+
+}; // CrowdingTruncation
+
+#endif
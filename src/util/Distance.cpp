@@ -22,6 +22,9 @@
 
 
 #include <Distance.h>
+#include <Instrumentation.h>
+#include <algorithm>
+#include <vector>
 
 
 /**
@@ -182,6 +185,8 @@ double Distance::distanceBetweenObjectives(Solution * solutionI, Solution * solu
  */
 void Distance::crowdingDistanceAssignment(SolutionSet * solutionSet, int nObjs)
 {
+    JMETAL_TIME_PHASE(DENSITY);
+
     int size = solutionSet->size();
 
     if (size == 0)
@@ -200,15 +205,11 @@ void Distance::crowdingDistanceAssignment(SolutionSet * solutionSet, int nObjs)
         return;
     } // if
 
-    //Use a new SolutionSet to evite alter original solutionSet
-    SolutionSet * front = snew SolutionSet(size);
-    for (int i = 0; i < size; i++)
-    {
-        front->add(solutionSet->get(i));
-    }
-
-    for (int i = 0; i < size; i++)
-        front->get(i)->setCrowdingDistance(0.0);
+    // The objective values are copied to a contiguous array and the
+    // solutions are sorted by index, so the original set is not altered
+    std::vector<double> objective(size);
+    std::vector<double> crowding(size, 0.0);
+    std::vector<int> index(size);
 
     double objetiveMaxn;
     double objetiveMinn;
@@ -217,27 +218,35 @@ void Distance::crowdingDistanceAssignment(SolutionSet * solutionSet, int nObjs)
     for (int i = 0; i<nObjs; i++)
     {
         // Sort the population by Obj n
-        Comparator * c = snew ObjectiveComparator(i);
-        front->sort(c);
-        delete c;
-        objetiveMinn = front->get(0)->getObjective(i);
-        objetiveMaxn = front->get(front->size()-1)->getObjective(i);
+        for (int j = 0; j < size; j++)
+        {
+            objective[j] = solutionSet->get(j)->getObjective(i);
+            index[j] = j;
+        }
+        std::sort(index.begin(), index.end(), [&objective](int one, int two)
+        {
+            return (objective[one] < objective[two]) ||
+                   ((objective[one] == objective[two]) && (one < two));
+        });
+        objetiveMinn = objective[index[0]];
+        objetiveMaxn = objective[index[size-1]];
 
         //Set de crowding distance
-        front->get(0)->setCrowdingDistance(std::numeric_limits<double>::max());
-        front->get(size-1)->setCrowdingDistance(std::numeric_limits<double>::max());
+        crowding[index[0]] = std::numeric_limits<double>::max();
+        crowding[index[size-1]] = std::numeric_limits<double>::max();
 
         for (int j = 1; j < size-1; j++)
         {
-            distance = front->get(j+1)->getObjective(i) - front->get(j-1)->getObjective(i);
+            distance = objective[index[j+1]] - objective[index[j-1]];
             distance = distance / (objetiveMaxn - objetiveMinn);
-            distance += front->get(j)->getCrowdingDistance();
-            front->get(j)->setCrowdingDistance(distance);
+            crowding[index[j]] += distance;
         } // for
     } // for
 
-    front->clear();
-    delete front;
+    for (int i = 0; i < size; i++)
+    {
+        solutionSet->get(i)->setCrowdingDistance(crowding[i]);
+    }
 
 } // crowdingDistanceAssignment
 
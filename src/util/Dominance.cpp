@@ -0,0 +1,280 @@
+//  Dominance.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Dominance.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define JMETAL_DOMINANCE_AVX2
+#include <immintrin.h>
+#endif
+
+
+namespace
+{
+
+/**
+ * Scalar dominance test, with early exit
+ */
+inline int compareScalar(const double * one, const double * two,
+                         int numberOfObjectives)
+{
+    int dominate1 = 0;
+    int dominate2 = 0;
+    for (int i = 0; i < numberOfObjectives; i++)
+    {
+        if (one[i] < two[i])
+        {
+            dominate1 = 1;
+        }
+        else if (one[i] > two[i])
+        {
+            dominate2 = 1;
+        }
+        if (dominate1 & dominate2)
+        {
+            return 0;
+        }
+    }
+
+    if (dominate1 == dominate2)
+    {
+        return 0;
+    }
+    return dominate1 ? -1 : 1;
+}
+
+
+/**
+ * Branchless dominance test of bi-objective points
+ */
+inline int compare2(const double * one, const double * two)
+{
+    int dominate1 = (one[0] < two[0]) | (one[1] < two[1]);
+    int dominate2 = (one[0] > two[0]) | (one[1] > two[1]);
+    return dominate2 - dominate1;
+}
+
+
+#ifdef JMETAL_DOMINANCE_AVX2
+
+/**
+ * AVX2 dominance test: four objectives per instruction, with early exit
+ */
+__attribute__((target("avx2")))
+int compareAVX2(const double * one, const double * two, int numberOfObjectives)
+{
+    int dominate1 = 0;
+    int dominate2 = 0;
+    int i = 0;
+    for (; i + 4 <= numberOfObjectives; i += 4)
+    {
+        __m256d a = _mm256_loadu_pd(one + i);
+        __m256d b = _mm256_loadu_pd(two + i);
+        dominate1 |= _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ));
+        dominate2 |= _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ));
+        if (dominate1 && dominate2)
+        {
+            return 0;
+        }
+    }
+    for (; i < numberOfObjectives; i++)
+    {
+        dominate1 |= (one[i] < two[i]);
+        dominate2 |= (one[i] > two[i]);
+    }
+
+    if ((dominate1 != 0) == (dominate2 != 0))
+    {
+        return 0;
+    }
+    return (dominate1 != 0) ? -1 : 1;
+}
+
+
+bool hasAVX2()
+{
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2;
+}
+
+#endif
+
+
+typedef int (*Kernel)(const double *, const double *, int);
+
+int compareScalarKernel(const double * one, const double * two,
+                        int numberOfObjectives)
+{
+    return compareScalar(one, two, numberOfObjectives);
+}
+
+int compare2Kernel(const double * one, const double * two, int)
+{
+    return compare2(one, two);
+}
+
+/**
+ * Returns the fastest test for a number of objectives
+ */
+Kernel selectKernel(int numberOfObjectives)
+{
+    if (numberOfObjectives == 2)
+    {
+        return compare2Kernel;
+    }
+#ifdef JMETAL_DOMINANCE_AVX2
+    if ((numberOfObjectives >= 4) && hasAVX2())
+    {
+        return compareAVX2;
+    }
+#endif
+    return compareScalarKernel;
+}
+
+} // namespace
+
+
+/**
+ * Dominance test of two objective vectors
+ * @param one First objective vector
+ * @param two Second objective vector
+ * @param numberOfObjectives Length of the vectors
+ */
+int Dominance::compare(const double * one, const double * two,
+                       int numberOfObjectives)
+{
+    if (numberOfObjectives == 2)
+    {
+        return compare2(one, two);
+    }
+#ifdef JMETAL_DOMINANCE_AVX2
+    if ((numberOfObjectives >= 4) && hasAVX2())
+    {
+        return compareAVX2(one, two, numberOfObjectives);
+    }
+#endif
+    return compareScalar(one, two, numberOfObjectives);
+} // compare
+
+
+/**
+ * Constraint violation test + dominance test of two solutions. It gives the
+ * same result as DominanceComparator.
+ */
+int Dominance::compare(Solution * one, Solution * two)
+{
+    int flag = compareConstraints(one, two);
+    if (flag != 0)
+    {
+        return flag;
+    }
+    return compare(one->getObjectives(), two->getObjectives(),
+                   one->getNumberOfObjectives());
+} // compare
+
+
+/**
+ * Compares a point against many others
+ * @param one The point
+ * @param many Pointers to the points to compare with
+ * @param count Number of points in many
+ * @param numberOfObjectives Length of the points
+ * @param flags Output: result of compare(one, many[i]) for each i
+ */
+void Dominance::compare(const double * one, const double * const * many,
+                        int count, int numberOfObjectives, int * flags)
+{
+    Kernel kernel = selectKernel(numberOfObjectives);
+    for (int i = 0; i < count; i++)
+    {
+        flags[i] = kernel(one, many[i], numberOfObjectives);
+    }
+} // compare
+
+
+/**
+ * Compares a solution against many others, including the constraint
+ * violation test
+ * @param one The solution
+ * @param many The solutions to compare with
+ * @param count Number of solutions in many
+ * @param flags Output: result of compare(one, many[i]) for each i
+ */
+void Dominance::compare(Solution * one, Solution * const * many, int count,
+                        int * flags)
+{
+    int numberOfObjectives = one->getNumberOfObjectives();
+    Kernel kernel = selectKernel(numberOfObjectives);
+    const double * objectives = one->getObjectives();
+    for (int i = 0; i < count; i++)
+    {
+        flags[i] = compareConstraints(one, many[i]);
+        if (flags[i] == 0)
+        {
+            flags[i] = kernel(objectives, many[i]->getObjectives(),
+                              numberOfObjectives);
+        }
+    }
+} // compare
+
+
+/**
+ * Constraint violation test of DominanceComparator: when the overall
+ * constraint violations differ and one of them is violated, the less
+ * violated solution wins. Otherwise it returns 0.
+ */
+int Dominance::compareConstraints(Solution * one, Solution * two)
+{
+    double overall1 = one->getOverallConstraintViolation();
+    double overall2 = two->getOverallConstraintViolation();
+
+    if ((overall1 == overall2) || ((overall1 >= 0) && (overall2 >= 0)))
+    {
+        return 0;
+    }
+    if ((overall1 < 0) && (overall2 < 0))
+    {
+        return (overall1 > overall2) ? -1 : 1;
+    }
+    if (overall1 == 0)
+    {
+        return -1;
+    }
+    if (overall2 == 0)
+    {
+        return 1;
+    }
+    return 0;
+} // compareConstraints
+
+
+/**
+ * Returns the instruction set used for points of four or more objectives
+ */
+const char * Dominance::getInstructionSet()
+{
+#ifdef JMETAL_DOMINANCE_AVX2
+    if (hasAVX2())
+    {
+        return "avx2";
+    }
+#endif
+    return "scalar";
+} // getInstructionSet
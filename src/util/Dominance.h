@@ -0,0 +1,57 @@
+//  Dominance.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __DOMINANCE__
+#define __DOMINANCE__
+
+#include <Solution.h>
+
+/**
+ * Typed Pareto dominance tests, for the code that needs them in its inner
+ * loops without going through the virtual <code>Comparator</code> hierarchy.
+ *
+ * All the tests follow the convention of DominanceComparator: they return -1
+ * if the first point dominates the second one, 1 if the second one dominates
+ * the first one, and 0 otherwise. The tests over solutions first apply the
+ * constraint violation test of DominanceComparator. Every test stops as soon
+ * as both points are known to be better in some objective.
+ *
+ * On x86-64 processors with AVX2, points of four or more objectives are
+ * compared four objectives at a time. Otherwise a scalar loop is used.
+ */
+class Dominance
+{
+
+public:
+    static int compare(const double * one, const double * two,
+                       int numberOfObjectives);
+    static int compare(Solution * one, Solution * two);
+
+    static void compare(const double * one, const double * const * many,
+                        int count, int numberOfObjectives, int * flags);
+    static void compare(Solution * one, Solution * const * many, int count,
+                        int * flags);
+
+    static int compareConstraints(Solution * one, Solution * two);
+    static const char * getInstructionSet();
+
+}; // Dominance
+
+#endif /* __DOMINANCE__ */
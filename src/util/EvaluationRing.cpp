@@ -0,0 +1,270 @@
+//  EvaluationRing.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <EvaluationRing.h>
+#include <iostream>
+#include <climits>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+/**
+ * Sleeps while a shared word keeps a value
+ * @param milliseconds Maximum time to sleep (-1 = no limit)
+ */
+static void futexWait(std::atomic<int> * word, int value, int milliseconds)
+{
+    struct timespec limit;
+    struct timespec * timeout = nullptr;
+    if (milliseconds >= 0)
+    {
+        limit.tv_sec = milliseconds / 1000;
+        limit.tv_nsec = (milliseconds % 1000) * 1000000L;
+        timeout = &limit;
+    }
+    syscall(SYS_futex, (int *) word, FUTEX_WAIT, value, timeout, nullptr, 0);
+} // futexWait
+
+
+/**
+ * Wakes up the processes sleeping on a shared word
+ */
+static void futexWake(std::atomic<int> * word, int count)
+{
+    syscall(SYS_futex, (int *) word, FUTEX_WAKE, count, nullptr, nullptr, 0);
+} // futexWake
+
+
+/**
+ * Constructor
+ * @param capacity Number of slots
+ * @param numberOfVariables Number of decision variables of each slot
+ * @param numberOfResults Number of results of each slot
+ */
+EvaluationRing::EvaluationRing(int capacity, int numberOfVariables,
+                               int numberOfResults)
+{
+    capacity_ = capacity;
+    numberOfVariables_ = numberOfVariables;
+    numberOfResults_ = numberOfResults;
+
+    // Each slot starts on its own cache line: its state and then its values
+    stride_ = sizeof(double) * (1 + numberOfVariables + numberOfResults);
+    stride_ = (stride_ + 63) / 64 * 64;
+    size_ = 64 + stride_ * capacity;
+    memory_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (memory_ == MAP_FAILED)
+    {
+        std::cout << "EvaluationRing: unable to map " << size_ << " bytes" << std::endl;
+        exit(-1);
+    }
+
+    header_ = new (memory_) Header;
+    header_->work = 0;
+    header_->done = 0;
+    header_->count = 0;
+    header_->stop = 0;
+    header_->next = 0;
+    slots_ = (char *) memory_ + 64;
+    for (int i = 0; i < capacity_; i++)
+    {
+        new (&state(i)) std::atomic<int>(FREE);
+    }
+} // EvaluationRing
+
+
+/**
+ * Destructor
+ */
+EvaluationRing::~EvaluationRing()
+{
+    munmap(memory_, size_);
+} // ~EvaluationRing
+
+
+/**
+ * Returns the number of slots
+ */
+int EvaluationRing::getCapacity()
+{
+    return capacity_;
+} // getCapacity
+
+
+/**
+ * Returns the decision variables of a slot
+ */
+double * EvaluationRing::getVariables(int slot)
+{
+    return (double *) (slots_ + slot * stride_) + 1;
+} // getVariables
+
+
+/**
+ * Returns the results of a slot
+ */
+double * EvaluationRing::getResults(int slot)
+{
+    return getVariables(slot) + numberOfVariables_;
+} // getResults
+
+
+/**
+ * Returns the state of a slot: FREE, READY, DONE or the process id of the
+ * consumer that has claimed it
+ */
+int EvaluationRing::getState(int slot)
+{
+    return state(slot).load(std::memory_order_acquire);
+} // getState
+
+
+/**
+ * Publishes the first count slots, whose variables have been written, and
+ * wakes up the consumers. The previous batch must be done.
+ * @param count The number of slots
+ */
+void EvaluationRing::publish(int count)
+{
+    header_->done.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < count; i++)
+    {
+        state(i).store(READY, std::memory_order_release);
+    }
+    for (int i = count; i < capacity_; i++)
+    {
+        state(i).store(FREE, std::memory_order_relaxed);
+    }
+    header_->next.store(0, std::memory_order_relaxed);
+    header_->count.store(count, std::memory_order_release);
+    header_->work.fetch_add(1, std::memory_order_acq_rel);
+    futexWake(&header_->work, INT_MAX);
+} // publish
+
+
+/**
+ * Waits until all the published slots are done
+ * @param milliseconds Maximum time to wait
+ * @return true if they are done; false if the time has expired first
+ */
+bool EvaluationRing::wait(int milliseconds)
+{
+    int count = header_->count.load(std::memory_order_acquire);
+    int done = header_->done.load(std::memory_order_acquire);
+    if (done < count)
+    {
+        futexWait(&header_->done, done, milliseconds);
+    }
+
+    // A consumer may die between completing a slot and counting it, so the
+    // states decide
+    for (int i = 0; i < count; i++)
+    {
+        if (getState(i) != DONE)
+        {
+            return false;
+        }
+    }
+    return true;
+} // wait
+
+
+/**
+ * Publishes again a slot whose consumer has died
+ */
+void EvaluationRing::retry(int slot)
+{
+    state(slot).store(READY, std::memory_order_release);
+    header_->work.fetch_add(1, std::memory_order_acq_rel);
+    futexWake(&header_->work, INT_MAX);
+} // retry
+
+
+/**
+ * Makes the consumers return from <code>claim</code>
+ */
+void EvaluationRing::stop()
+{
+    header_->stop.store(1, std::memory_order_release);
+    header_->work.fetch_add(1, std::memory_order_acq_rel);
+    futexWake(&header_->work, INT_MAX);
+} // stop
+
+
+/**
+ * Claims a published slot, sleeping until there is one
+ * @param owner The process id of the consumer
+ * @return The slot, or -1 if the ring has been stopped
+ */
+int EvaluationRing::claim(int owner)
+{
+    while (true)
+    {
+        int work = header_->work.load(std::memory_order_acquire);
+        if (header_->stop.load(std::memory_order_acquire) != 0)
+        {
+            return -1;
+        }
+        // The scan starts after the last slot claimed, which is only a hint
+        int count = header_->count.load(std::memory_order_acquire);
+        int first = header_->next.load(std::memory_order_relaxed);
+        for (int k = 0; k < count; k++)
+        {
+            int i = (first + k) % count;
+            int expected = READY;
+            if (state(i).compare_exchange_strong(expected, owner,
+                                                 std::memory_order_acq_rel))
+            {
+                header_->next.store(i + 1, std::memory_order_relaxed);
+                return i;
+            }
+        }
+        futexWait(&header_->work, work, -1);
+    }
+} // claim
+
+
+/**
+ * Marks a claimed slot as done, once its results have been written
+ */
+void EvaluationRing::complete(int slot)
+{
+    state(slot).store(DONE, std::memory_order_release);
+    int done = header_->done.fetch_add(1, std::memory_order_acq_rel) + 1;
+    if (done >= header_->count.load(std::memory_order_acquire))
+    {
+        futexWake(&header_->done, 1);
+    }
+} // complete
+
+
+/**
+ * Returns the state word of a slot
+ */
+std::atomic<int> & EvaluationRing::state(int slot)
+{
+    return *(std::atomic<int> *) (slots_ + slot * stride_);
+} // state
@@ -0,0 +1,90 @@
+//  EvaluationRing.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __EVALUATION_RING__
+#define __EVALUATION_RING__
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * This class implements a ring of evaluation slots in memory shared by a
+ * process and the worker processes it forks (see
+ * <code>DistributedProblem</code>). Each slot holds the decision variables of
+ * a solution and room for its results, so a batch is handed to the workers
+ * and collected without going through pipes or sockets.
+ *
+ * There is a single producer, which publishes batches of up to capacity
+ * slots and waits for them, and any number of consumers, which claim the
+ * published slots one at a time. A claimed slot records the process id of
+ * its consumer, so that the producer can publish it again if the consumer
+ * dies. Idle consumers and the waiting producer sleep on futexes.
+ *
+ * The ring must be created before forking the consumers. It only works on
+ * Linux.
+ */
+class EvaluationRing
+{
+
+private:
+    struct Header
+    {
+        std::atomic<int> work;
+        std::atomic<int> done;
+        std::atomic<int> count;
+        std::atomic<int> stop;
+        std::atomic<int> next;
+    };
+
+    void * memory_;
+    size_t size_;
+    Header * header_;
+    char * slots_;
+    size_t stride_;
+    int capacity_;
+    int numberOfVariables_;
+    int numberOfResults_;
+
+    std::atomic<int> & state(int slot);
+
+public:
+    /**
+     * States of a slot. A claimed slot holds the process id of its consumer
+     */
+    enum { FREE = -3, DONE = -2, READY = -1 };
+
+    EvaluationRing(int capacity, int numberOfVariables, int numberOfResults);
+    ~EvaluationRing();
+    int getCapacity();
+    double * getVariables(int slot);
+    double * getResults(int slot);
+    int getState(int slot);
+
+    void publish(int count);
+    bool wait(int milliseconds);
+    void retry(int slot);
+    void stop();
+
+    int claim(int owner);
+    void complete(int slot);
+
+}; // EvaluationRing
+
+#endif
@@ -0,0 +1,108 @@
+//  Hash.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#include <Hash.h>
+#include <Solution.h>
+#include <cstring>
+
+
+/**
+ * Scrambles a 64-bit value (the finalizer of splitmix64), so that
+ * consecutive inputs give unrelated hashes
+ * @param value The value
+ * @return The scrambled value
+ */
+unsigned long long Hash::mix(unsigned long long value)
+{
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+} // mix
+
+
+/**
+ * Combines a hash with the hash of the next element of a sequence. The result
+ * depends on the order of the elements.
+ * @param seed The hash of the previous elements
+ * @param value The hash of the next element
+ * @return The hash of the sequence
+ */
+unsigned long long Hash::combine(unsigned long long seed,
+                                 unsigned long long value)
+{
+    return mix(seed ^ value) + value;
+} // combine
+
+
+/**
+ * Returns the hash of a real value
+ * @param value The value
+ * @return The hash
+ */
+unsigned long long Hash::value(double value)
+{
+    if (value == 0.0)
+    {
+        value = 0.0;    // -0.0 == 0.0
+    }
+    unsigned long long bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return mix(bits);
+} // value
+
+
+/**
+ * Returns the hash of the decision variables of a solution. For
+ * binary-coded variables it is maintained by the variables as they are
+ * modified, so it takes time proportional to the number of variables rather
+ * than to the number of bits.
+ * @param solution The solution
+ * @return The hash
+ */
+unsigned long long Hash::genome(Solution * solution)
+{
+    Variable ** variables = solution->getDecisionVariables();
+    unsigned long long hash = 0;
+    for (int i = 0; i < solution->getNumberOfVariables(); i++)
+    {
+        hash = combine(hash, variables[i]->hashCode());
+    }
+    return hash;
+} // genome
+
+
+/**
+ * Returns the hash of the objective values of a solution
+ * @param solution The solution
+ * @return The hash
+ */
+unsigned long long Hash::objectives(Solution * solution)
+{
+    const double * objectives = solution->getObjectives();
+    unsigned long long hash = 0;
+    for (int i = 0; i < solution->getNumberOfObjectives(); i++)
+    {
+        hash = combine(hash, value(objectives[i]));
+    }
+    return hash;
+} // objectives
@@ -0,0 +1,48 @@
+//  Hash.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef __HASH__
+#define __HASH__
+
+class Solution;
+
+/**
+ * Hash functions used to detect duplicated solutions in expected constant
+ * time. Two equal solutions always have the same hash, but two solutions
+ * with the same hash may be different, so a match has to be confirmed by an
+ * exact comparison. Real values are hashed by their exact representation
+ * (with 0.0 and -0.0 hashed alike), which matches the equality tests of
+ * <code>EqualSolutions</code> and <code>MOCHC</code>.
+ */
+class Hash
+{
+
+public:
+    static unsigned long long mix(unsigned long long value);
+    static unsigned long long combine(unsigned long long seed,
+                                      unsigned long long value);
+    static unsigned long long value(double value);
+    static unsigned long long genome(Solution * solution);
+    static unsigned long long objectives(Solution * solution);
+
+}; // Hash
+
+#endif /* __HASH__ */
@@ -0,0 +1,272 @@
+//  Instrumentation.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Instrumentation.h>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+
+/**
+ * Counters of a thread. They are only written by their thread, but other
+ * threads read them when taking a snapshot, hence the relaxed atomics.
+ */
+struct ThreadCounters
+{
+    std::atomic<long long> time[Instrumentation::NUMBER_OF_PHASES];
+    std::atomic<long long> calls[Instrumentation::NUMBER_OF_PHASES];
+    std::atomic<long long> evaluations;
+    std::atomic<long long> allocations;
+
+    ThreadCounters();
+    ~ThreadCounters();
+    void addTo(Instrumentation::Counters & counters);
+};
+
+std::mutex registryMutex;
+std::vector<ThreadCounters *> registry;
+Instrumentation::Counters finished = Instrumentation::Counters();
+
+ThreadCounters::ThreadCounters()
+{
+    for (int i = 0; i < Instrumentation::NUMBER_OF_PHASES; i++)
+    {
+        time[i] = 0;
+        calls[i] = 0;
+    }
+    evaluations = 0;
+    allocations = 0;
+
+    std::unique_lock<std::mutex> lock(registryMutex);
+    registry.push_back(this);
+}
+
+/**
+ * Keeps the counters of a finished thread
+ */
+ThreadCounters::~ThreadCounters()
+{
+    std::unique_lock<std::mutex> lock(registryMutex);
+    addTo(finished);
+    for (size_t i = 0; i < registry.size(); i++)
+    {
+        if (registry[i] == this)
+        {
+            registry.erase(registry.begin() + i);
+            break;
+        }
+    }
+}
+
+void ThreadCounters::addTo(Instrumentation::Counters & counters)
+{
+    for (int i = 0; i < Instrumentation::NUMBER_OF_PHASES; i++)
+    {
+        counters.time[i] += time[i].load(std::memory_order_relaxed);
+        counters.calls[i] += calls[i].load(std::memory_order_relaxed);
+    }
+    counters.evaluations += evaluations.load(std::memory_order_relaxed);
+    counters.allocations += allocations.load(std::memory_order_relaxed);
+}
+
+ThreadCounters & local()
+{
+    static thread_local ThreadCounters counters;
+    return counters;
+}
+
+inline void increase(std::atomic<long long> & counter, long long value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value,
+                  std::memory_order_relaxed);
+}
+
+} // namespace
+
+
+/**
+ * Returns a monotonic time stamp in nanoseconds
+ */
+long long Instrumentation::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+} // now
+
+
+void Instrumentation::addTime(Phase phase, long long nanoseconds)
+{
+    increase(local().time[phase], nanoseconds);
+} // addTime
+
+
+void Instrumentation::countCall(Phase phase)
+{
+    increase(local().calls[phase], 1);
+} // countCall
+
+
+void Instrumentation::countEvaluations(int evaluations)
+{
+    increase(local().evaluations, evaluations);
+} // countEvaluations
+
+
+void Instrumentation::countAllocation()
+{
+    increase(local().allocations, 1);
+} // countAllocation
+
+
+/**
+ * Returns the counters of all the threads since the program started
+ */
+Instrumentation::Counters Instrumentation::snapshot()
+{
+    Counters counters = Counters();
+    std::unique_lock<std::mutex> lock(registryMutex);
+    for (int i = 0; i < NUMBER_OF_PHASES; i++)
+    {
+        counters.time[i] = finished.time[i];
+        counters.calls[i] = finished.calls[i];
+    }
+    counters.evaluations = finished.evaluations;
+    counters.allocations = finished.allocations;
+    for (size_t i = 0; i < registry.size(); i++)
+    {
+        registry[i]->addTo(counters);
+    }
+    return counters;
+} // snapshot
+
+
+/**
+ * Returns the counters accumulated between two snapshots
+ */
+Instrumentation::Counters Instrumentation::difference(const Counters & end,
+        const Counters & start)
+{
+    Counters counters = Counters();
+    for (int i = 0; i < NUMBER_OF_PHASES; i++)
+    {
+        counters.time[i] = end.time[i] - start.time[i];
+        counters.calls[i] = end.calls[i] - start.calls[i];
+    }
+    counters.evaluations = end.evaluations - start.evaluations;
+    counters.allocations = end.allocations - start.allocations;
+    return counters;
+} // difference
+
+
+const char * Instrumentation::getPhaseName(Phase phase)
+{
+    static const char * names[NUMBER_OF_PHASES] =
+    {
+        "selection", "variation", "evaluation", "ranking", "density", "archive"
+    };
+    return names[phase];
+} // getPhaseName
+
+
+/**
+ * Returns the counters as a JSON object. Times are given in seconds.
+ * @param counters The counters of a run
+ * @param wallTime Elapsed time of the run, in seconds
+ */
+std::string Instrumentation::toJSON(const Counters & counters, double wallTime)
+{
+    std::ostringstream out;
+    out << std::setprecision(9);
+    out << "{\"wallTime\":" << wallTime
+        << ",\"evaluations\":" << counters.evaluations
+        << ",\"allocations\":" << counters.allocations
+        << ",\"phases\":{";
+    for (int i = 0; i < NUMBER_OF_PHASES; i++)
+    {
+        out << (i > 0 ? "," : "")
+            << "\"" << getPhaseName((Phase) i) << "\":{\"calls\":"
+            << counters.calls[i] << ",\"time\":" << counters.time[i] / 1.0e9
+            << "}";
+    }
+    out << "}}";
+    return out.str();
+} // toJSON
+
+
+/**
+ * Returns the counters as CSV lines with the header
+ * <code>counter,calls,time</code>. Times are given in seconds.
+ * @param counters The counters of a run
+ * @param wallTime Elapsed time of the run, in seconds
+ */
+std::string Instrumentation::toCSV(const Counters & counters, double wallTime)
+{
+    std::ostringstream out;
+    out << std::setprecision(9);
+    out << "counter,calls,time\n";
+    for (int i = 0; i < NUMBER_OF_PHASES; i++)
+    {
+        out << getPhaseName((Phase) i) << "," << counters.calls[i] << ","
+            << counters.time[i] / 1.0e9 << "\n";
+    }
+    out << "evaluations," << counters.evaluations << ",\n";
+    out << "allocations," << counters.allocations << ",\n";
+    out << "wallTime,," << wallTime << "\n";
+    return out.str();
+} // toCSV
+
+
+thread_local ScopedTimer * ScopedTimer::current_ = nullptr;
+
+
+ScopedTimer::ScopedTimer(Instrumentation::Phase phase)
+{
+    long long start = Instrumentation::now();
+
+    // The enclosing phase is paused while this one runs
+    parent_ = current_;
+    if (parent_ != nullptr)
+    {
+        Instrumentation::addTime(parent_->phase_, start - parent_->start_);
+    }
+
+    phase_ = phase;
+    start_ = start;
+    current_ = this;
+    Instrumentation::countCall(phase);
+} // ScopedTimer
+
+
+ScopedTimer::~ScopedTimer()
+{
+    long long end = Instrumentation::now();
+    Instrumentation::addTime(phase_, end - start_);
+
+    current_ = parent_;
+    if (parent_ != nullptr)
+    {
+        parent_->start_ = end;
+    }
+} // ~ScopedTimer
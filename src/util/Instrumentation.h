@@ -0,0 +1,121 @@
+//  Instrumentation.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __INSTRUMENTATION__
+#define __INSTRUMENTATION__
+
+#include <atomic>
+#include <string>
+
+/**
+ * This class collects low-overhead counters about where the metaheuristics
+ * spend their time: self time and number of calls of each phase (selection,
+ * variation, evaluation, ranking, density estimation and archive
+ * maintenance), number of evaluations and number of Solution objects
+ * allocated.
+ *
+ * Every thread updates its own counters, so timing the evaluations of a
+ * parallel algorithm does not introduce contention. A snapshot adds up the
+ * counters of all the threads, including the ones that have already finished.
+ *
+ * The instrumentation is only compiled when JMETAL_INSTRUMENTATION is
+ * defined (cmake -DJMETAL_INSTRUMENTATION=ON, or make INSTRUMENTATION=1).
+ * Otherwise the JMETAL_* macros below expand to nothing.
+ */
+class Instrumentation
+{
+
+public:
+
+    enum Phase
+    {
+        SELECTION,
+        VARIATION,
+        EVALUATION,
+        RANKING,
+        DENSITY,
+        ARCHIVE,
+        NUMBER_OF_PHASES
+    };
+
+    struct Counters
+    {
+        long long time[NUMBER_OF_PHASES]; // nanoseconds
+        long long calls[NUMBER_OF_PHASES];
+        long long evaluations;
+        long long allocations;
+    };
+
+    static long long now();
+    static void addTime(Phase phase, long long nanoseconds);
+    static void countCall(Phase phase);
+    static void countEvaluations(int evaluations);
+    static void countAllocation();
+
+    static Counters snapshot();
+    static Counters difference(const Counters & end, const Counters & start);
+    static const char * getPhaseName(Phase phase);
+    static std::string toJSON(const Counters & counters, double wallTime);
+    static std::string toCSV(const Counters & counters, double wallTime);
+
+}; // Instrumentation
+
+
+/**
+ * Charges the time elapsed while it is alive to a phase. Timers can be
+ * nested: the time spent in an inner phase is not charged to the outer one,
+ * so the times of the phases never overlap.
+ */
+class ScopedTimer
+{
+
+private:
+    static thread_local ScopedTimer * current_;
+
+    Instrumentation::Phase phase_;
+    ScopedTimer * parent_;
+    long long start_;
+
+public:
+    ScopedTimer(Instrumentation::Phase phase);
+    ~ScopedTimer();
+
+}; // ScopedTimer
+
+
+#define JMETAL_CONCATENATE_(a, b) a##b
+#define JMETAL_CONCATENATE(a, b) JMETAL_CONCATENATE_(a, b)
+
+#ifdef JMETAL_INSTRUMENTATION
+#define JMETAL_TIME_PHASE(phase) \
+    ScopedTimer JMETAL_CONCATENATE(scopedTimer_, __LINE__)(Instrumentation::phase)
+#define JMETAL_COUNT_EVALUATIONS(evaluations) \
+    Instrumentation::countEvaluations(evaluations)
+#define JMETAL_COUNT_ALLOCATION() Instrumentation::countAllocation()
+#define JMETAL_TIME_EVALUATIONS(evaluations) \
+    JMETAL_TIME_PHASE(EVALUATION); JMETAL_COUNT_EVALUATIONS(evaluations)
+#else
+#define JMETAL_TIME_PHASE(phase)
+#define JMETAL_COUNT_EVALUATIONS(evaluations)
+#define JMETAL_COUNT_ALLOCATION()
+#define JMETAL_TIME_EVALUATIONS(evaluations)
+#endif
+
+#endif /* __INSTRUMENTATION__ */
@@ -0,0 +1,188 @@
+//  Migration.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Migration.h>
+#include <DominanceComparator.h>
+#include <PseudoRandom.h>
+
+
+/**
+ * Constructor
+ * @param interval Number of evaluations between two migrations
+ * @param numberOfMigrants Number of solutions sent in each migration
+ * @param randomDestination If true, each migration goes to one outgoing
+ * queue chosen at random; otherwise it goes to all of them
+ */
+Migration::Migration(int interval, int numberOfMigrants, bool randomDestination)
+{
+    if (interval <= 0)
+    {
+        std::cout << "Migration: the migration interval must be positive: "
+                  << interval << std::endl;
+        exit(-1);
+    }
+    interval_ = interval;
+    numberOfMigrants_ = numberOfMigrants;
+    randomDestination_ = randomDestination;
+    nextMigration_ = interval;
+    sent_ = 0;
+    received_ = 0;
+} // Migration
+
+
+/**
+ * Adds a queue towards another island
+ */
+void Migration::addOutgoing(MigrationQueue * queue)
+{
+    outgoing_.push_back(queue);
+} // addOutgoing
+
+
+/**
+ * Adds a queue from another island
+ */
+void Migration::addIncoming(MigrationQueue * queue)
+{
+    incoming_.push_back(queue);
+} // addIncoming
+
+
+/**
+ * Checks whether a migration is due, and schedules the next one
+ * @param evaluations Number of evaluations done by the island so far
+ * @return true if the island must migrate now
+ */
+bool Migration::isDue(long evaluations)
+{
+    if (evaluations < nextMigration_)
+    {
+        return false;
+    }
+    while (nextMigration_ <= evaluations)
+    {
+        nextMigration_ += interval_;
+    }
+    return true;
+} // isDue
+
+
+/**
+ * Sends copies of numberOfMigrants solutions of a population
+ * @param population The population of the island
+ */
+void Migration::send(SolutionSet * population)
+{
+    if ((population->size() == 0) || outgoing_.empty())
+    {
+        return;
+    }
+
+    int first = 0;
+    int last = outgoing_.size() - 1;
+    if (randomDestination_)
+    {
+        first = last = PseudoRandom::randInt(0, outgoing_.size() - 1);
+    }
+
+    for (int i = 0; i < numberOfMigrants_; i++)
+    {
+        Solution * emigrant = selectEmigrant(population);
+        for (int j = first; j <= last; j++)
+        {
+            Solution * copy = snew Solution(emigrant);
+            if (outgoing_[j]->push(copy))
+            {
+                sent_++;
+            }
+            else
+            {
+                delete copy;
+            }
+        }
+    }
+} // send
+
+
+/**
+ * Takes the solutions waiting in the incoming queues
+ * @return A solution set owning the immigrants; it may be empty
+ */
+SolutionSet * Migration::receive()
+{
+    std::vector<Solution *> arrived;
+    for (int i = 0; i < incoming_.size(); i++)
+    {
+        Solution * immigrant;
+        while ((immigrant = incoming_[i]->pop()) != nullptr)
+        {
+            arrived.push_back(immigrant);
+        }
+    }
+    received_ += arrived.size();
+
+    SolutionSet * immigrants = snew SolutionSet(arrived.size());
+    for (int i = 0; i < arrived.size(); i++)
+    {
+        immigrants->add(arrived[i]);
+    }
+    return immigrants;
+} // receive
+
+
+/**
+ * Returns the number of solutions sent
+ */
+int Migration::getSent()
+{
+    return sent_;
+} // getSent
+
+
+/**
+ * Returns the number of solutions received
+ */
+int Migration::getReceived()
+{
+    return received_;
+} // getReceived
+
+
+/**
+ * Chooses an emigrant by binary tournament on Pareto dominance
+ * @param population The population of the island
+ * @return The chosen solution, still owned by the population
+ */
+Solution * Migration::selectEmigrant(SolutionSet * population)
+{
+    Solution * one = population->get(PseudoRandom::randInt(0, population->size() - 1));
+    Solution * two = population->get(PseudoRandom::randInt(0, population->size() - 1));
+    DominanceComparator dominance;
+    int flag = dominance.compare(one, two);
+    if (flag == -1)
+    {
+        return one;
+    }
+    else if (flag == 1)
+    {
+        return two;
+    }
+    return (PseudoRandom::randDouble() < 0.5) ? one : two;
+} // selectEmigrant
@@ -0,0 +1,67 @@
+//  Migration.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __MIGRATION__
+#define __MIGRATION__
+
+#include <MigrationQueue.h>
+#include <SolutionSet.h>
+#include <Solution.h>
+#include <vector>
+
+/**
+ * This class is the end point of an island in an island model (see
+ * <code>IslandModel</code>). Every migrationInterval evaluations the
+ * algorithm of the island sends copies of some of its solutions through its
+ * outgoing queues and takes the solutions waiting in its incoming queues.
+ *
+ * Migration is asynchronous: an island never waits for another one. When a
+ * destination queue is full the migrant is dropped. Emigrants are chosen by
+ * binary tournament on Pareto dominance, using the random stream of the
+ * calling thread.
+ */
+class Migration
+{
+
+private:
+    int interval_;
+    int numberOfMigrants_;
+    bool randomDestination_;
+    long nextMigration_;
+    std::vector<MigrationQueue *> outgoing_;
+    std::vector<MigrationQueue *> incoming_;
+    int sent_;
+    int received_;
+
+    Solution * selectEmigrant(SolutionSet * population);
+
+public:
+    Migration(int interval, int numberOfMigrants, bool randomDestination);
+    void addOutgoing(MigrationQueue * queue);
+    void addIncoming(MigrationQueue * queue);
+    bool isDue(long evaluations);
+    void send(SolutionSet * population);
+    SolutionSet * receive();
+    int getSent();
+    int getReceived();
+
+}; // Migration
+
+#endif
@@ -0,0 +1,87 @@
+//  MigrationQueue.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <MigrationQueue.h>
+
+
+/**
+ * Constructor
+ * @param capacity The maximum number of solutions in the queue
+ */
+MigrationQueue::MigrationQueue(int capacity)
+    : buffer_(capacity, nullptr), capacity_(capacity), head_(0), tail_(0)
+{
+    if (capacity <= 0)
+    {
+        std::cout << "MigrationQueue: the capacity must be positive: "
+                  << capacity << std::endl;
+        exit(-1);
+    }
+} // MigrationQueue
+
+
+/**
+ * Destructor. Deletes the solutions that were never received.
+ */
+MigrationQueue::~MigrationQueue()
+{
+    Solution * solution;
+    while ((solution = pop()) != nullptr)
+    {
+        delete solution;
+    }
+} // ~MigrationQueue
+
+
+/**
+ * Appends a solution. Only the producer thread may call it.
+ * @param solution The solution. The queue takes its ownership on success
+ * @return false if the queue is full; the solution is then left to the
+ * caller
+ */
+bool MigrationQueue::push(Solution * solution)
+{
+    unsigned long tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == (unsigned long) capacity_)
+    {
+        return false;
+    }
+    buffer_[tail % capacity_] = solution;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+} // push
+
+
+/**
+ * Removes the oldest solution. Only the consumer thread may call it.
+ * @return The solution, owned by the caller, or nullptr if the queue is
+ * empty
+ */
+Solution * MigrationQueue::pop()
+{
+    unsigned long head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+    Solution * solution = buffer_[head % capacity_];
+    head_.store(head + 1, std::memory_order_release);
+    return solution;
+} // pop
@@ -0,0 +1,51 @@
+//  MigrationQueue.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __MIGRATION_QUEUE__
+#define __MIGRATION_QUEUE__
+
+#include <Solution.h>
+#include <atomic>
+#include <vector>
+
+/**
+ * This class implements a bounded lock-free queue of solutions between two
+ * threads: a single producer calls <code>push</code> and a single consumer
+ * calls <code>pop</code>. It carries the migrants from an island to another
+ * one (see <code>Migration</code>). The queue owns the solutions it holds.
+ */
+class MigrationQueue
+{
+
+private:
+    std::vector<Solution *> buffer_;
+    int capacity_;
+    std::atomic<unsigned long> head_;
+    std::atomic<unsigned long> tail_;
+
+public:
+    MigrationQueue(int capacity);
+    ~MigrationQueue();
+    bool push(Solution * solution);
+    Solution * pop();
+
+}; // MigrationQueue
+
+#endif
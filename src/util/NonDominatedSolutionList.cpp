@@ -20,6 +20,9 @@
 
 
 #include <NonDominatedSolutionList.h>
+#include <Instrumentation.h>
+#include <Dominance.h>
+#include <typeinfo>
 
 
 /**
@@ -33,6 +36,7 @@ NonDominatedSolutionList::NonDominatedSolutionList()
 
     dominance = snew DominanceComparator();
     equal = snew SolutionComparator();
+    paretoDominance_ = true;
 
 } // NonDominatedList
 
@@ -49,6 +53,7 @@ NonDominatedSolutionList::NonDominatedSolutionList(Comparator *dominance)
 
     this->dominance = dominance;
     this->equal     = new SolutionComparator();
+    paretoDominance_ = (typeid(*dominance) == typeid(DominanceComparator));
 
 } // NonDominatedList
 
@@ -74,6 +79,41 @@ NonDominatedSolutionList::~NonDominatedSolutionList()
  */
 bool NonDominatedSolutionList::add(Solution *solution)
 {
+    JMETAL_TIME_PHASE(ARCHIVE);
+
+    if (paretoDominance_)
+    {
+        // The members of the list are mutually non-dominated, so the new
+        // solution can be compared against all of them in a single batch
+        int n = solutionsList_.size();
+        flags_.resize(n);
+        Dominance::compare(solution, solutionsList_.data(), n, flags_.data());
+
+        for (int i = 0; i < n; i++)
+        {
+            if (flags_[i] == 1)     // The new solution is dominated
+            {
+                return false;
+            }
+        } // for
+
+        int kept = 0;
+        for (int i = 0; i < n; i++)
+        {
+            if (flags_[i] == -1)    // A solution in the list is dominated by the new one
+            {
+                delete solutionsList_[i];
+            }
+            else
+            {
+                solutionsList_[kept++] = solutionsList_[i];
+            }
+        } // for
+        solutionsList_.resize(kept);
+        solutionsList_.push_back(solution);
+
+        return true;
+    } // if
 
     int i = 0;
     Solution * aux; //Store an solution temporally
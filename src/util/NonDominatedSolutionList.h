@@ -25,6 +25,7 @@
 #include <DominanceComparator.h>
 #include <SolutionComparator.h>
 #include <SolutionSet.h>
+#include <vector>
 
 /**
  * This class implements an unbound list of non-dominated solutions
@@ -37,6 +38,18 @@ private:
     Comparator * dominance;
     Comparator * equal;
 
+    /**
+     * True when the dominance comparator is a plain
+     * <code>DominanceComparator</code>, so the typed batch kernel of
+     * <code>Dominance</code> can be used instead
+     */
+    bool paretoDominance_;
+
+    /**
+     * Reusable buffer with the dominance flags of the last insertion
+     */
+    std::vector<int> flags_;
+
 public:
     NonDominatedSolutionList();
     NonDominatedSolutionList(Comparator *dominance);
@@ -0,0 +1,217 @@
+//  ParticleSwarm.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <ParticleSwarm.h>
+
+
+/**
+ * Constructor
+ * @param problem Problem whose bounds limit the positions of the particles
+ * @param swarmSize Number of particles
+ */
+ParticleSwarm::ParticleSwarm(Problem * problem, int swarmSize)
+{
+    swarmSize_ = swarmSize;
+    numberOfVariables_ = problem->getNumberOfVariables();
+
+    position_.assign(swarmSize_ * numberOfVariables_, 0.0);
+    velocity_.assign(swarmSize_ * numberOfVariables_, 0.0);
+    bestPosition_.assign(swarmSize_ * numberOfVariables_, 0.0);
+
+    lowerLimit_.resize(numberOfVariables_);
+    upperLimit_.resize(numberOfVariables_);
+    deltaMax_.resize(numberOfVariables_);
+    deltaMin_.resize(numberOfVariables_);
+    for (int var = 0; var < numberOfVariables_; var++)
+    {
+        lowerLimit_[var] = problem->getLowerLimit(var);
+        upperLimit_[var] = problem->getUpperLimit(var);
+        deltaMax_[var] = (upperLimit_[var] - lowerLimit_[var]) / 2.0;
+        deltaMin_[var] = -deltaMax_[var];
+    } // for
+} // ParticleSwarm
+
+
+int ParticleSwarm::size()
+{
+    return swarmSize_;
+} // size
+
+
+int ParticleSwarm::getNumberOfVariables()
+{
+    return numberOfVariables_;
+} // getNumberOfVariables
+
+
+double * ParticleSwarm::getPosition(int i)
+{
+    return position_.data() + i * numberOfVariables_;
+} // getPosition
+
+
+double * ParticleSwarm::getVelocity(int i)
+{
+    return velocity_.data() + i * numberOfVariables_;
+} // getVelocity
+
+
+double * ParticleSwarm::getBestPosition(int i)
+{
+    return bestPosition_.data() + i * numberOfVariables_;
+} // getBestPosition
+
+
+/**
+ * Copies the variables of a solution into the position of a particle
+ * @param i Index of the particle
+ * @param solution The solution representing the particle
+ */
+void ParticleSwarm::loadPosition(int i, Solution * solution)
+{
+    XReal particle(solution);
+    particle.getValues(getPosition(i));
+} // loadPosition
+
+
+/**
+ * Copies the position of a particle into the variables of a solution
+ * @param i Index of the particle
+ * @param solution The solution representing the particle
+ */
+void ParticleSwarm::storePosition(int i, Solution * solution)
+{
+    XReal particle(solution);
+    particle.setValues(getPosition(i));
+} // storePosition
+
+
+/**
+ * Makes the current position of a particle its personal best
+ * @param i Index of the particle
+ */
+void ParticleSwarm::saveBestPosition(int i)
+{
+    const double * x = getPosition(i);
+    double * p = getBestPosition(i);
+    for (int var = 0; var < numberOfVariables_; var++)
+    {
+        p[var] = x[var];
+    }
+} // saveBestPosition
+
+
+/**
+ * Sets the velocity of all the particles to 0
+ */
+void ParticleSwarm::resetVelocities()
+{
+    velocity_.assign(velocity_.size(), 0.0);
+} // resetVelocities
+
+
+/**
+ * Updates the velocity of a particle:
+ *   v = constriction * (inertia * v + c1r1 * (p - x) + c2r2 * (g - x))
+ * @param i Index of the particle
+ * @param globalBest Position of the leader of the particle
+ * @param inertia Inertia weight
+ * @param c1r1 Product of the cognitive coefficient and its random factor
+ * @param c2r2 Product of the social coefficient and its random factor
+ * @param constriction Constriction coefficient
+ */
+void ParticleSwarm::updateVelocity(int i, const double * globalBest,
+                                   double inertia, double c1r1, double c2r2,
+                                   double constriction)
+{
+    double * __restrict v = getVelocity(i);
+    const double * __restrict x = getPosition(i);
+    const double * __restrict p = getBestPosition(i);
+    const double * __restrict g = globalBest;
+
+    for (int var = 0; var < numberOfVariables_; var++)
+    {
+        v[var] = constriction * (inertia * v[var] +
+                                 c1r1 * (p[var] - x[var]) +
+                                 c2r2 * (g[var] - x[var]));
+    }
+} // updateVelocity
+
+
+/**
+ * Bounds the velocity of a particle to half the range of each variable
+ * @param i Index of the particle
+ */
+void ParticleSwarm::constrainVelocity(int i)
+{
+    double * __restrict v = getVelocity(i);
+    const double * __restrict dmax = deltaMax_.data();
+    const double * __restrict dmin = deltaMin_.data();
+
+    for (int var = 0; var < numberOfVariables_; var++)
+    {
+        double value = v[var] > dmax[var] ? dmax[var] : v[var];
+        v[var] = value < dmin[var] ? dmin[var] : value;
+    }
+} // constrainVelocity
+
+
+/**
+ * Moves a particle according to its velocity. A variable leaving its bounds
+ * is set to the bound, and its velocity is multiplied by chVel1 (lower bound)
+ * or chVel2 (upper bound)
+ * @param i Index of the particle
+ * @param chVel1 Velocity factor applied at the lower bound
+ * @param chVel2 Velocity factor applied at the upper bound
+ */
+void ParticleSwarm::move(int i, double chVel1, double chVel2)
+{
+    double * __restrict x = getPosition(i);
+    double * __restrict v = getVelocity(i);
+    const double * __restrict lower = lowerLimit_.data();
+    const double * __restrict upper = upperLimit_.data();
+
+    for (int var = 0; var < numberOfVariables_; var++)
+    {
+        double value = x[var] + v[var];
+        bool below = value < lower[var];
+        bool above = value > upper[var];
+        v[var] = below ? v[var] * chVel1 : (above ? v[var] * chVel2 : v[var]);
+        x[var] = below ? lower[var] : (above ? upper[var] : value);
+    }
+} // move
+
+
+/**
+ * Draws a batch of uniform random numbers
+ * @param values Array receiving the numbers
+ * @param size Number of values to draw
+ * @param minBound Lower bound of the interval
+ * @param maxBound Upper bound of the interval
+ */
+void ParticleSwarm::randDouble(double * values, int size, double minBound,
+                               double maxBound)
+{
+    RandomGenerator * generator = PseudoRandom::getRandomGenerator();
+    for (int i = 0; i < size; i++)
+    {
+        values[i] = generator->rndreal(minBound, maxBound);
+    }
+} // randDouble
@@ -0,0 +1,80 @@
+//  ParticleSwarm.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __PARTICLE_SWARM__
+#define __PARTICLE_SWARM__
+
+#include <Problem.h>
+#include <Solution.h>
+#include <PseudoRandom.h>
+#include <XReal.h>
+#include <vector>
+
+/**
+ * This class stores the state of a swarm of real-coded particles (positions,
+ * velocities and personal best positions) as contiguous row-major matrices,
+ * one row per particle, and implements the velocity and position updates
+ * shared by the PSO algorithms. The update loops work on plain arrays, so the
+ * compiler can vectorize them.
+ *
+ * The <code>Solution</code> objects of the swarm are still used to evaluate
+ * the particles: positions are written to them with
+ * <code>storePosition</code>, and read back with <code>loadPosition</code>
+ * after an operator (e.g. a mutation) has changed them.
+ */
+class ParticleSwarm
+{
+
+private:
+    int swarmSize_;
+    int numberOfVariables_;
+    std::vector<double> position_;
+    std::vector<double> velocity_;
+    std::vector<double> bestPosition_;
+    std::vector<double> lowerLimit_;
+    std::vector<double> upperLimit_;
+    std::vector<double> deltaMax_;
+    std::vector<double> deltaMin_;
+
+public:
+    ParticleSwarm(Problem * problem, int swarmSize);
+
+    int size();
+    int getNumberOfVariables();
+    double * getPosition(int i);
+    double * getVelocity(int i);
+    double * getBestPosition(int i);
+
+    void loadPosition(int i, Solution * solution);
+    void storePosition(int i, Solution * solution);
+    void saveBestPosition(int i);
+    void resetVelocities();
+
+    void updateVelocity(int i, const double * globalBest, double inertia,
+                        double c1r1, double c2r2, double constriction);
+    void constrainVelocity(int i);
+    void move(int i, double chVel1, double chVel2);
+
+    static void randDouble(double * values, int size, double minBound,
+                           double maxBound);
+
+}; // ParticleSwarm
+
+#endif
@@ -21,40 +21,38 @@
 #include <PermutationUtility.h>
 #include "JMetalHeader.h"
 
+/**
+ * Returns a new array with a random permutation, drawn from the random
+ * stream of the calling thread
+ * @param length Length of the permutation
+ */
 int * PermutationUtility::intPermutation(int length)
 {
-
-    int * aux    = snew int[length];
     int * result = snew int[length];
+    intPermutation(result, length, PseudoRandom::getRandomGenerator());
+    return result;
+} // intPermutation
 
-    // First, create an array from 0 to length - 1.
-    // Also is needed to create an random array of size length
-    for (int i = 0; i < length; i++)
-    {
-        result[i] = i;
-        aux[i] = PseudoRandom::randInt(0,length-1);
-    } // for
 
-    // Sort the random array with effect in result, and then we obtain a
-    // permutation array between 0 and length - 1
+/**
+ * Writes a random permutation into an array
+ * @param permutation Array of at least length elements
+ * @param length Length of the permutation
+ * @param generator Random stream to draw from
+ */
+void PermutationUtility::intPermutation(int * permutation, int length,
+                                        RandomGenerator * generator)
+{
     for (int i = 0; i < length; i++)
     {
-        for (int j = i + 1; j < length; j++)
-        {
-            if (aux[i] > aux[j])
-            {
-                int tmp;
-                tmp = aux[i];
-                aux[i] = aux[j];
-                aux[j] = tmp;
-                tmp = result[i];
-                result[i] = result[j];
-                result[j] = tmp;
-            } // if
-        } // for
-    } // for
-    delete[] aux;
-
-    return result;
+        permutation[i] = i;
+    }
 
-}
+    for (int i = length - 1; i > 0; i--)
+    {
+        int j = generator->rnd(0, i);
+        int tmp = permutation[i];
+        permutation[i] = permutation[j];
+        permutation[j] = tmp;
+    }
+} // intPermutation
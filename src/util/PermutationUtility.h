@@ -22,12 +22,19 @@
 #define PERMUTATIONUTILITY_H_
 
 #include <PseudoRandom.h>
+#include <RandomGenerator.h>
 
+/**
+ * Random permutations of the integers 0..length-1, generated with the
+ * Fisher-Yates shuffle in O(length)
+ */
 class PermutationUtility
 {
 
 public:
     int * intPermutation(int length);
+    static void intPermutation(int * permutation, int length,
+                               RandomGenerator * generator);
 
 };
 
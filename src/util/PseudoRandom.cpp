@@ -21,6 +21,8 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <PseudoRandom.h>
+#include <atomic>
+#include <memory>
 
 
 
@@ -30,49 +32,80 @@
  * random generator which will be accesible throug this interface.
  **/
 
-RandomGenerator * PseudoRandom::randomGenerator_ = nullptr ;
+thread_local RandomGenerator * PseudoRandom::randomGenerator_ = nullptr ;
+
+namespace
+{
+    // Generator created on demand for the current thread, released when the
+    // thread finishes
+    thread_local std::unique_ptr<RandomGenerator> ownedGenerator_;
+    // Number of on-demand generators created so far
+    std::atomic<unsigned long long> numberOfStreams_(0);
+    // Base value shared by all the on-demand streams of the process
+    const unsigned long long streamBase_ = (unsigned long long) time(nullptr);
+}
 
 PseudoRandom::PseudoRandom()
 {
-    //randomGenerator_ = nullptr ;
+    getRandomGenerator();
+}
+
+
+/**
+ * Returns the generator of the calling thread, creating it if needed
+ * @return The random generator used by the current thread
+ */
+RandomGenerator * PseudoRandom::getRandomGenerator()
+{
     if (PseudoRandom::randomGenerator_ == nullptr)
     {
-        PseudoRandom::randomGenerator_ = new RandomGenerator();
+        unsigned long long stream = numberOfStreams_++;
+        if (stream == 0)
+        {
+            ownedGenerator_.reset(new RandomGenerator());
+        }
+        else
+        {
+            ownedGenerator_.reset(new RandomGenerator(
+                RandomGenerator::streamSeed(streamBase_, stream)));
+        }
+        PseudoRandom::randomGenerator_ = ownedGenerator_.get();
     }
-}
+    return PseudoRandom::randomGenerator_;
+} // getRandomGenerator
 
-//static int PseudoRandom::randInt() {
-//    if (randomGenerator_ == nullptr) {
-//        new PseudoRandom();
-//    }
-//    return randomGenerator_->rando
-//}
 
-double PseudoRandom::randDouble()
+/**
+ * Installs the generator used by the calling thread. The generator is owned
+ * by the caller, which must keep it alive while the thread uses it.
+ * @param generator The generator, or nullptr to go back to the on-demand one
+ */
+void PseudoRandom::setRandomGenerator(RandomGenerator * generator)
 {
-    if (PseudoRandom::randomGenerator_ == nullptr)
+    if (generator == nullptr)
     {
-        PseudoRandom::randomGenerator_ = new RandomGenerator();
+        PseudoRandom::randomGenerator_ = ownedGenerator_.get();
     }
-    return PseudoRandom::randomGenerator_->rndreal(0.0,1.0);
+    else
+    {
+        PseudoRandom::randomGenerator_ = generator;
+    }
+} // setRandomGenerator
+
+
+double PseudoRandom::randDouble()
+{
+    return getRandomGenerator()->rndreal(0.0,1.0);
 }
 
 int PseudoRandom::randInt(int minBound, int maxBound)
 {
-    if (PseudoRandom::randomGenerator_ == nullptr)
-    {
-        PseudoRandom::randomGenerator_ = new RandomGenerator();
-    }
-    return PseudoRandom::randomGenerator_->rnd(minBound,maxBound);
+    return getRandomGenerator()->rnd(minBound,maxBound);
 }
 
 double PseudoRandom::randDouble(double minBound, double maxBound)
 {
-    if (PseudoRandom::randomGenerator_ == nullptr)
-    {
-        PseudoRandom::randomGenerator_ = new RandomGenerator();
-    }
-    return PseudoRandom::randomGenerator_->rndreal(minBound,maxBound);
+    return getRandomGenerator()->rndreal(minBound,maxBound);
 }
 
 
@@ -111,8 +144,21 @@ double PseudoRandom::randNormal(double mean, double standardDeviation)
  */
 double * PseudoRandom::randSphere(int dimension)
 {
-    int D = dimension ;
     double * x = snew double[dimension] ;
+    randSphere(dimension, x);
+    return x ;
+}
+
+
+/**
+ * Get a random point from an hypersphere (center = 0, radius = 1), writing
+ * it to a buffer supplied by the caller
+ * @param dimension
+ * @param x Array receiving the dimension coordinates of the point
+ */
+void PseudoRandom::randSphere(int dimension, double * x)
+{
+    int D = dimension ;
 
     double length = 0 ;
     for (int i = 0; i < dimension; i++)
@@ -136,7 +182,5 @@ double * PseudoRandom::randSphere(int dimension)
     {
         x[i]=r*x[i]/length;
     }
-
-    return x ;
 }
 
@@ -33,21 +33,29 @@
  * This file is aimed at defining the interface for the random generator.
  * The idea is that all the random numbers will be generated using a single
  * random generator which will be accesible throug this interface.
+ *
+ * Each thread owns its own generator: the first thread that asks for a random
+ * number gets the classical time-seeded generator, and any other thread gets
+ * an independent stream created on demand. Drivers that need reproducible
+ * streams per thread can install their own generator with
+ * <code>setRandomGenerator</code>.
  **/
 
 class PseudoRandom
 {
-//private:
 public:
-    static RandomGenerator * randomGenerator_;
+    static thread_local RandomGenerator * randomGenerator_;
     PseudoRandom();
 
 public:
+    static RandomGenerator * getRandomGenerator();
+    static void setRandomGenerator(RandomGenerator * generator);
     static double randDouble();//    static int randInt();
     static int randInt(int minBound, int maxBound);
     static double randDouble(double minBound, double maxBound);
     static double randNormal(double mean, double standardDeviation);
     static double * randSphere(int dimension);
+    static void randSphere(int dimension, double * x);
 };
 
 
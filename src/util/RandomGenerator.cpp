@@ -48,6 +48,42 @@ RandomGenerator::RandomGenerator()
     randomize();
 } // RandomGenerator
 
+
+/**
+ * Constructor
+ * @param seed Seed of the generator. It must belong to the interval (0, 1)
+ */
+RandomGenerator::RandomGenerator(double seed)
+{
+    seed_ = seed;
+    randomize();
+} // RandomGenerator
+
+
+RandomGenerator::~RandomGenerator()
+{
+} // ~RandomGenerator
+
+
+/**
+ * Computes the seed of an independent random stream. Each pair (base,
+ * stream) is scrambled with the SplitMix64 finalizer, so streams with
+ * consecutive indexes start from unrelated points of the (0, 1) interval.
+ * @param base Base value shared by a family of streams (e.g. a time stamp)
+ * @param stream Index of the stream
+ * @return A seed that can be passed to <code>RandomGenerator(double)</code>
+ */
+double RandomGenerator::streamSeed(unsigned long long base,
+                                   unsigned long long stream)
+{
+    unsigned long long z = base + (stream + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = z ^ (z >> 31);
+    // 53 random bits, shifted away from 0 to avoid a degenerate generator
+    return ((z >> 11) + 0.5) / 9007199254740992.0;
+} // streamSeed
+
 int RandomGenerator::rnd (int low, int high)
 {
     int res;
@@ -36,6 +36,9 @@
 class RandomGenerator
 {
 
+    // Saves and restores the state of the generator
+    friend class Checkpoint;
+
 private:
     double seed_;
     double oldrand_[55];
@@ -47,7 +50,9 @@ private:
 
 public:
     RandomGenerator(void);
+    RandomGenerator(double seed);
     ~RandomGenerator(void);
+    static double streamSeed(unsigned long long base, unsigned long long stream);
     int rnd (int low, int high);
     double rndreal(double low, double high);
 
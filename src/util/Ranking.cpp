@@ -22,6 +22,8 @@
 
 
 #include <Ranking.h>
+#include <Instrumentation.h>
+#include <Dominance.h>
 
 
 /**
@@ -39,12 +41,22 @@
  * Constructor.
  * @param solutionSet The <code>SolutionSet</code> to be ranked.
  */
-Ranking::Ranking (SolutionSet * solutionSet)
+Ranking::Ranking (SolutionSet * solutionSet) : Ranking(solutionSet, false)
 {
+} // Ranking
+
+
+/**
+ * Constructor.
+ * @param solutionSet The <code>SolutionSet</code> to be ranked.
+ * @param moveSolutions If true, the solutions are moved to the subfronts and
+ * <code>solutionSet</code> is left empty; otherwise they are copied.
+ */
+Ranking::Ranking (SolutionSet * solutionSet, bool moveSolutions)
+{
+    JMETAL_TIME_PHASE(RANKING);
 
     solutionSet_ = solutionSet;
-    dominance_   = new DominanceComparator();
-    constraint_  = new OverallConstraintViolationComparator();
 
     // dominateMe[i] contains the number of solutions dominating i
     int * dominateMe = snew int[solutionSet_->size()];
@@ -61,8 +73,14 @@ Ranking::Ranking (SolutionSet * solutionSet)
     // front[i] contains the list of individuals belonging to the front i
     VectorOfInteger * front = new VectorOfInteger[solutionSet_->size()+1];
 
-    // flagDominate is an auxiliar variable
-    int flagDominate;
+    // flagDominate[q] stores the dominance test of p against q
+    int size = solutionSet_->size();
+    std::vector<Solution *> solutions(size);
+    VectorOfInteger flagDominate(size);
+    for (int p = 0; p < size; p++)
+    {
+        solutions[p] = solutionSet_->get(p);
+    }
 
     //-> Fast non dominated sorting algorithm
     for (int p = 0; p < solutionSet_->size(); p++)
@@ -71,23 +89,19 @@ Ranking::Ranking (SolutionSet * solutionSet)
     }
 
     // For all q individuals , calculate if p dominates q or vice versa
-    for (int p = 0; p < (solutionSet_->size() - 1); p++)
+    for (int p = 0; p < (size - 1); p++)
     {
-        for (int q = p + 1; q < solutionSet_->size(); q++)
-        {
+        Dominance::compare(solutions[p], &solutions[p + 1], size - p - 1,
+                           &flagDominate[p + 1]);
 
-            flagDominate =constraint_->compare(solutionSet->get(p),solutionSet->get(q));
-            if (flagDominate == 0)
-            {
-                flagDominate =dominance_->compare(solutionSet->get(p),solutionSet->get(q));
-            } // if
-
-            if (flagDominate == -1)
+        for (int q = p + 1; q < size; q++)
+        {
+            if (flagDominate[q] == -1)
             {
                 iDominate[p].push_back(q);
                 dominateMe[q]++;
             }
-            else if (flagDominate == 1)
+            else if (flagDominate[q] == 1)
             {
                 iDominate[q].push_back(p);
                 dominateMe[p]++;
@@ -143,10 +157,22 @@ Ranking::Ranking (SolutionSet * solutionSet)
         ranking_[j] = new SolutionSet(front[j].size());
         for (it1=front[j].begin(); it1<front[j].end(); it1++)
         {
-            ranking_[j]->add(new Solution(solutionSet_->get(*it1)));
+            if (moveSolutions)
+            {
+                ranking_[j]->add(solutionSet_->get(*it1));
+            }
+            else
+            {
+                ranking_[j]->add(new Solution(solutionSet_->get(*it1)));
+            } // if
         } // for
     } // for
 
+    if (moveSolutions)
+    {
+        solutionSet_->clear();
+    }
+
     delete [] dominateMe;
     delete [] iDominate;
     delete [] front;
@@ -164,8 +190,6 @@ Ranking::~Ranking()
         delete ranking_[i];
     }
     delete [] ranking_;
-    delete dominance_;
-    delete constraint_;
 } // ~Ranking
 
 
@@ -37,6 +37,11 @@
  * numbering starts from 1); thus, subset 0 contains the non-dominated
  * solutions, subset 1 contains the non-dominated solutions after removing those
  * belonging to subset 0, and so on.
+ *
+ * By default the subsets hold copies of the ranked solutions. When the
+ * solutions are moved instead, the ranked set is left empty and the ranking
+ * takes the ownership of its solutions; those still in the subsets when the
+ * ranking is destroyed are deleted with it.
  */
 class Ranking
 {
@@ -45,11 +50,10 @@ private:
     SolutionSet * solutionSet_;
     SolutionSet ** ranking_;
     int numberOfSubfronts_;
-    DominanceComparator * dominance_;
-    OverallConstraintViolationComparator * constraint_;
 
 public:
     Ranking (SolutionSet * solutionSet);
+    Ranking (SolutionSet * solutionSet, bool moveSolutions);
     ~Ranking();
     SolutionSet * getSubfront(int rank);
     int getNumberOfSubfronts();
@@ -0,0 +1,261 @@
+//  SolutionHeap.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <SolutionHeap.h>
+
+
+/**
+ * Constructor.
+ * @param solutionSet The solution set indexed by the heap
+ * @param objective The objective used as key (lower values are better)
+ */
+SolutionHeap::SolutionHeap(SolutionSet * solutionSet, int objective)
+{
+    solutionSet_ = solutionSet;
+    objective_   = objective;
+    rebuild();
+} // SolutionHeap
+
+
+/**
+ * Returns the solution set indexed by the heap
+ */
+SolutionSet * SolutionHeap::getSolutionSet()
+{
+    return solutionSet_;
+} // getSolutionSet
+
+
+/**
+ * Returns the number of solutions indexed by the heap
+ */
+int SolutionHeap::size()
+{
+    return keys_.size();
+} // size
+
+
+/**
+ * Rebuilds both heaps from the current content of the solution set in O(N)
+ */
+void SolutionHeap::rebuild()
+{
+    int n = solutionSet_->size();
+
+    keys_.resize(n);
+    for (int i = 0; i < n; i++)
+    {
+        keys_[i] = solutionSet_->get(i)->getObjective(objective_);
+    } // for
+
+    for (int which = MIN_HEAP; which <= MAX_HEAP; which++)
+    {
+        heap_[which].resize(n);
+        location_[which].resize(n);
+        for (int i = 0; i < n; i++)
+        {
+            heap_[which][i]     = i;
+            location_[which][i] = i;
+        } // for
+        for (int i = n / 2 - 1; i >= 0; i--)
+        {
+            siftDown(which, i);
+        } // for
+    } // for
+} // rebuild
+
+
+/**
+ * Restores the heap property after the solution at a position of the set has
+ * changed its objective value
+ * @param index The position of the solution in the solution set
+ */
+void SolutionHeap::update(int index)
+{
+    keys_[index] = solutionSet_->get(index)->getObjective(objective_);
+    for (int which = MIN_HEAP; which <= MAX_HEAP; which++)
+    {
+        siftUp(which, location_[which][index]);
+        siftDown(which, location_[which][index]);
+    } // for
+} // update
+
+
+/**
+ * Stores a solution at a position of the solution set and updates the heap.
+ * The solution previously stored there is not deleted.
+ * @param index The position of the solution set
+ * @param solution The new solution
+ */
+void SolutionHeap::replace(int index, Solution * solution)
+{
+    solutionSet_->replace(index, solution);
+    update(index);
+} // replace
+
+
+/**
+ * Returns the position of the best solution (lowest key)
+ */
+int SolutionHeap::best()
+{
+    return heap_[MIN_HEAP][0];
+} // best
+
+
+/**
+ * Returns the position of the worst solution (highest key)
+ */
+int SolutionHeap::worst()
+{
+    return heap_[MAX_HEAP][0];
+} // worst
+
+
+/**
+ * Returns the positions of the k best solutions, best first
+ * @param k The number of solutions (not greater than the size of the set)
+ * @param indices Array receiving the k positions
+ */
+void SolutionHeap::best(int k, int * indices)
+{
+    top(MIN_HEAP, k, indices);
+} // best
+
+
+/**
+ * Returns the positions of the k worst solutions, worst first
+ * @param k The number of solutions (not greater than the size of the set)
+ * @param indices Array receiving the k positions
+ */
+void SolutionHeap::worst(int k, int * indices)
+{
+    top(MAX_HEAP, k, indices);
+} // worst
+
+
+/**
+ * Returns true if the solution at index1 goes closer to the root of the given
+ * heap than the solution at index2
+ */
+bool SolutionHeap::before(int which, int index1, int index2)
+{
+    if (keys_[index1] != keys_[index2])
+    {
+        return (which == MIN_HEAP) ? (keys_[index1] < keys_[index2])
+               : (keys_[index1] > keys_[index2]);
+    }
+    return index1 < index2;
+} // before
+
+
+void SolutionHeap::swap(int which, int location1, int location2)
+{
+    std::vector<int> & heap = heap_[which];
+    int index1 = heap[location1];
+    int index2 = heap[location2];
+    heap[location1] = index2;
+    heap[location2] = index1;
+    location_[which][index1] = location2;
+    location_[which][index2] = location1;
+} // swap
+
+
+void SolutionHeap::siftUp(int which, int location)
+{
+    std::vector<int> & heap = heap_[which];
+    while (location > 0)
+    {
+        int parent = (location - 1) / 2;
+        if (!before(which, heap[location], heap[parent]))
+        {
+            break;
+        }
+        swap(which, location, parent);
+        location = parent;
+    } // while
+} // siftUp
+
+
+void SolutionHeap::siftDown(int which, int location)
+{
+    std::vector<int> & heap = heap_[which];
+    int n = heap.size();
+    while (true)
+    {
+        int first = location;
+        int left  = 2 * location + 1;
+        int right = left + 1;
+        if ((left < n) && before(which, heap[left], heap[first]))
+        {
+            first = left;
+        }
+        if ((right < n) && before(which, heap[right], heap[first]))
+        {
+            first = right;
+        }
+        if (first == location)
+        {
+            break;
+        }
+        swap(which, location, first);
+        location = first;
+    } // while
+} // siftDown
+
+
+/**
+ * Extracts the first k positions of a heap without modifying it. The
+ * candidates are the children of the positions already taken, so the cost is
+ * O(k^2), which is negligible for the small k used by elitism.
+ */
+void SolutionHeap::top(int which, int k, int * indices)
+{
+    std::vector<int> & heap = heap_[which];
+    int n = heap.size();
+    std::vector<int> candidates;
+
+    if (n > 0)
+    {
+        candidates.push_back(0);
+    }
+    for (int r = 0; (r < k) && !candidates.empty(); r++)
+    {
+        int first = 0;
+        for (int c = 1; c < candidates.size(); c++)
+        {
+            if (before(which, heap[candidates[c]], heap[candidates[first]]))
+            {
+                first = c;
+            }
+        } // for
+        int location = candidates[first];
+        candidates.erase(candidates.begin() + first);
+        indices[r] = heap[location];
+        if (2 * location + 1 < n)
+        {
+            candidates.push_back(2 * location + 1);
+        }
+        if (2 * location + 2 < n)
+        {
+            candidates.push_back(2 * location + 2);
+        }
+    } // for
+} // top
@@ -0,0 +1,83 @@
+//  SolutionHeap.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __SOLUTION_HEAP__
+#define __SOLUTION_HEAP__
+
+#include <SolutionSet.h>
+#include <Solution.h>
+#include <vector>
+
+/**
+ * This class keeps an indexed min/max heap over the solutions of a
+ * <code>SolutionSet</code>, keyed on one of their objectives. The best and
+ * the worst solution are found in O(1) and a solution of the set can be
+ * replaced in place in O(log N), which is what steady-state replacement and
+ * elitism need. Ties are broken by position, so <code>best()</code> and
+ * <code>worst()</code> return the same index as a linear scan with an
+ * <code>ObjectiveComparator</code> would.
+ * The heap does not own the solutions. If the solution set is modified
+ * without going through <code>replace()</code>, <code>update()</code> or
+ * <code>rebuild()</code> must be called.
+ */
+class SolutionHeap
+{
+
+private:
+    enum { MIN_HEAP = 0, MAX_HEAP = 1 };
+
+    SolutionSet * solutionSet_;
+    int objective_;
+
+    /**
+     * Key of every position of the solution set
+     */
+    std::vector<double> keys_;
+
+    /**
+     * Positions of the solution set arranged as a min-heap and as a
+     * max-heap, and the location of every position inside each heap
+     */
+    std::vector<int> heap_[2];
+    std::vector<int> location_[2];
+
+    bool before(int which, int index1, int index2);
+    void swap(int which, int location1, int location2);
+    void siftUp(int which, int location);
+    void siftDown(int which, int location);
+    void top(int which, int k, int * indices);
+
+public:
+    SolutionHeap(SolutionSet * solutionSet, int objective = 0);
+
+    SolutionSet * getSolutionSet();
+    int size();
+    void rebuild();
+    void update(int index);
+    void replace(int index, Solution * solution);
+
+    int best();
+    int worst();
+    void best(int k, int * indices);
+    void worst(int k, int * indices);
+
+}; // SolutionHeap
+
+#endif /* __SOLUTION_HEAP__ */
@@ -0,0 +1,141 @@
+//  ThreadPool.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <ThreadPool.h>
+
+
+/**
+ * Constructor
+ * @param numberOfThreads Number of threads, including the calling one
+ */
+ThreadPool::ThreadPool(int numberOfThreads) : next_(0)
+{
+    size_ = 0;
+    active_ = 0;
+    round_ = 0;
+    stop_ = false;
+    for (int i = 1; i < numberOfThreads; i++)
+    {
+        workers_.push_back(std::thread(&ThreadPool::work, this));
+    }
+} // ThreadPool
+
+
+/**
+ * Destructor
+ */
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_.notify_all();
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+} // ~ThreadPool
+
+
+/**
+ * Returns the number of threads of the pool, including the calling one
+ */
+int ThreadPool::getNumberOfThreads()
+{
+    return workers_.size() + 1;
+} // getNumberOfThreads
+
+
+/**
+ * Runs task(i) for every i in [0, size) and returns when all of them have
+ * finished. The tasks must not call parallelFor on the same pool.
+ * @param size Number of iterations
+ * @param task Body of the loop
+ */
+void ThreadPool::parallelFor(int size, std::function<void(int)> task)
+{
+    if (workers_.empty() || size <= 1)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_ = task;
+        size_ = size;
+        next_ = 0;
+        active_ = workers_.size();
+        round_++;
+    }
+    start_.notify_all();
+
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    finish_.wait(lock, [this] { return active_ == 0; });
+    task_ = nullptr;
+} // parallelFor
+
+
+/**
+ * Main loop of the worker threads
+ */
+void ThreadPool::work()
+{
+    unsigned long lastRound = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_.wait(lock, [this, lastRound] { return stop_ || round_ != lastRound; });
+            if (stop_)
+            {
+                return;
+            }
+            lastRound = round_;
+        }
+
+        runTasks();
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            active_--;
+        }
+        finish_.notify_one();
+    }
+} // work
+
+
+/**
+ * Takes pending iterations of the current loop until there are no more
+ */
+void ThreadPool::runTasks()
+{
+    int i;
+    while ((i = next_++) < size_)
+    {
+        task_(i);
+    }
+} // runTasks
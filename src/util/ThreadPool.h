@@ -0,0 +1,63 @@
+//  ThreadPool.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __THREAD_POOL__
+#define __THREAD_POOL__
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * This class implements a fixed set of worker threads used to run the
+ * iterations of a loop concurrently. The calling thread takes part in the
+ * work, so a pool of N threads starts N-1 workers. Tasks are handed out
+ * dynamically, one index at a time.
+ */
+class ThreadPool
+{
+
+private:
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable finish_;
+    std::function<void(int)> task_;
+    std::atomic<int> next_;
+    int size_;
+    int active_;
+    unsigned long round_;
+    bool stop_;
+
+    void work();
+    void runTasks();
+
+public:
+    ThreadPool(int numberOfThreads);
+    ~ThreadPool();
+    int getNumberOfThreads();
+    void parallelFor(int size, std::function<void(int)> task);
+
+}; // ThreadPool
+
+#endif
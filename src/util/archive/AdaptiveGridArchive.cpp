@@ -19,6 +19,8 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <AdaptiveGridArchive.h>
+#include <Instrumentation.h>
+#include <Dominance.h>
 
 /**
  * Constructor.
@@ -33,7 +35,6 @@ AdaptiveGridArchive::AdaptiveGridArchive (int maxSize,int bisections,
 {
 
     maxSize_   = maxSize;
-    dominance_ = snew DominanceComparator();
     grid_      = snew AdaptiveGrid(bisections,objectives);
 }
 
@@ -51,33 +52,53 @@ AdaptiveGridArchive::AdaptiveGridArchive (int maxSize,int bisections,
 
 bool AdaptiveGridArchive::add(Solution * solution, int eval)
 {
+    JMETAL_TIME_PHASE(ARCHIVE);
+
     int i=0;
     Solution * aux; //Store an solution temporally
 
-    while (i < solutionsList_.size())
+    int n = solutionsList_.size();
+    flags_.resize(n);
+    Dominance::compare(solution, solutionsList_.data(), n, flags_.data());
+
+    for (i = 0; i < n; i++)
+    {
+        if (flags_[i] == 1)   // An Individual into the file dominates the
+        {
+            // solution to insert
+            return false; // The solution will not be inserted
+        } // if
+    } // for
+
+    // Remove the dominated individuals. The grid is rebuilt once from the
+    // remaining ones if any of them was alone in its hypercube
+    int kept = 0;
+    bool rebuild = false;
+    for (i = 0; i < n; i++)
     {
         aux = solutionsList_[i];
-        int flag = dominance_->compare(solution,aux);
-        if (flag == -1)   // The Individual to insert dominates other
+        if (flags_[i] == -1)   // The Individual to insert dominates other
         {
-            solutionsList_.erase (solutionsList_.begin()+i); //Delete it from the archive
             int location = grid_->location(aux);
-            if (grid_->getLocationDensity(location) > 1)  //The hypercube contains
+            if (!rebuild && (grid_->getLocationDensity(location) > 1))  //The hypercube contains
             {
                 grid_->removeSolution(location);            //more than one individual
             }
             else
             {
-                grid_->updateGrid(this);
+                rebuild = true;
             } // else
         } // if
-        else if (flag == 1)   // An Individual into the file dominates the
+        else
         {
-            // solution to insert
-            return false; // The solution will not be inserted
-        } // else if
-        i++;
-    } // while
+            solutionsList_[kept++] = aux;
+        } // else
+    } // for
+    solutionsList_.resize(kept); //Delete the dominated ones from the archive
+    if (rebuild)
+    {
+        grid_->updateGrid(this);
+    } // if
 
     // At this point, the solution may be inserted
     if (size() == 0)  //The archive is empty
@@ -26,6 +26,7 @@
 #include <AdaptiveGrid.h>
 #include <Archive.h>
 #include <iostream>
+#include <vector>
 
 /**
  * This class implements an archive based on an adaptive grid used in PAES
@@ -46,9 +47,9 @@ private:
     int maxSize_;
 
     /**
-     * Stores a <code>Comparator</code> for dominance checking
+     * Reusable buffer with the dominance flags of the last insertion
      */
-    Comparator * dominance_;
+    std::vector<int> flags_;
 
 public:
     AdaptiveGridArchive(int maxSize,int bisections, int objectives);
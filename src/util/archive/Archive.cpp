@@ -20,6 +20,7 @@
 
 
 #include <Archive.h>
+#include <Hash.h>
 
 
 /**
@@ -35,3 +36,40 @@ Archive::Archive(int size) : SolutionSet(size)
     //do nothing.
 } // Archive
 
+
+/**
+ * Records the objective hash of a solution entering the archive
+ * @param solution The solution
+ */
+void Archive::insertHash(Solution * solution)
+{
+    objectiveHashes_.insert(Hash::objectives(solution));
+} // insertHash
+
+
+/**
+ * Removes the objective hash of a solution leaving the archive. It must be
+ * called before the solution is deleted.
+ * @param solution The solution
+ */
+void Archive::eraseHash(Solution * solution)
+{
+    std::unordered_multiset<unsigned long long>::iterator it =
+        objectiveHashes_.find(Hash::objectives(solution));
+    if (it != objectiveHashes_.end())
+    {
+        objectiveHashes_.erase(it);
+    }
+} // eraseHash
+
+
+/**
+ * Checks whether some member may have the given objective hash
+ * @param hash The hash
+ * @return false if no member has those objective values
+ */
+bool Archive::containsHash(unsigned long long hash)
+{
+    return objectiveHashes_.count(hash) > 0;
+} // containsHash
+
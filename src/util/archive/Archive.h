@@ -22,6 +22,7 @@
 #define __ARCHIVE__
 
 #include <SolutionSet.h>
+#include <unordered_set>
 
 /**
  * This class represents the super class for archive objects.
@@ -29,6 +30,19 @@
 class Archive : public SolutionSet
 {
 
+protected:
+
+    /**
+     * Hashes of the objective values of the members (see <code>Hash</code>).
+     * A new solution is only compared with the members when its hash is
+     * found here. Subclasses keep it up to date as members enter and leave.
+     */
+    std::unordered_multiset<unsigned long long> objectiveHashes_;
+
+    void insertHash(Solution * solution);
+    void eraseHash(Solution * solution);
+    bool containsHash(unsigned long long hash);
+
 public:
     Archive(int size);
 
@@ -19,6 +19,10 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <CrowdingArchive.h>
+#include <Instrumentation.h>
+#include <Dominance.h>
+#include <Hash.h>
+#include <algorithm>
 
 /**
  * This class implements a bounded archive based on crowding distances (as
@@ -36,10 +40,8 @@ CrowdingArchive::CrowdingArchive(int maxSize, int numberOfObjectives)
 
     this->maxSize          = maxSize;
     this->objectives       = numberOfObjectives;
-    this->dominance        = snew DominanceComparator();
     this->equals           = snew EqualSolutions();
-    this->crowdingDistance = snew CrowdingDistanceComparator();
-    this->distance         = snew Distance();
+    this->truncation       = snew CrowdingTruncation(numberOfObjectives);
 
 } // CrowdingArchive
 
@@ -49,10 +51,8 @@ CrowdingArchive::CrowdingArchive(int maxSize, int numberOfObjectives)
 CrowdingArchive::~CrowdingArchive()
 {
 
-    delete dominance;
     delete equals;
-    delete crowdingDistance;
-    delete distance;
+    delete truncation;
 
 } // ~CrowdingArchive
 
@@ -61,56 +61,82 @@ CrowdingArchive::~CrowdingArchive()
  * is dominated by any member of the archive, then it is discarded. If the
  * <code>Solution</code> dominates some members of the archive, these are
  * removed. If the archive is full and the <code>Solution</code> has to be
- * inserted, the solutions are sorted by crowding distance and the one having
- * the minimum crowding distance value.
+ * inserted, the one having the minimum crowding distance value is removed.
+ * The crowding distances are maintained incrementally by a
+ * <code>CrowdingTruncation</code> as the members change.
  * @param solution The <code>Solution</code>
  * @return true if the <code>Solution</code> has been inserted, false
  * otherwise.
  */
 bool CrowdingArchive::add(Solution *solution)
 {
-    int flag = 0;
-    int i = 0;
-    Solution * aux; //Store an solution temporally
-    while (i < solutionsList_.size())
-    {
-        aux = solutionsList_[i];
+    JMETAL_TIME_PHASE(ARCHIVE);
 
-        flag = dominance->compare(solution,aux);
-        if (flag == 1)                 // The solution to add is dominated
-        {
-            return false;                // Discard the new solution
-        }
-        else if (flag == -1)           // A solution in the archive is dominated
+    // The archive is mutually non-dominated: a single batch query against
+    // all its members decides whether the solution is inserted
+    int n = solutionsList_.size();
+    flags.resize(n);
+    Dominance::compare(solution, solutionsList_.data(), n, flags.data());
+
+    for (int i = 0; i < n; i++)
+    {
+        if (flags[i] == 1)            // The solution to add is dominated
         {
-            // Remove it from the population
-            delete aux;
-            solutionsList_.erase (solutionsList_.begin()+i);
+            return false;               // Discard the new solution
         }
-        else
+    }
+    // Only a member with the same objective hash can be equal to the new
+    // solution
+    unsigned long long hash = Hash::objectives(solution);
+    if (containsHash(hash))
+    {
+        for (int i = 0; i < n; i++)
         {
-            if (equals->compare(aux,solution)==0)
+            if ((flags[i] == 0) && (equals->compare(solutionsList_[i],solution)==0))
             {
                 // There is an equal solution in the population
                 return false; // Discard the new solution
             }  // if
-            i++;
         }
     }
+
+    // Remove the solutions dominated by the new one
+    int kept = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (flags[i] == -1)
+        {
+            eraseHash(solutionsList_[i]);
+            truncation->erase(solutionsList_[i]);
+            delete solutionsList_[i];
+        }
+        else
+        {
+            solutionsList_[kept++] = solutionsList_[i];
+        }
+    }
+    solutionsList_.resize(kept);
+
     // Insert the solution into the archive
     bool res = true;
     solutionsList_.push_back(solution);
+    objectiveHashes_.insert(hash);
+    truncation->insert(solution);
     if (size() > maxSize)   // The archive is full
     {
-        distance->crowdingDistanceAssignment(this,objectives);
-        int indexWorst_ = indexWorst(crowdingDistance);
-        if (solution == solutionsList_[indexWorst_])
+        truncation->assignCrowdingDistances();
+        Solution * worst = truncation->worst();
+        truncation->erase(worst);
+        eraseHash(worst);
+        int indexWorst_ = std::find(solutionsList_.begin(), solutionsList_.end(),
+                                    worst) - solutionsList_.begin();
+        if (solution == worst)
         {
             res = false;
         }
         else
         {
-            delete solutionsList_[indexWorst_];
+            delete worst;
         }
         remove(indexWorst_);
     }
@@ -23,11 +23,11 @@
 
 #include <Archive.h>
 #include <Comparator.h>
-#include <CrowdingDistanceComparator.h>
-#include <Distance.h>
+#include <CrowdingTruncation.h>
 #include <DominanceComparator.h>
 #include <EqualSolutions.h>
 #include <Solution.h>
+#include <vector>
 
 /**
  * This class implements a bounded archive based on crowding distances (as
@@ -39,10 +39,9 @@ class CrowdingArchive : public Archive
 private:
     int maxSize;
     int objectives;
-    Comparator *dominance;
     Comparator *equals;
-    Comparator *crowdingDistance;
-    Distance *distance;
+    CrowdingTruncation *truncation;
+    std::vector<int> flags;
 
 public:
     CrowdingArchive(int maxSize, int numberOfObjectives);
@@ -21,6 +21,7 @@
 //  along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <DominanceComparator.h>
+#include <Dominance.h>
 
 /**
   * @class DominanceComparator
@@ -36,7 +37,6 @@
  */
 DominanceComparator::DominanceComparator() : Comparator()
 {
-    overallConstraintViolationComparator_ = snew OverallConstraintViolationComparator();
 } // DominanceComparator
 
 
@@ -45,7 +45,6 @@ DominanceComparator::DominanceComparator() : Comparator()
  */
 DominanceComparator::~DominanceComparator()
 {
-    delete overallConstraintViolationComparator_;
 } // ~DominanceComparator
 
 
@@ -64,65 +63,6 @@ int DominanceComparator::compare(void * o1, void * o2)
     else if (o2 == nullptr)
         return -1;
 
-    Solution * one = (Solution *) o1;
-    Solution * two = (Solution *) o2;
-
-    int dominate1 ; // dominate1 indicates if some objective of solution1
-    // dominates the same objective in solution2. dominate2
-    int dominate2 ; // is the complementary of dominate1.
-
-    dominate1 = 0 ;
-    dominate2 = 0 ;
-
-    int flag; //stores the result of the comparison
-
-    if (one->getOverallConstraintViolation()!=
-            two->getOverallConstraintViolation() &&
-            ((one->getOverallConstraintViolation() < 0) ||
-             (two->getOverallConstraintViolation() < 0)))
-    {
-        int returnValue = overallConstraintViolationComparator_->compare(one,two);
-        return returnValue;
-    }
-
-    // Equal number of violated constraints. Applying a dominance Test then
-    double value1, value2;
-    for (int i = 0; i < one->getNumberOfObjectives(); i++)
-    {
-        value1 = one->getObjective(i);
-        value2 = two->getObjective(i);
-        if (value1 < value2)
-        {
-            flag = -1;
-        }
-        else if (value1 > value2)
-        {
-            flag = 1;
-        }
-        else
-        {
-            flag = 0;
-        }
-
-        if (flag == -1)
-        {
-            dominate1 = 1;
-        }
-
-        if (flag == 1)
-        {
-            dominate2 = 1;
-        }
-    }
-
-    if (dominate1 == dominate2)
-    {
-        return 0; //No one dominate the other
-    }
-    if (dominate1 == 1)
-    {
-        return -1; // solution1 dominate
-    }
-    return 1;    // solution2 dominate
+    return Dominance::compare((Solution *) o1, (Solution *) o2);
 
 } // compare
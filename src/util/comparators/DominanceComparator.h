@@ -35,9 +35,6 @@
 class DominanceComparator : public Comparator
 {
 
-private:
-    Comparator * overallConstraintViolationComparator_;
-
 public:
     DominanceComparator();
     ~DominanceComparator();
@@ -0,0 +1,100 @@
+//  SolutionOrder.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __SOLUTION_ORDER__
+#define __SOLUTION_ORDER__
+
+#include <Comparator.h>
+#include <Solution.h>
+
+/**
+ * Typed "less than" predicates over solutions. They define the same orders
+ * as the corresponding <code>Comparator</code> classes, but they are plain
+ * function objects: they can be inlined by std::sort and std::stable_sort,
+ * and they can be used with <code>SolutionSet::sortBy</code>.
+ */
+
+/**
+ * Order of ObjectiveComparator: by the value of an objective
+ */
+struct ObjectiveOrder
+{
+    int objective;
+    bool ascending;
+
+    ObjectiveOrder(int objective, bool descendingOrder = false)
+        : objective(objective), ascending(!descendingOrder) { }
+
+    bool operator()(Solution * one, Solution * two) const
+    {
+        if (ascending)
+        {
+            return one->getObjective(objective) < two->getObjective(objective);
+        }
+        return one->getObjective(objective) > two->getObjective(objective);
+    }
+}; // ObjectiveOrder
+
+
+/**
+ * Order of CrowdingDistanceComparator: largest crowding distance first
+ */
+struct CrowdingDistanceOrder
+{
+    bool operator()(Solution * one, Solution * two) const
+    {
+        return one->getCrowdingDistance() > two->getCrowdingDistance();
+    }
+}; // CrowdingDistanceOrder
+
+
+/**
+ * Order of CrowdingComparator: lowest rank first and, within the same rank,
+ * largest crowding distance first
+ */
+struct CrowdingOrder
+{
+    bool operator()(Solution * one, Solution * two) const
+    {
+        if (one->getRank() != two->getRank())
+        {
+            return one->getRank() < two->getRank();
+        }
+        return one->getCrowdingDistance() > two->getCrowdingDistance();
+    }
+}; // CrowdingOrder
+
+
+/**
+ * Adapts any <code>Comparator</code> to a typed predicate
+ */
+struct ComparatorOrder
+{
+    Comparator * comparator;
+
+    ComparatorOrder(Comparator * comparator) : comparator(comparator) { }
+
+    bool operator()(Solution * one, Solution * two) const
+    {
+        return comparator->compare(one, two) < 0;
+    }
+}; // ComparatorOrder
+
+#endif /* __SOLUTION_ORDER__ */
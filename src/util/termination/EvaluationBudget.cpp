@@ -0,0 +1,38 @@
+//  EvaluationBudget.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <EvaluationBudget.h>
+
+
+/**
+ * Constructor
+ * @param maxEvaluations The number of evaluations of a run
+ */
+EvaluationBudget::EvaluationBudget(long maxEvaluations)
+    : TerminationCriterion("EvaluationBudget")
+{
+    maxEvaluations_ = maxEvaluations;
+} // EvaluationBudget
+
+
+bool EvaluationBudget::isMet(SolutionSet * population, long evaluations)
+{
+    return evaluations >= maxEvaluations_;
+} // isMet
@@ -0,0 +1,43 @@
+//  EvaluationBudget.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __EVALUATION_BUDGET__
+#define __EVALUATION_BUDGET__
+
+#include <TerminationCriterion.h>
+
+/**
+ * This class stops an algorithm after a number of evaluations. It is useful
+ * to give a run a smaller budget than its "maxEvaluations" parameter, e.g.
+ * together with other criteria.
+ */
+class EvaluationBudget : public TerminationCriterion
+{
+
+private:
+    long maxEvaluations_;
+
+public:
+    EvaluationBudget(long maxEvaluations);
+    bool isMet(SolutionSet * population, long evaluations);
+
+}; // EvaluationBudget
+
+#endif
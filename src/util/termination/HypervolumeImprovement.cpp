@@ -0,0 +1,53 @@
+//  HypervolumeImprovement.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <HypervolumeImprovement.h>
+#include <cmath>
+
+
+/**
+ * Constructor
+ * @param referencePoint The reference point, one value per objective
+ * @param generations Number of consecutive checks without improvement
+ * @param threshold The smallest relative increase that is an improvement
+ */
+HypervolumeImprovement::HypervolumeImprovement(
+    const std::vector<double> & referencePoint, int generations, double threshold)
+    : IndicatorImprovement("HypervolumeImprovement", generations, threshold, false)
+{
+    referencePoint_ = referencePoint;
+} // HypervolumeImprovement
+
+
+double HypervolumeImprovement::computeIndicator(SolutionSet * population)
+{
+    points_.assign(population);
+    if (points_.getNumberOfObjectives() != referencePoint_.size())
+    {
+        std::cout << "HypervolumeImprovement: the reference point has "
+                  << referencePoint_.size() << " objectives instead of "
+                  << points_.getNumberOfObjectives() << std::endl;
+        exit(-1);
+    }
+    double hypervolume = engine_.compute(points_.data(), points_.size(),
+                                         points_.getNumberOfObjectives(),
+                                         referencePoint_.data());
+    return (hypervolume > 0.0) ? hypervolume : NAN;
+} // computeIndicator
@@ -0,0 +1,53 @@
+//  HypervolumeImprovement.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __HYPERVOLUME_IMPROVEMENT__
+#define __HYPERVOLUME_IMPROVEMENT__
+
+#include <IndicatorImprovement.h>
+#include <FrontBuffer.h>
+#include <HypervolumeEngine.h>
+#include <vector>
+
+/**
+ * This class stops an algorithm when the hypervolume of its population,
+ * bounded by a fixed reference point, stops improving. The hypervolume is
+ * computed with <code>HypervolumeEngine</code>, in O(n log n) with two or
+ * three objectives. The checks made before some solution dominates the
+ * reference point do not count.
+ */
+class HypervolumeImprovement : public IndicatorImprovement
+{
+
+private:
+    std::vector<double> referencePoint_;
+    FrontBuffer points_;
+    HypervolumeEngine engine_;
+
+protected:
+    double computeIndicator(SolutionSet * population);
+
+public:
+    HypervolumeImprovement(const std::vector<double> & referencePoint,
+                           int generations, double threshold);
+
+}; // HypervolumeImprovement
+
+#endif
@@ -0,0 +1,75 @@
+//  IGDPlusImprovement.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <IGDPlusImprovement.h>
+#include <MetricsUtil.h>
+#include <algorithm>
+#include <cmath>
+
+
+/**
+ * Constructor
+ * @param referenceFront The file of the reference front
+ * @param generations Number of consecutive checks without improvement
+ * @param threshold The smallest relative decrease that is an improvement
+ */
+IGDPlusImprovement::IGDPlusImprovement(std::string referenceFront,
+                                       int generations, double threshold)
+    : IndicatorImprovement("IGDPlusImprovement", generations, threshold, true)
+{
+    MetricsUtil utilities;
+    referenceFront_.assign(utilities.readFront(referenceFront));
+} // IGDPlusImprovement
+
+
+double IGDPlusImprovement::computeIndicator(SolutionSet * population)
+{
+    points_.assign(population);
+    int numberOfObjectives = points_.getNumberOfObjectives();
+    if (numberOfObjectives != referenceFront_.getNumberOfObjectives())
+    {
+        std::cout << "IGDPlusImprovement: the reference front has "
+                  << referenceFront_.getNumberOfObjectives()
+                  << " objectives instead of " << numberOfObjectives << std::endl;
+        exit(-1);
+    }
+
+    const double * points = points_.data();
+    int size = points_.size();
+    double sum = 0.0;
+    for (int r = 0; r < referenceFront_.size(); r++)
+    {
+        const double * reference = referenceFront_.row(r);
+        double nearest = INFINITY;
+        for (int i = 0; i < size; i++)
+        {
+            const double * point = points + i * numberOfObjectives;
+            double distance = 0.0;
+            for (int j = 0; j < numberOfObjectives; j++)
+            {
+                double difference = std::max(point[j] - reference[j], 0.0);
+                distance += difference * difference;
+            }
+            nearest = std::min(nearest, distance);
+        }
+        sum += sqrt(nearest);
+    }
+    return sum / referenceFront_.size();
+} // computeIndicator
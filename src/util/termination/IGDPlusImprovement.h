@@ -0,0 +1,53 @@
+//  IGDPlusImprovement.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __IGD_PLUS_IMPROVEMENT__
+#define __IGD_PLUS_IMPROVEMENT__
+
+#include <IndicatorImprovement.h>
+#include <FrontBuffer.h>
+#include <string>
+
+/**
+ * This class stops an algorithm when the IGD+ of its population with
+ * respect to a reference front stops improving. IGD+ is the average, over
+ * the points of the reference front, of the distance to the nearest
+ * solution counting only the objectives in which the solution is worse
+ * (Ishibuchi et al., 2015). A check costs O(r n m) for a reference front of
+ * r points, so a large front is better checked less often (see
+ * <code>setCheckInterval</code>).
+ */
+class IGDPlusImprovement : public IndicatorImprovement
+{
+
+private:
+    FrontBuffer referenceFront_;
+    FrontBuffer points_;
+
+protected:
+    double computeIndicator(SolutionSet * population);
+
+public:
+    IGDPlusImprovement(std::string referenceFront, int generations,
+                       double threshold);
+
+}; // IGDPlusImprovement
+
+#endif
@@ -0,0 +1,94 @@
+//  IndicatorImprovement.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <IndicatorImprovement.h>
+#include <cmath>
+
+
+/**
+ * Constructor
+ * @param name The name of the criterion
+ * @param generations Number of consecutive checks without improvement
+ * @param threshold The smallest relative change that is an improvement
+ * @param minimize True if lower values of the indicator are better
+ */
+IndicatorImprovement::IndicatorImprovement(std::string name, int generations,
+        double threshold, bool minimize) : TerminationCriterion(name)
+{
+    generations_ = generations;
+    threshold_ = threshold;
+    minimize_ = minimize;
+    started_ = false;
+    best_ = 0.0;
+    last_ = 0.0;
+    stalled_ = 0;
+} // IndicatorImprovement
+
+
+void IndicatorImprovement::start()
+{
+    TerminationCriterion::start();
+    started_ = false;
+    stalled_ = 0;
+} // start
+
+
+bool IndicatorImprovement::isMet(SolutionSet * population, long evaluations)
+{
+    if ((population->size() == 0) || !isCheckDue(population, evaluations))
+    {
+        return false;
+    }
+
+    last_ = computeIndicator(population);
+    if (std::isnan(last_))
+    {
+        started_ = false;
+        stalled_ = 0;
+        return false;
+    }
+    if (!started_)
+    {
+        started_ = true;
+        best_ = last_;
+        return false;
+    }
+
+    double improvement = minimize_ ? (best_ - last_) : (last_ - best_);
+    if (improvement > threshold_ * fabs(best_))
+    {
+        best_ = last_;
+        stalled_ = 0;
+    }
+    else
+    {
+        stalled_++;
+    }
+    return stalled_ >= generations_;
+} // isMet
+
+
+/**
+ * Returns the value of the indicator at the last check
+ */
+double IndicatorImprovement::getLastValue()
+{
+    return last_;
+} // getLastValue
@@ -0,0 +1,60 @@
+//  IndicatorImprovement.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __INDICATOR_IMPROVEMENT__
+#define __INDICATOR_IMPROVEMENT__
+
+#include <TerminationCriterion.h>
+
+/**
+ * This class is the base of the criteria that stop an algorithm when a
+ * quality indicator of its population has not improved by more than a
+ * relative threshold for a number of consecutive checks. The improvement is
+ * measured against the last value that was a significant improvement, so a
+ * slow but steady progress is still noticed.
+ *
+ * Subclasses compute the indicator in <code>computeIndicator</code>, which
+ * returns NAN while it is not meaningful yet; those checks do not count.
+ */
+class IndicatorImprovement : public TerminationCriterion
+{
+
+private:
+    int generations_;
+    double threshold_;
+    bool minimize_;
+    bool started_;
+    double best_;
+    double last_;
+    int stalled_;
+
+protected:
+    virtual double computeIndicator(SolutionSet * population) = 0;
+
+public:
+    IndicatorImprovement(std::string name, int generations, double threshold,
+                         bool minimize);
+    void start();
+    bool isMet(SolutionSet * population, long evaluations);
+    double getLastValue();
+
+}; // IndicatorImprovement
+
+#endif
@@ -0,0 +1,123 @@
+//  Stagnation.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <Stagnation.h>
+#include <algorithm>
+#include <cmath>
+
+
+/**
+ * Constructor
+ * @param generations Number of consecutive checks without a move
+ * @param tolerance The largest relative change that is not a move
+ */
+Stagnation::Stagnation(int generations, double tolerance)
+    : TerminationCriterion("Stagnation")
+{
+    generations_ = generations;
+    tolerance_ = tolerance;
+    stalled_ = 0;
+} // Stagnation
+
+
+void Stagnation::start()
+{
+    TerminationCriterion::start();
+    stalled_ = 0;
+    ideal_.clear();
+    nadir_.clear();
+} // start
+
+
+/**
+ * Computes in newIdeal_ the ideal point of a population and in newNadir_
+ * the worst values of its extreme solutions
+ */
+void Stagnation::computeBounds(SolutionSet * population)
+{
+    int numberOfObjectives = population->get(0)->getNumberOfObjectives();
+    newIdeal_.assign(numberOfObjectives, INFINITY);
+    extreme_.assign(numberOfObjectives, 0);
+    for (int i = 0; i < population->size(); i++)
+    {
+        const double * objectives = population->get(i)->getObjectives();
+        for (int j = 0; j < numberOfObjectives; j++)
+        {
+            if (objectives[j] < newIdeal_[j])
+            {
+                newIdeal_[j] = objectives[j];
+                extreme_[j] = i;
+            }
+        }
+    }
+
+    newNadir_.assign(numberOfObjectives, -INFINITY);
+    for (int k = 0; k < numberOfObjectives; k++)
+    {
+        const double * objectives = population->get(extreme_[k])->getObjectives();
+        for (int j = 0; j < numberOfObjectives; j++)
+        {
+            newNadir_[j] = std::max(newNadir_[j], objectives[j]);
+        }
+    }
+} // computeBounds
+
+
+bool Stagnation::isMet(SolutionSet * population, long evaluations)
+{
+    if ((population->size() == 0) || !isCheckDue(population, evaluations))
+    {
+        return false;
+    }
+
+    computeBounds(population);
+    if (ideal_.empty())
+    {
+        ideal_.swap(newIdeal_);
+        nadir_.swap(newNadir_);
+        return false;
+    }
+
+    double change = 0.0;
+    for (int j = 0; j < ideal_.size(); j++)
+    {
+        // With a single objective both points are the same, and the change
+        // is relative to the value itself
+        double scale = newNadir_[j] - newIdeal_[j];
+        if (scale <= 0.0)
+        {
+            scale = std::max(fabs(newIdeal_[j]), 1.0);
+        }
+        change = std::max(change, fabs(newIdeal_[j] - ideal_[j]) / scale);
+        change = std::max(change, fabs(newNadir_[j] - nadir_[j]) / scale);
+    }
+    ideal_.swap(newIdeal_);
+    nadir_.swap(newNadir_);
+
+    if (change <= tolerance_)
+    {
+        stalled_++;
+    }
+    else
+    {
+        stalled_ = 0;
+    }
+    return stalled_ >= generations_;
+} // isMet
@@ -0,0 +1,57 @@
+//  Stagnation.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __STAGNATION__
+#define __STAGNATION__
+
+#include <TerminationCriterion.h>
+#include <vector>
+
+/**
+ * This class stops an algorithm when the ideal and nadir points of its
+ * population have not moved for a number of consecutive checks. A move is
+ * measured in each objective relative to the distance between both points.
+ *
+ * The nadir point is estimated from the extreme solutions (the best one in
+ * each objective), so a check costs a single pass over the population.
+ */
+class Stagnation : public TerminationCriterion
+{
+
+private:
+    int generations_;
+    double tolerance_;
+    int stalled_;
+    std::vector<double> ideal_;
+    std::vector<double> nadir_;
+    std::vector<double> newIdeal_;
+    std::vector<double> newNadir_;
+    std::vector<int> extreme_;
+
+    void computeBounds(SolutionSet * population);
+
+public:
+    Stagnation(int generations, double tolerance);
+    void start();
+    bool isMet(SolutionSet * population, long evaluations);
+
+}; // Stagnation
+
+#endif
@@ -0,0 +1,46 @@
+//  TargetFitness.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <TargetFitness.h>
+
+
+/**
+ * Constructor
+ * @param target The value of the objective to reach
+ */
+TargetFitness::TargetFitness(double target) : TerminationCriterion("TargetFitness")
+{
+    target_ = target;
+} // TargetFitness
+
+
+bool TargetFitness::isMet(SolutionSet * population, long evaluations)
+{
+    for (int i = 0; i < population->size(); i++)
+    {
+        Solution * solution = population->get(i);
+        if ((solution->getObjective(0) <= target_) &&
+                (solution->getNumberOfViolatedConstraints() == 0))
+        {
+            return true;
+        }
+    }
+    return false;
+} // isMet
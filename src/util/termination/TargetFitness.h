@@ -0,0 +1,42 @@
+//  TargetFitness.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __TARGET_FITNESS__
+#define __TARGET_FITNESS__
+
+#include <TerminationCriterion.h>
+
+/**
+ * This class stops a single-objective algorithm when a feasible solution of
+ * its population reaches a target value of the objective (minimization).
+ */
+class TargetFitness : public TerminationCriterion
+{
+
+private:
+    double target_;
+
+public:
+    TargetFitness(double target);
+    bool isMet(SolutionSet * population, long evaluations);
+
+}; // TargetFitness
+
+#endif
@@ -0,0 +1,95 @@
+//  TerminationCriterion.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <TerminationCriterion.h>
+#include <algorithm>
+
+
+/**
+ * Constructor
+ * @param name The name reported in the "terminationCriterion" output
+ * parameter of the algorithm when the criterion is met
+ */
+TerminationCriterion::TerminationCriterion(std::string name)
+{
+    name_ = name;
+    checkInterval_ = 0;
+    interval_ = 1;
+    nextCheck_ = -1;
+} // TerminationCriterion
+
+
+/**
+ * Destructor
+ */
+TerminationCriterion::~TerminationCriterion()
+{
+} // ~TerminationCriterion
+
+
+std::string TerminationCriterion::getName()
+{
+    return name_;
+} // getName
+
+
+/**
+ * Sets the number of evaluations between two checks of the population
+ * @param checkInterval The interval (0 = the size of the population)
+ */
+void TerminationCriterion::setCheckInterval(long checkInterval)
+{
+    checkInterval_ = checkInterval;
+} // setCheckInterval
+
+
+/**
+ * Prepares the criterion for a new run. Subclasses that keep state must
+ * call it from their own <code>start</code>.
+ */
+void TerminationCriterion::start()
+{
+    nextCheck_ = -1;
+} // start
+
+
+/**
+ * Checks whether the population has to be examined, and schedules the next
+ * check. The first call of a run is always due.
+ * @param population The current population
+ * @param evaluations Number of evaluations done so far
+ */
+bool TerminationCriterion::isCheckDue(SolutionSet * population, long evaluations)
+{
+    if (nextCheck_ < 0)
+    {
+        interval_ = checkInterval_;
+        if (interval_ <= 0)
+        {
+            interval_ = std::max(population->size(), 1);
+        }
+    }
+    else if (evaluations < nextCheck_)
+    {
+        return false;
+    }
+    nextCheck_ = evaluations + interval_;
+    return true;
+} // isCheckDue
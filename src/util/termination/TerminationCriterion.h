@@ -0,0 +1,65 @@
+//  TerminationCriterion.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __TERMINATION_CRITERION__
+#define __TERMINATION_CRITERION__
+
+#include <SolutionSet.h>
+#include <string>
+
+/**
+ * This class is the base of the criteria that stop an algorithm before it
+ * reaches its maximum number of evaluations (see
+ * <code>Algorithm::addTerminationCriterion</code>). The algorithm calls
+ * <code>start</code> when a run begins and <code>isMet</code> once per
+ * generation with its current population.
+ *
+ * The criteria that examine the population only do it when
+ * <code>isCheckDue</code> says so: every checkInterval evaluations, which
+ * by default is the size of the population. A steady-state algorithm thus
+ * pays for them once per generation instead of once per evaluation.
+ *
+ * A criterion keeps the state of a single run, so it cannot be shared by
+ * algorithms running concurrently (e.g. the islands of an
+ * <code>IslandModel</code>).
+ */
+class TerminationCriterion
+{
+
+private:
+    std::string name_;
+    long checkInterval_;
+    long interval_;
+    long nextCheck_;
+
+protected:
+    bool isCheckDue(SolutionSet * population, long evaluations);
+
+public:
+    TerminationCriterion(std::string name);
+    virtual ~TerminationCriterion();
+    std::string getName();
+    void setCheckInterval(long checkInterval);
+    virtual void start();
+    virtual bool isMet(SolutionSet * population, long evaluations) = 0;
+
+}; // TerminationCriterion
+
+#endif
@@ -0,0 +1,46 @@
+//  TimeBudget.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <TimeBudget.h>
+#include <Instrumentation.h>
+
+
+/**
+ * Constructor
+ * @param seconds The wall-clock time of a run
+ */
+TimeBudget::TimeBudget(double seconds) : TerminationCriterion("TimeBudget")
+{
+    nanoseconds_ = (long long) (seconds * 1.0e9);
+    startTime_ = Instrumentation::now();
+} // TimeBudget
+
+
+void TimeBudget::start()
+{
+    TerminationCriterion::start();
+    startTime_ = Instrumentation::now();
+} // start
+
+
+bool TimeBudget::isMet(SolutionSet * population, long evaluations)
+{
+    return (Instrumentation::now() - startTime_) >= nanoseconds_;
+} // isMet
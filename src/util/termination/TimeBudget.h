@@ -0,0 +1,45 @@
+//  TimeBudget.h
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __TIME_BUDGET__
+#define __TIME_BUDGET__
+
+#include <TerminationCriterion.h>
+
+/**
+ * This class stops an algorithm after a wall-clock time, measured from the
+ * start of the run. The algorithm finishes the generation in progress, so
+ * the budget is exceeded by up to one generation.
+ */
+class TimeBudget : public TerminationCriterion
+{
+
+private:
+    long long nanoseconds_;
+    long long startTime_;
+
+public:
+    TimeBudget(double seconds);
+    void start();
+    bool isMet(SolutionSet * population, long evaluations);
+
+}; // TimeBudget
+
+#endif
@@ -98,6 +98,75 @@ void XReal::setValue(int index, double value)
 } // setValue
 
 
+/**
+ * Copies the values of all the variables into an array. The solution type is
+ * checked once, instead of once per variable as in <code>getValue</code>
+ * @param values Array with room for all the variables
+ */
+void XReal::getValues(double * values)
+{
+    if ((typeid(*type_) == typeid(RealSolutionType)) ||
+            (typeid(*type_) == typeid(BinaryRealSolutionType)))
+    {
+        Variable ** variables = solution_->getDecisionVariables();
+        int numberOfVariables = solution_->getNumberOfVariables();
+        for (int i = 0; i < numberOfVariables; i++)
+        {
+            values[i] = variables[i]->getValue();
+        }
+    }
+    else if (typeid(*type_) == typeid(ArrayRealSolutionType))
+    {
+        ArrayReal * array = (ArrayReal*)(solution_->getDecisionVariables()[0]);
+        int length = array->getLength();
+        for (int i = 0; i < length; i++)
+        {
+            values[i] = array->getValue(i);
+        }
+    }
+    else
+    {
+        std::cout << "ERROR GRAVE: solution type "
+             << typeid(*type_).name() << " invalid" << std::endl;
+        exit(-1);
+    }
+} // getValues
+
+
+/**
+ * Sets the values of all the variables from an array
+ * @param values Array with the new values of the variables
+ */
+void XReal::setValues(const double * values)
+{
+    if ((typeid(*type_) == typeid(RealSolutionType)) ||
+            (typeid(*type_) == typeid(BinaryRealSolutionType)))
+    {
+        Variable ** variables = solution_->getDecisionVariables();
+        int numberOfVariables = solution_->getNumberOfVariables();
+        for (int i = 0; i < numberOfVariables; i++)
+        {
+            variables[i]->setValue(values[i]);
+        }
+    }
+    else if (typeid(*type_) == typeid(ArrayRealSolutionType))
+    {
+        ArrayReal * array = (ArrayReal*)(solution_->getDecisionVariables()[0]);
+        int length = array->getLength();
+        for (int i = 0; i < length; i++)
+        {
+            array->setValue(i, values[i]);
+        }
+    }
+    else
+    {
+        std::cout << "ERROR GRAVE: solution type "
+             << typeid(*type_).name() << " invalid" << std::endl;
+        exit(-1);
+    }
+} // setValues
+
+
 /**
  * Gets the lower bound of a variable
  * @param index Index of the variable
@@ -41,6 +41,8 @@ public:
     XReal(Solution * solution);
     double getValue(int index);
     void setValue(int index, double value);
+    void getValues(double * values);
+    void setValues(const double * values);
     double getLowerBound(int index);
     double getUpperBound(int index);
     int getNumberOfDecisionVariables();
@@ -0,0 +1,138 @@
+//  CEC2005SharedInstance_test.cpp
+//
+//  Author:
+//       Sérgio Vieira <sergiosvieira@gmail.com>
+//
+//  Copyright (c) 2011 Antonio J. Nebro, Juan J. Durillo
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU Lesser General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <Benchmark.h>
+#include <TestFunc.h>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+/**
+ * Evaluates one shared instance of every deterministic CEC2005 function
+ * from several threads at once and checks that each thread obtains the
+ * same values as a single-threaded run, both with f and with fBatch.
+ * The noisy functions (F04, F17, F24 and F25) are not compared.
+ *
+ * Usage: CEC2005SharedInstance_test
+ * (run from a folder two levels below the root, e.g. src/main)
+ */
+
+
+const int DIMENSION = 50;
+const int NUMBER_OF_POINTS = 64;
+const int NUMBER_OF_THREADS = 4;
+const int NUMBER_OF_ROUNDS = 20;
+
+
+/**
+ * Evaluates the points one by one with f and all together with fBatch,
+ * NUMBER_OF_ROUNDS times, and counts the values that differ from reference
+ */
+void evaluate(TestFunc * function, std::vector<double> * points,
+              const std::vector<double> * reference, int * errors)
+{
+    std::vector<double> results(NUMBER_OF_POINTS);
+    for (int round = 0; round < NUMBER_OF_ROUNDS; round++)
+    {
+        for (int p = 0; p < NUMBER_OF_POINTS; p++)
+        {
+            if (function->f(points->data() + p * DIMENSION) != (*reference)[p])
+            {
+                (*errors)++;
+            }
+        }
+        function->fBatch(points->data(), results.data(), NUMBER_OF_POINTS);
+        for (int p = 0; p < NUMBER_OF_POINTS; p++)
+        {
+            if (results[p] != (*reference)[p])
+            {
+                (*errors)++;
+            }
+        }
+    }
+} // evaluate
+
+
+int main(int argc, char ** argv)
+{
+    Benchmark benchmark;
+    int failures = 0;
+
+    for (int number = 1; number <= 25; number++)
+    {
+        if (number == 4 || number == 17 || number == 24 || number == 25)
+        {
+            continue;
+        }
+
+        TestFunc * function = benchmark.testFunctionFactory(number, DIMENSION);
+
+        std::mt19937 generator(number);
+        std::uniform_real_distribution<double> distribution(-5.0, 5.0);
+        std::vector<double> points(NUMBER_OF_POINTS * DIMENSION);
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            points[i] = distribution(generator);
+        }
+
+        std::vector<double> reference(NUMBER_OF_POINTS);
+        for (int p = 0; p < NUMBER_OF_POINTS; p++)
+        {
+            reference[p] = function->f(points.data() + p * DIMENSION);
+        }
+
+        std::vector<int> errors(NUMBER_OF_THREADS, 0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NUMBER_OF_THREADS; t++)
+        {
+            threads.push_back(std::thread(evaluate, function, &points,
+                                          &reference, &errors[t]));
+        }
+        for (int t = 0; t < NUMBER_OF_THREADS; t++)
+        {
+            threads[t].join();
+        }
+
+        int mismatches = 0;
+        for (int t = 0; t < NUMBER_OF_THREADS; t++)
+        {
+            mismatches += errors[t];
+        }
+        if (mismatches > 0)
+        {
+            std::cout << "F" << number << ": " << mismatches
+                      << " values differ from the single-threaded run" << std::endl;
+            failures++;
+        }
+
+        delete function;
+    }
+
+    if (failures > 0)
+    {
+        std::cout << failures << " functions failed" << std::endl;
+        return -1;
+    }
+    std::cout << "All shared instances agree with the single-threaded run" << std::endl;
+    return 0;
+} // main